@@ -0,0 +1,96 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <time.h>
+#include "../includes/vector.hpp"
+#include "../includes/spsc_ring.hpp"
+#include "../includes/sharded_map.hpp"
+#include "../includes/unordered_map.hpp"
+#include "../tests/counting_allocator.hpp"
+
+#define RESET "\e[0m"
+#define BLUE "\e[94m"
+#define BOLD "\e[1m"
+
+void bench_spsc_ring(void);
+void bench_sharded_map(void);
+void bench_unordered_map(void);
+void bench_sort(void);
+void bench_compare(void);
+void bench_scan(void);
+void bench_persistent_map(void);
+void bench_cow_vector(void);
+void bench_mapped_vector(void);
+void bench_serialize(void);
+void bench_mapped_map_view(void);
+void bench_huge_page_allocator(void);
+void bench_node_handle(void);
+void bench_set_operations(void);
+void bench_split_join(void);
+void bench_parallel_map(void);
+void bench_range_erase(void);
+void bench_range_scan(void);
+void bench_node_layout(void);
+void bench_compact_map(void);
+void bench_map_suite(void);
+void bench_empty_map(void);
+
+inline void print_header(std::string str)
+{
+	int margin = (40 - str.length()) / 2;
+	int width = (margin * 2 + str.length()) + 2;
+	std::cout << BLUE << std::endl;
+	std::cout << std::string(width, '*') << std::endl;
+	std::cout << "*" << std::string(margin, ' ') << str << std::string(margin, ' ') << "*" << std::endl;
+	std::cout << std::string(width, '*') << std::endl;
+	std::cout << RESET;
+};
+
+/**
+ * @brief Monotonic wall clock, in seconds.
+ *
+ */
+inline double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+};
+
+/**
+ * @brief Prints one result line as millions of operations per second.
+ *
+ */
+inline void report(std::string name, double ops, double seconds)
+{
+	std::string margin(name.length() < 38 ? 38 - name.length() : 1, ' ');
+	std::cout << name << ": " << margin << BOLD << std::fixed << std::setprecision(2)
+			  << ops / seconds / 1e6 << " M ops/s" << RESET << std::endl;
+};
+
+/**
+ * @brief Prints one result line as gigabytes read per second.
+ *
+ */
+inline void report_bandwidth(std::string name, double bytes, double seconds)
+{
+	std::string margin(name.length() < 38 ? 38 - name.length() : 1, ' ');
+	std::cout << name << ": " << margin << BOLD << std::fixed << std::setprecision(2)
+			  << bytes / seconds / 1e9 << " GB/s" << RESET << std::endl;
+};
+
+/**
+ * @brief Prints one result line as microseconds per operation, for operations too slow
+ * to read in millions per second.
+ *
+ */
+inline void report_latency(std::string name, double ops, double seconds)
+{
+	std::string margin(name.length() < 38 ? 38 - name.length() : 1, ' ');
+	std::cout << name << ": " << margin << BOLD << std::fixed << std::setprecision(2)
+			  << seconds / ops * 1e6 << " us/op" << RESET << std::endl;
+};
+#endif
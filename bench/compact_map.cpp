@@ -0,0 +1,54 @@
+#include "./bench.hpp"
+#include "../includes/map.hpp"
+#include "../includes/compact_map.hpp"
+
+#define ENTRIES (1 << 20)
+#define LOOKUPS (1 << 22)
+
+/**
+ * @brief Bytes the measured maps hold.
+ */
+struct compact_map_bytes;
+typedef AllocationCounter<count_bytes, compact_map_bytes> byte_counter;
+
+template <class Map>
+static void run(std::string name)
+{
+	volatile long sink = 0;
+	size_t before = byte_counter::live;
+	Map m;
+	double start = now();
+	for (unsigned int i = 0; i < ENTRIES; i++)
+		m.insert(ft::make_pair((int)((i * 2654435761u) % ENTRIES), (long)i));
+	report(name + " insert", ENTRIES, now() - start);
+	std::string label = name + " bytes per entry";
+	std::cout << label << ": " << std::string(38 - label.length(), ' ') << BOLD
+			  << (double)(byte_counter::live - before) / ENTRIES << RESET << std::endl;
+
+	start = now();
+	for (unsigned int i = 0; i < LOOKUPS; i++)
+		sink = sink + m.find((int)((i * 40503u) % ENTRIES))->second;
+	report(name + " find", LOOKUPS, now() - start);
+
+	start = now();
+	{
+		Map copy(m);
+		sink = sink + copy.size();
+	}
+	report_latency(name + " copy and drop", 1, now() - start);
+	(void)sink;
+}
+
+/**
+ * @brief Inserts ENTRIES keys in scattered order into an ft::map and an
+ * ft::compact_map, counting the bytes their allocator hands out, then looks keys up
+ * and copies the whole map.
+ */
+void bench_compact_map(void)
+{
+	print_header("compact_map, 2^20 entries");
+
+	typedef CountingAllocator<ft::pair<const int, long>, byte_counter> allocator;
+	run<ft::map<int, long, std::less<int>, allocator> >("ft::map");
+	run<ft::compact_map<int, long, std::less<int>, allocator> >("compact_map");
+}
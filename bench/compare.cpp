@@ -0,0 +1,95 @@
+#include "./bench.hpp"
+#include <vector>
+
+#define ELEMENTS (1 << 24)
+#define REPEAT 20
+
+/**
+ * @brief Tells the compiler memory may have changed, so that the comparisons of each
+ * round are not hoisted out of the loop. Results go to a volatile for the same reason.
+ */
+static inline void clobber(void)
+{
+	__asm__ __volatile__("" ::: "memory");
+}
+
+/**
+ * @brief What vector::operator== did before: one element at a time.
+ */
+template <typename T>
+static bool loop_equal(const ft::vector<T> &lhs, const ft::vector<T> &rhs)
+{
+	if (lhs.size() != rhs.size())
+		return false;
+	for (size_t i = 0; i < lhs.size(); i++)
+		if (lhs[i] != rhs[i])
+			return false;
+	return true;
+}
+
+/**
+ * @brief Compares two buffers that only differ on their last element, which is the
+ * worst case for every comparison. Reported in millions of elements per second.
+ */
+template <typename T>
+static void run(std::string type)
+{
+	ft::vector<T> a;
+	ft::vector<T> b;
+	for (size_t i = 0; i < ELEMENTS; i++)
+	{
+		a.push_back(static_cast<T>(i));
+		b.push_back(static_cast<T>(i));
+	}
+	b[ELEMENTS - 1] = static_cast<T>(b[ELEMENTS - 1] + 1);
+	std::vector<T> c(&a[0], &a[0] + a.size());
+	std::vector<T> d(&b[0], &b[0] + b.size());
+
+	print_header(type);
+	volatile bool result = false;
+	double start = now();
+	for (int r = 0; r < REPEAT; r++)
+	{
+		clobber();
+		result = loop_equal(a, b);
+	}
+	report("element loop ==", (double)ELEMENTS * REPEAT, now() - start);
+	start = now();
+	for (int r = 0; r < REPEAT; r++)
+	{
+		clobber();
+		result = (a == b);
+	}
+	report("ft::vector ==", (double)ELEMENTS * REPEAT, now() - start);
+	start = now();
+	for (int r = 0; r < REPEAT; r++)
+	{
+		clobber();
+		result = (c == d);
+	}
+	report("std::vector ==", (double)ELEMENTS * REPEAT, now() - start);
+	start = now();
+	for (int r = 0; r < REPEAT; r++)
+	{
+		clobber();
+		result = (a < b);
+	}
+	report("ft::vector <", (double)ELEMENTS * REPEAT, now() - start);
+	start = now();
+	for (int r = 0; r < REPEAT; r++)
+	{
+		clobber();
+		result = (c < d);
+	}
+	report("std::vector <", (double)ELEMENTS * REPEAT, now() - start);
+	(void)result;
+}
+
+void bench_compare(void)
+{
+	print_header("Vector comparison");
+
+	run<unsigned char>("unsigned char");
+	run<int>("int");
+	run<unsigned long long>("unsigned long long");
+}
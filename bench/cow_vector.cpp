@@ -0,0 +1,47 @@
+#include "./bench.hpp"
+#include "../includes/cow_vector.hpp"
+
+#define ELEMENTS (1 << 22)
+#define STAGES 4
+#define ROUNDS 20
+
+/**
+ * @brief One pipeline stage: takes the vector by value and only reads it, as most of
+ * ours do. The last stage writes one element, which costs the cow_vector one copy.
+ */
+template <class Vector>
+static long stage(Vector v, int depth)
+{
+	if (depth == STAGES)
+	{
+		v[0] = depth;
+		return (v[0]);
+	}
+	const Vector &in = v;
+	long sum = 0;
+	for (size_t i = 0; i < in.size(); i += 4096)
+		sum += in[i];
+	return (sum + stage(v, depth + 1));
+}
+
+template <class Vector>
+static void run(std::string name)
+{
+	Vector v;
+	for (int i = 0; i < ELEMENTS; i++)
+		v.push_back(i);
+	volatile long sink = 0;
+	double start = now();
+	for (int r = 0; r < ROUNDS; r++)
+		sink = stage(v, 0);
+	report_latency(name, ROUNDS, now() - start);
+	(void)sink;
+}
+
+void bench_cow_vector(void)
+{
+	print_header("Pass by value, 4 stages");
+
+	run<ft::vector<int> >("ft::vector");
+	run<ft::cow_vector<int> >("ft::cow_vector");
+}
@@ -0,0 +1,55 @@
+#include <map>
+#include "./bench.hpp"
+#include "../includes/map.hpp"
+
+#define MAPS 10000000
+
+/**
+ * @brief Calls to allocate() made by the measured maps.
+ */
+struct empty_map_calls;
+typedef AllocationCounter<count_calls, empty_map_calls> call_counter;
+
+template <class Map>
+static void run(std::string name)
+{
+	volatile size_t sink = 0;
+	size_t before = call_counter::allocated;
+	double start = now();
+	for (int i = 0; i < MAPS; i++)
+	{
+		Map m;
+		sink = sink + m.size();
+	}
+	report(name + " construct and destroy", MAPS, now() - start);
+
+	start = now();
+	for (int i = 0; i < MAPS; i++)
+	{
+		Map a;
+		Map b;
+		a.swap(b);
+		sink = sink + a.size() + b.size();
+	}
+	report(name + " swap two", MAPS, now() - start);
+
+	std::string label = name + " allocations";
+	std::cout << label << ": " << std::string(38 - label.length(), ' ') << BOLD
+			  << call_counter::allocated - before << RESET << std::endl;
+	(void)sink;
+}
+
+/**
+ * @brief Creates and destroys 10^7 empty maps, then swaps 10^7 pairs of them, and
+ * counts the allocations made on the way: per-object attribute maps that mostly stay
+ * empty should never reach the allocator.
+ */
+void bench_empty_map(void)
+{
+	print_header("empty maps, 10^7 each");
+
+	typedef CountingAllocator<ft::pair<const int, int>, call_counter> ft_allocator;
+	typedef CountingAllocator<std::pair<const int, int>, call_counter> std_allocator;
+	run<ft::map<int, int, std::less<int>, ft_allocator> >("ft::map");
+	run<std::map<int, int, std::less<int>, std_allocator> >("std::map");
+}
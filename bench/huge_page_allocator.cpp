@@ -0,0 +1,43 @@
+#include "./bench.hpp"
+#include "../includes/huge_page_allocator.hpp"
+
+#define ELEMENTS (1 << 27)
+#define ACCESSES (1 << 24)
+
+/**
+ * @brief ACCESSES reads of pseudo random elements through operator[] over a 1 GiB
+ * vector of long, far more than the TLB covers with 4 KiB pages.
+ */
+template <class Vector>
+static void run(std::string name)
+{
+	Vector v;
+	double start = now();
+	v.reserve(8);
+	for (long i = 0; i < ELEMENTS; i++)
+		v.push_back(i);
+	report("push_back, " + name, ELEMENTS, now() - start);
+
+	volatile long sink = 0;
+	unsigned long long x = 88172645463325252ull;
+	long sum = 0;
+	start = now();
+	for (int i = 0; i < ACCESSES; i++)
+	{
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		sum += v[x & (ELEMENTS - 1)];
+	}
+	report("random [], " + name, ACCESSES, now() - start);
+	sink = sum;
+	(void)sink;
+}
+
+void bench_huge_page_allocator(void)
+{
+	print_header("Random access, 1 GiB vector");
+
+	run<ft::vector<long> >("std::allocator");
+	run<ft::vector<long, ft::huge_page_allocator<long> > >("huge_page_allocator");
+}
@@ -0,0 +1,86 @@
+#include "./bench.hpp"
+
+int main(int argc, char **argv)
+{
+	std::string choice;
+	if (argc != 2)
+	{
+		std::cout << "No benchmark given, running all." << std::endl;
+		choice = "all";
+	}
+	else
+		choice = std::string(argv[1]);
+	if (choice == "spsc_ring")
+		bench_spsc_ring();
+	else if (choice == "sharded_map")
+		bench_sharded_map();
+	else if (choice == "unordered_map")
+		bench_unordered_map();
+	else if (choice == "sort")
+		bench_sort();
+	else if (choice == "compare")
+		bench_compare();
+	else if (choice == "scan")
+		bench_scan();
+	else if (choice == "persistent_map")
+		bench_persistent_map();
+	else if (choice == "cow_vector")
+		bench_cow_vector();
+	else if (choice == "mapped_vector")
+		bench_mapped_vector();
+	else if (choice == "serialize")
+		bench_serialize();
+	else if (choice == "mapped_map_view")
+		bench_mapped_map_view();
+	else if (choice == "huge_page_allocator")
+		bench_huge_page_allocator();
+	else if (choice == "node_handle")
+		bench_node_handle();
+	else if (choice == "set_operations")
+		bench_set_operations();
+	else if (choice == "split_join")
+		bench_split_join();
+	else if (choice == "parallel_map")
+		bench_parallel_map();
+	else if (choice == "range_erase")
+		bench_range_erase();
+	else if (choice == "range_scan")
+		bench_range_scan();
+	else if (choice == "node_layout")
+		bench_node_layout();
+	else if (choice == "compact_map")
+		bench_compact_map();
+	else if (choice == "map_suite")
+		bench_map_suite();
+	else if (choice == "empty_map")
+		bench_empty_map();
+	else if (choice == "all")
+	{
+		bench_spsc_ring();
+		bench_sharded_map();
+		bench_unordered_map();
+		bench_sort();
+		bench_compare();
+		bench_scan();
+		bench_persistent_map();
+		bench_cow_vector();
+		bench_mapped_vector();
+		bench_serialize();
+		bench_mapped_map_view();
+		bench_huge_page_allocator();
+		bench_node_handle();
+		bench_set_operations();
+		bench_split_join();
+		bench_parallel_map();
+		bench_range_erase();
+		bench_range_scan();
+		bench_node_layout();
+		bench_compact_map();
+		bench_map_suite();
+		bench_empty_map();
+	}
+	else
+		std::cout << "No benchmark for " << choice << std::endl;
+
+	return (0);
+}
@@ -0,0 +1,426 @@
+#include "./bench.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include "../includes/map.hpp"
+#include "../includes/algorithm.hpp"
+
+/*
+ * ft::map against std::map over key streams of 10^3 up to MAP_SUITE_MAX_SIZE keys
+ * (10^6 by default, 10^7 at most), for each phase of a map's life: build, find,
+ * lower_bound, iterate, a mix of finds, inserts and erases, and erase. One op in
+ * SAMPLE_EVERY is timed on its own for the latency percentiles. Small maps are built
+ * and measured again until each phase has run MIN_OPS ops. Every row goes to the CSV
+ * file named by MAP_SUITE_CSV, map_suite.csv by default; the summary puts both maps
+ * side by side.
+ */
+
+#define MIN_OPS (1 << 18)
+#define SAMPLE_EVERY 16
+#define DEFAULT_MAX_SIZE 1000000
+#define MAX_SIZE 10000000
+
+/**
+ * @brief Bytes the measured maps hold.
+ */
+struct map_suite_bytes;
+typedef AllocationCounter<count_bytes, map_suite_bytes> byte_counter;
+
+typedef ft::map<int, long, std::less<int>, CountingAllocator<ft::pair<const int, long>, byte_counter> > suite_ft_map;
+typedef std::map<int, long, std::less<int>, CountingAllocator<std::pair<const int, long>, byte_counter> > suite_std_map;
+
+// KEY STREAMS ===================================================================
+
+/**
+ * @brief xorshift64*: fast, and the same stream on every run.
+ */
+struct SuiteRandom
+{
+	unsigned long long state;
+
+	SuiteRandom(unsigned long long seed) : state(seed * 2685821657736338717ULL + 1) {}
+
+	unsigned long long next()
+	{
+		state ^= state >> 12;
+		state ^= state << 25;
+		state ^= state >> 27;
+		return (state * 2685821657736338717ULL);
+	}
+
+	double unit() { return ((next() >> 11) * (1.0 / 9007199254740992.0)); }
+};
+
+enum suite_workload
+{
+	SEQUENTIAL,
+	REVERSE,
+	ORGAN_PIPE,
+	RANDOM,
+	ZIPF
+};
+
+static const char *const g_workload_names[] = {"sequential", "reverse", "organ_pipe", "random", "zipf"};
+
+/**
+ * @brief Ranks drawn with P(rank k) proportional to 1 / (k + 1)^0.99, by inverting the
+ * cumulative distribution.
+ */
+struct ZipfRanks
+{
+	ft::vector<double> cdf;
+
+	ZipfRanks(size_t n) : cdf(n, 0.0)
+	{
+		double total = 0;
+		for (size_t k = 0; k < n; k++)
+		{
+			total += 1.0 / std::pow((double)(k + 1), 0.99);
+			cdf[k] = total;
+		}
+		for (size_t k = 0; k < n; k++)
+			cdf[k] /= total;
+	}
+
+	size_t draw(SuiteRandom &random) const
+	{
+		double u = random.unit();
+		size_t low = 0;
+		size_t high = cdf.size() - 1;
+		while (low < high)
+		{
+			size_t mid = low + (high - low) / 2;
+			if (cdf[mid] < u)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+		return (low);
+	}
+};
+
+/**
+ * @brief Fills keys with n keys of the workload, all even so that an odd probe falls
+ * between two keys. Zipf keys repeat; the others are a permutation of 0, 2, .. 2n - 2.
+ * Hot Zipf ranks are scattered over the key space rather than clustered at its start.
+ */
+static void make_keys(suite_workload workload, size_t n, unsigned long long seed, ft::vector<int> &keys)
+{
+	keys.clear();
+	keys.reserve(n);
+	SuiteRandom random(seed);
+	if (workload == ZIPF)
+	{
+		ZipfRanks ranks(n);
+		for (size_t i = 0; i < n; i++)
+			keys.push_back((int)(2 * ((ranks.draw(random) * 2654435761ULL) % n)));
+		return;
+	}
+	for (size_t i = 0; i < n; i++)
+	{
+		if (workload == REVERSE)
+			keys.push_back((int)(2 * (n - 1 - i)));
+		else if (workload == ORGAN_PIPE)
+			keys.push_back((int)(2 * (i % 2 == 0 ? i / 2 : n - 1 - i / 2)));
+		else
+			keys.push_back((int)(2 * i));
+	}
+	if (workload == RANDOM)
+		for (size_t i = n - 1; i > 0; i--)
+		{
+			size_t j = random.next() % (i + 1);
+			int tmp = keys[i];
+			keys[i] = keys[j];
+			keys[j] = tmp;
+		}
+}
+
+// PHASES ========================================================================
+
+template <class Map>
+struct InsertPhase
+{
+	const ft::vector<int> &keys;
+
+	InsertPhase(const ft::vector<int> &keys) : keys(keys) {}
+
+	void operator()(Map &m, size_t i) { m.insert(typename Map::value_type(keys[i], (long)i)); }
+};
+
+template <class Map>
+struct FindPhase
+{
+	const ft::vector<int> &keys;
+	long sum;
+
+	FindPhase(const ft::vector<int> &keys) : keys(keys), sum(0) {}
+
+	void operator()(Map &m, size_t i)
+	{
+		typename Map::iterator it = m.find(keys[i]);
+		if (it != m.end())
+			sum += it->second;
+	}
+};
+
+template <class Map>
+struct LowerBoundPhase
+{
+	const ft::vector<int> &keys;
+	long sum;
+
+	LowerBoundPhase(const ft::vector<int> &keys) : keys(keys), sum(0) {}
+
+	void operator()(Map &m, size_t i)
+	{
+		typename Map::iterator it = m.lower_bound(keys[i] + 1);
+		if (it != m.end())
+			sum += it->second;
+	}
+};
+
+/**
+ * @brief One op is one step of a full scan, which wraps around at the end.
+ */
+template <class Map>
+struct IteratePhase
+{
+	typename Map::iterator it;
+	long sum;
+
+	IteratePhase(Map &m) : it(m.begin()), sum(0) {}
+
+	void operator()(Map &m, size_t)
+	{
+		if (it == m.end())
+			it = m.begin();
+		sum += it->second;
+		++it;
+	}
+};
+
+/**
+ * @brief 70% finds, 15% inserts of keys the stream does not hold, 15% erases of keys
+ * it does: the map keeps about its size.
+ */
+template <class Map>
+struct MixedPhase
+{
+	const ft::vector<int> &keys;
+	SuiteRandom random;
+	int fresh;
+	long sum;
+
+	MixedPhase(const ft::vector<int> &keys) : keys(keys), random(7), fresh(-1), sum(0) {}
+
+	void operator()(Map &m, size_t i)
+	{
+		unsigned int pick = random.next() % 100;
+		if (pick < 70)
+		{
+			typename Map::iterator it = m.find(keys[i]);
+			if (it != m.end())
+				sum += it->second;
+		}
+		else if (pick < 85)
+			m.insert(typename Map::value_type(fresh -= 2, (long)i));
+		else
+			m.erase(keys[i]);
+	}
+};
+
+template <class Map>
+struct ErasePhase
+{
+	const ft::vector<int> &keys;
+
+	ErasePhase(const ft::vector<int> &keys) : keys(keys) {}
+
+	void operator()(Map &m, size_t i) { m.erase(keys[i]); }
+};
+
+/**
+ * @brief Time and latency samples of one phase, over all its rounds.
+ */
+struct PhaseResult
+{
+	double seconds;
+	double ops;
+	ft::vector<double> samples;
+
+	PhaseResult() : seconds(0), ops(0) {}
+
+	double percentile(double p)
+	{
+		if (samples.empty())
+			return (0);
+		ft::sort(samples.begin(), samples.end());
+		return (samples[(size_t)(p * (samples.size() - 1))]);
+	}
+};
+
+/**
+ * @brief Runs op(m, i) for i in [0, n), timing one call in SAMPLE_EVERY on its own.
+ */
+template <class Map, class Op>
+static void measure(Map &m, Op &op, size_t n, PhaseResult &result)
+{
+	double start = now();
+	for (size_t i = 0; i < n; i++)
+	{
+		if (i % SAMPLE_EVERY != 0)
+		{
+			op(m, i);
+			continue;
+		}
+		double op_start = now();
+		op(m, i);
+		result.samples.push_back((now() - op_start) * 1e9);
+	}
+	result.seconds += now() - start;
+	result.ops += n;
+}
+
+// RESULTS =======================================================================
+
+enum suite_phase
+{
+	INSERT,
+	FIND,
+	LOWER_BOUND,
+	ITERATE,
+	MIXED,
+	ERASE,
+	PHASES
+};
+
+static const char *const g_phase_names[] = {"insert", "find", "lower_bound", "iterate", "mixed", "erase"};
+
+struct SuiteRow
+{
+	std::string container;
+	std::string workload;
+	std::string phase;
+	size_t size;
+	double mops;
+	double p50_ns;
+	double p99_ns;
+	double bytes_per_entry;
+};
+
+/**
+ * @brief Runs every phase on maps of n keys of the workload, rebuilding as many maps
+ * as needed to reach MIN_OPS ops per phase, and appends one row per phase.
+ */
+template <class Map>
+static void run_workload(const std::string &container, suite_workload workload, size_t n, ft::vector<SuiteRow> &rows)
+{
+	ft::vector<int> keys;
+	ft::vector<int> probes;
+	make_keys(workload, n, 1, keys);
+	make_keys(workload, n, 2, probes);
+
+	PhaseResult results[PHASES];
+	double bytes = 0;
+	size_t entries = 0;
+	volatile long sink = 0;
+	size_t rounds = n >= MIN_OPS ? 1 : MIN_OPS / n;
+	for (size_t r = 0; r < rounds; r++)
+	{
+		Map m;
+		size_t before = byte_counter::live;
+		InsertPhase<Map> insert(keys);
+		measure(m, insert, n, results[INSERT]);
+		bytes += byte_counter::live - before;
+		entries += m.size();
+
+		FindPhase<Map> find(probes);
+		measure(m, find, n, results[FIND]);
+		LowerBoundPhase<Map> lower_bound(probes);
+		measure(m, lower_bound, n, results[LOWER_BOUND]);
+		IteratePhase<Map> iterate(m);
+		measure(m, iterate, n, results[ITERATE]);
+		MixedPhase<Map> mixed(probes);
+		measure(m, mixed, n, results[MIXED]);
+		ErasePhase<Map> erase(keys);
+		measure(m, erase, n, results[ERASE]);
+		sink = sink + find.sum + lower_bound.sum + iterate.sum + mixed.sum;
+	}
+	(void)sink;
+
+	for (int p = 0; p < PHASES; p++)
+	{
+		SuiteRow row;
+		row.container = container;
+		row.workload = g_workload_names[workload];
+		row.phase = g_phase_names[p];
+		row.size = n;
+		row.mops = results[p].ops / results[p].seconds / 1e6;
+		row.p50_ns = results[p].percentile(0.50);
+		row.p99_ns = results[p].percentile(0.99);
+		row.bytes_per_entry = bytes / entries;
+		rows.push_back(row);
+	}
+}
+
+static void write_csv(const std::string &path, const ft::vector<SuiteRow> &rows)
+{
+	std::ofstream out(path.c_str());
+	out << "container,workload,size,phase,mops,p50_ns,p99_ns,bytes_per_entry" << std::endl;
+	out << std::fixed << std::setprecision(2);
+	for (size_t i = 0; i < rows.size(); i++)
+		out << rows[i].container << ',' << rows[i].workload << ',' << rows[i].size << ',' << rows[i].phase << ','
+			<< rows[i].mops << ',' << rows[i].p50_ns << ',' << rows[i].p99_ns << ',' << rows[i].bytes_per_entry << std::endl;
+}
+
+/**
+ * @brief One line per workload, size and phase: ft::map then std::map, and the
+ * throughput ratio, below 1 where ft::map is slower.
+ */
+static void print_summary(const ft::vector<SuiteRow> &rows)
+{
+	std::cout << std::left << std::setw(11) << "workload" << std::right << std::setw(9) << "size" << "  "
+			  << std::left << std::setw(12) << "phase" << std::right << std::setw(9) << "ft M/s" << std::setw(9)
+			  << "std M/s" << std::setw(7) << "ratio" << std::setw(9) << "ft p50" << std::setw(9) << "ft p99"
+			  << std::setw(9) << "std p50" << std::setw(9) << "std p99" << std::setw(7) << "ft B" << std::setw(7)
+			  << "std B" << std::endl;
+	std::cout << std::fixed;
+	for (size_t i = 0; i + PHASES < rows.size(); i += 2 * PHASES)
+		for (int p = 0; p < PHASES; p++)
+		{
+			const SuiteRow &mine = rows[i + p];
+			const SuiteRow &theirs = rows[i + PHASES + p];
+			double ratio = mine.mops / theirs.mops;
+			std::cout << std::left << std::setw(11) << mine.workload << std::right << std::setw(9) << mine.size
+					  << "  " << std::left << std::setw(12) << mine.phase << std::right << std::setprecision(2)
+					  << std::setw(9) << mine.mops << std::setw(9) << theirs.mops << (ratio < 0.9 ? BOLD : "")
+					  << std::setw(7) << ratio << RESET << std::setprecision(0) << std::setw(9) << mine.p50_ns
+					  << std::setw(9) << mine.p99_ns << std::setw(9) << theirs.p50_ns << std::setw(9) << theirs.p99_ns
+					  << std::setw(7) << mine.bytes_per_entry << std::setw(7) << theirs.bytes_per_entry << std::endl;
+		}
+}
+
+void bench_map_suite(void)
+{
+	print_header("Map suite, ft::map vs std::map");
+
+	size_t max_size = DEFAULT_MAX_SIZE;
+	if (getenv("MAP_SUITE_MAX_SIZE") != NULL)
+		max_size = strtoul(getenv("MAP_SUITE_MAX_SIZE"), NULL, 10);
+	if (max_size > MAX_SIZE)
+		max_size = MAX_SIZE;
+	std::string path = getenv("MAP_SUITE_CSV") != NULL ? getenv("MAP_SUITE_CSV") : "map_suite.csv";
+
+	ft::vector<SuiteRow> rows;
+	for (int w = SEQUENTIAL; w <= ZIPF; w++)
+		for (size_t n = 1000; n <= max_size; n *= 10)
+		{
+			run_workload<suite_ft_map>("ft::map", (suite_workload)w, n, rows);
+			run_workload<suite_std_map>("std::map", (suite_workload)w, n, rows);
+		}
+	write_csv(path, rows);
+	print_summary(rows);
+	std::cout << "Latencies in ns, B per entry through the allocator. Rows written to " << path << std::endl;
+}
@@ -0,0 +1,59 @@
+#include "./bench.hpp"
+#include <cstdio>
+#include <sstream>
+#include <unistd.h>
+#include "../includes/mapped_map_view.hpp"
+
+#define ENTRIES (1 << 22)
+#define LOOKUPS (1 << 20)
+
+/**
+ * @brief Cold start against a file of ENTRIES int -> long pairs: rebuilding an ft::map
+ * with deserialize, or mapping the same entries as an image. Then LOOKUPS finds.
+ */
+void bench_mapped_map_view(void)
+{
+	print_header("Cold start, 2^22 entries");
+
+	ft::vector<ft::pair<int, long> > sorted;
+	for (int i = 0; i < ENTRIES; i++)
+		sorted.push_back(ft::make_pair(i * 2, (long)i));
+	std::ostringstream base;
+	base << "/tmp/ft_bench_map_image_" << getpid();
+	std::string serialized = base.str() + ".ser";
+	std::string image = base.str() + ".img";
+	{
+		ft::map<int, long> m;
+		m.assign_sorted(sorted.begin(), sorted.end());
+		ft::serialize(serialized, m);
+		ft::write_map_image(image, m);
+	}
+
+	volatile long sum = 0;
+	double start = now();
+	{
+		ft::map<int, long> m;
+		ft::deserialize(serialized, m);
+		report_latency("ft::map deserialize", 1, now() - start);
+		start = now();
+		for (unsigned int i = 0; i < LOOKUPS; i++)
+			sum += m.find((int)((i * 40503u) % (2 * ENTRIES)))->second;
+		report("ft::map find", LOOKUPS, now() - start);
+	}
+
+	start = now();
+	ft::mapped_map_view<int, long> view(image);
+	report_latency("mapped_map_view open", 1, now() - start);
+	start = now();
+	for (unsigned int i = 0; i < LOOKUPS; i++)
+	{
+		ft::mapped_map_view<int, long>::iterator it = view.find((int)((i * 40503u) % (2 * ENTRIES)));
+		if (it != view.end())
+			sum += it.value();
+	}
+	report("mapped_map_view find", LOOKUPS, now() - start);
+	(void)sum;
+
+	std::remove(serialized.c_str());
+	std::remove(image.c_str());
+}
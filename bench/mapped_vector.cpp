@@ -0,0 +1,77 @@
+#include "./bench.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+#include "../includes/mapped_vector.hpp"
+
+#define RECORDS (1 << 23)
+
+struct Record
+{
+	long long id;
+	double weight;
+};
+
+/**
+ * @brief What we do today: one write per element, then one read and one push_back
+ * per element to reload.
+ */
+static void stream(const std::string &path)
+{
+	double start = now();
+	{
+		std::ofstream out(path.c_str(), std::ios::binary);
+		for (long long i = 0; i < RECORDS; i++)
+		{
+			Record r = {i, i * 0.5};
+			out.write(reinterpret_cast<const char *>(&r), sizeof(r));
+		}
+	}
+	report_bandwidth("ofstream write per element", (double)RECORDS * sizeof(Record), now() - start);
+
+	start = now();
+	ft::vector<Record> v;
+	{
+		std::ifstream in(path.c_str(), std::ios::binary);
+		Record r;
+		while (in.read(reinterpret_cast<char *>(&r), sizeof(r)))
+			v.push_back(r);
+	}
+	report_latency("ifstream reload", 1, now() - start);
+}
+
+static void mapped(const std::string &path)
+{
+	double start = now();
+	{
+		ft::mapped_vector<Record> v(path, ft::mapped_file::create);
+		for (long long i = 0; i < RECORDS; i++)
+		{
+			Record r = {i, i * 0.5};
+			v.push_back(r);
+		}
+		v.sync();
+	}
+	report_bandwidth("mapped_vector push_back + sync", (double)RECORDS * sizeof(Record), now() - start);
+
+	start = now();
+	ft::mapped_vector<Record> v(path, ft::mapped_file::open_existing);
+	report_latency("mapped_vector reopen", 1, now() - start);
+	volatile double sum = 0;
+	for (size_t i = 0; i < v.size(); i++)
+		sum += v[i].weight;
+	report_latency("mapped_vector reopen + scan", 1, now() - start);
+	(void)sum;
+}
+
+void bench_mapped_vector(void)
+{
+	print_header("Persist 2^23 records of 16 bytes");
+
+	std::ostringstream path;
+	path << "/tmp/ft_bench_mapped_" << getpid();
+	stream(path.str());
+	mapped(path.str());
+	std::remove(path.str().c_str());
+}
@@ -0,0 +1,53 @@
+#include "./bench.hpp"
+#include "../includes/map.hpp"
+
+#define ENTRIES (1u << 20)
+
+typedef ft::map<unsigned int, std::string> string_map;
+
+/**
+ * @brief Visits 0 .. ENTRIES - 1 in golden ratio steps, so that consecutive keys
+ * land far apart in the tree.
+ */
+static unsigned int scattered(unsigned int i)
+{
+	return ((i * 648055u) % ENTRIES);
+}
+
+static void fill(string_map &m, unsigned int odd)
+{
+	for (unsigned int i = 0; i < ENTRIES; i++)
+		m.insert(ft::make_pair(scattered(i) * 2 + odd, std::string(32, 'a' + i % 26)));
+}
+
+/**
+ * @brief Moves ENTRIES entries of 32 character strings from one map to another: by
+ * find, copy, erase and insert, by extract and insert, and with merge.
+ */
+void bench_node_handle(void)
+{
+	print_header("Move 2^20 entries between maps");
+
+	string_map active;
+	string_map expired;
+	fill(active, 0);
+	double start = now();
+	for (unsigned int i = 0; i < ENTRIES; i++)
+	{
+		string_map::iterator it = active.find(scattered(i) * 2);
+		expired.insert(*it);
+		active.erase(it);
+	}
+	report("find + insert + erase", ENTRIES, now() - start);
+
+	start = now();
+	for (unsigned int i = 0; i < ENTRIES; i++)
+		active.insert(expired.extract(scattered(i) * 2));
+	report("extract + insert", ENTRIES, now() - start);
+
+	string_map incoming;
+	fill(incoming, 1);
+	start = now();
+	active.merge(incoming);
+	report("merge, interleaved keys", ENTRIES, now() - start);
+}
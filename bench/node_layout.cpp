@@ -0,0 +1,62 @@
+#include "./bench.hpp"
+#include <sstream>
+#include "../includes/map.hpp"
+
+#define ENTRIES (1 << 20)
+#define LOOKUPS (1 << 22)
+
+/**
+ * @brief Mapped type of Size bytes.
+ */
+template <size_t Size>
+struct Payload
+{
+	char bytes[Size];
+
+	Payload() { bytes[0] = 0; }
+
+	Payload(char c) { bytes[0] = c; }
+};
+
+static std::string with_size(std::string name, size_t size)
+{
+	std::ostringstream out;
+	out << name << ", " << size << " B mapped";
+	return (out.str());
+}
+
+template <class Layout, size_t Size>
+static void run(std::string name)
+{
+	typedef ft::map<int, Payload<Size>, std::less<int>, std::allocator<ft::pair<const int, Payload<Size> > >, Layout> payload_map;
+
+	payload_map m;
+	for (unsigned int i = 0; i < ENTRIES; i++)
+		m.insert(ft::make_pair((int)((i * 2654435761u) % ENTRIES), Payload<Size>((char)i)));
+
+	volatile long sink = 0;
+	double start = now();
+	for (unsigned int i = 0; i < LOOKUPS; i++)
+		sink = sink + m.find((int)((i * 40503u) % ENTRIES))->second.bytes[0];
+	report_latency(with_size(name, Size), LOOKUPS, now() - start);
+	(void)sink;
+}
+
+/**
+ * @brief Random find over maps of ENTRIES keys inserted in scattered order, with the
+ * inline, packed and split node layouts, for mapped types of 8, 64 and 256 bytes.
+ */
+void bench_node_layout(void)
+{
+	print_header("Node layout, find, 2^20 entries");
+
+	run<ft::inline_node_layout, 8>("inline");
+	run<ft::packed_node_layout, 8>("packed");
+	run<ft::split_node_layout, 8>("split");
+	run<ft::inline_node_layout, 64>("inline");
+	run<ft::packed_node_layout, 64>("packed");
+	run<ft::split_node_layout, 64>("split");
+	run<ft::inline_node_layout, 256>("inline");
+	run<ft::packed_node_layout, 256>("packed");
+	run<ft::split_node_layout, 256>("split");
+}
@@ -0,0 +1,74 @@
+#include "./bench.hpp"
+#include <sstream>
+#include "../includes/map.hpp"
+
+#define ENTRIES (1 << 22)
+#define UNION_ENTRIES (1 << 21)
+#define MAX_THREADS 32
+
+typedef ft::map<int, long> long_map;
+
+static std::string with_threads(std::string name, size_t threads)
+{
+	std::ostringstream out;
+	out << name << ", " << threads << (threads == 1 ? " thread" : " threads");
+	return (out.str());
+}
+
+/**
+ * @brief Builds a map of ENTRIES pairs in scattered order, then unions two maps of
+ * UNION_ENTRIES interleaved keys, half of them shared: element by element on the
+ * calling thread, then with the parallel versions on pools of 1 to MAX_THREADS threads.
+ */
+void bench_parallel_map(void)
+{
+	print_header("Parallel build / union");
+
+	ft::vector<ft::pair<int, long> > pairs;
+	for (unsigned int i = 0; i < ENTRIES; i++)
+		pairs.push_back(ft::make_pair((int)((i * 2654435761u) % ENTRIES), (long)i));
+
+	double start = now();
+	{
+		long_map m(pairs.begin(), pairs.end());
+	}
+	report("build, insert loop", ENTRIES, now() - start);
+	for (size_t threads = 1; threads <= MAX_THREADS; threads *= 2)
+	{
+		ft::thread_pool pool(threads);
+		start = now();
+		{
+			long_map m;
+			ft::parallel_build(pairs.begin(), pairs.end(), m, pool);
+		}
+		report(with_threads("build, parallel_build", threads), ENTRIES, now() - start);
+	}
+
+	ft::vector<ft::pair<int, long> > sorted_a;
+	ft::vector<ft::pair<int, long> > sorted_b;
+	for (int i = 0; i < UNION_ENTRIES; i++)
+	{
+		sorted_a.push_back(ft::make_pair(2 * i, (long)i));
+		sorted_b.push_back(ft::make_pair(2 * i + (i & 1), (long)-i));
+	}
+	long_map a;
+	long_map b;
+	a.assign_sorted(sorted_a.begin(), sorted_a.end());
+	b.assign_sorted(sorted_b.begin(), sorted_b.end());
+	{
+		long_map target(a);
+		long_map source(b);
+		start = now();
+		target.merge(source);
+		report("union, merge", 2 * UNION_ENTRIES, now() - start);
+	}
+	for (size_t threads = 1; threads <= MAX_THREADS; threads *= 2)
+	{
+		ft::thread_pool pool(threads);
+		long_map target(a);
+		long_map source(b);
+		start = now();
+		ft::parallel_union(target, source, pool);
+		report(with_threads("union, parallel_union", threads), 2 * UNION_ENTRIES, now() - start);
+	}
+}
@@ -0,0 +1,70 @@
+#include "./bench.hpp"
+#include "../includes/map.hpp"
+#include "../includes/persistent_map.hpp"
+
+#define ELEMENTS 1000000u
+#define KEPT_SNAPSHOTS 16
+#define DEEP_COPY_UPDATES 8
+#define SHARED_UPDATES 200000
+
+/**
+ * @brief Keys of the map, spread over the key space so that the unbalanced ft::map
+ * stays shallow.
+ */
+static inline int key_at(unsigned int i)
+{
+	return (static_cast<int>((i * 40503u) % ELEMENTS));
+}
+
+/**
+ * @brief Every update publishes a snapshot, and the last KEPT_SNAPSHOTS of them stay
+ * alive as a reader would hold them. With ft::map each snapshot is a deep copy.
+ */
+static void deep_copy(void)
+{
+	ft::map<int, int> map;
+	for (unsigned int i = 0; i < ELEMENTS; i++)
+		map.insert(ft::make_pair(key_at(i), (int)i));
+	ft::map<int, int> snapshots[KEPT_SNAPSHOTS];
+	double start = now();
+	for (unsigned int i = 0; i < DEEP_COPY_UPDATES; i++)
+	{
+		map[key_at(i * 7919u)] = -(int)i;
+		snapshots[i % KEPT_SNAPSHOTS] = map;
+	}
+	report_latency("ft::map update + deep copy", DEEP_COPY_UPDATES, now() - start);
+}
+
+static void shared(void)
+{
+	ft::persistent_map<int, int> map;
+	for (unsigned int i = 0; i < ELEMENTS; i++)
+		map.insert(ft::make_pair(key_at(i), (int)i));
+	ft::persistent_map<int, int> snapshots[KEPT_SNAPSHOTS];
+	double start = now();
+	for (unsigned int i = 0; i < SHARED_UPDATES; i++)
+	{
+		map.insert_or_assign(ft::make_pair(key_at(i * 7919u), -(int)i));
+		snapshots[i % KEPT_SNAPSHOTS] = map;
+	}
+	report_latency("persistent_map update + snapshot", SHARED_UPDATES, now() - start);
+
+	volatile long sum = 0;
+	start = now();
+	for (ft::persistent_map<int, int>::const_iterator it = snapshots[0].begin(); it != snapshots[0].end(); ++it)
+		sum += it->second;
+	report("persistent_map snapshot scan", ELEMENTS, now() - start);
+	start = now();
+	for (unsigned int i = 0; i < ELEMENTS; i++)
+		sum += snapshots[i % KEPT_SNAPSHOTS].count(key_at(i));
+	report("persistent_map snapshot find", ELEMENTS, now() - start);
+	(void)sum;
+}
+
+void bench_persistent_map(void)
+{
+	print_header("Snapshot per update, 10^6 keys");
+
+	deep_copy();
+	shared();
+}
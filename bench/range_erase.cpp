@@ -0,0 +1,63 @@
+#include "./bench.hpp"
+#include <sstream>
+#include "../includes/map.hpp"
+
+#define ENTRIES (1 << 22)
+
+typedef ft::map<int, long> long_map;
+
+static std::string with_window(std::string name, int window)
+{
+	std::ostringstream out;
+	out << name << ", " << window << " keys";
+	return (out.str());
+}
+
+static void erase_loop(long_map &m, int low, int high)
+{
+	long_map::iterator first = m.lower_bound(low);
+	long_map::iterator last = m.lower_bound(high);
+	while (first != last)
+		m.erase(first++);
+}
+
+/**
+ * @brief Drops a map of ENTRIES keys, then erases windows of 2^8, 2^14 and 2^20 keys
+ * from two such maps, element by element and with erase(first, last), and clears one.
+ */
+void bench_range_erase(void)
+{
+	print_header("Range erase, 2^22 entries");
+
+	ft::vector<ft::pair<int, long> > sorted;
+	for (int i = 0; i < ENTRIES; i++)
+		sorted.push_back(ft::make_pair(i, (long)i));
+	double start;
+	{
+		long_map dropped;
+		dropped.assign_sorted(sorted.begin(), sorted.end());
+		start = now();
+	}
+	report_latency("~map()", 1, now() - start);
+
+	long_map by_element;
+	long_map by_range;
+	by_element.assign_sorted(sorted.begin(), sorted.end());
+	by_range.assign_sorted(sorted.begin(), sorted.end());
+
+	int low = 0;
+	for (int window = 1 << 8; window <= 1 << 20; window <<= 6)
+	{
+		start = now();
+		erase_loop(by_element, low, low + window);
+		report(with_window("erase loop", window), window, now() - start);
+		start = now();
+		by_range.erase(by_range.lower_bound(low), by_range.lower_bound(low + window));
+		report(with_window("erase(first, last)", window), window, now() - start);
+		low += window;
+	}
+
+	start = now();
+	by_range.clear();
+	report("clear()", ENTRIES - low, now() - start);
+}
@@ -0,0 +1,87 @@
+#include "./bench.hpp"
+#include "../includes/map.hpp"
+
+#define ENTRIES (1 << 22)
+#define ROUNDS 4
+
+typedef ft::map<int, long> long_map;
+
+struct Sum
+{
+	long sum;
+
+	Sum() : sum(0) {}
+
+	bool operator()(const ft::pair<const int, long> &value)
+	{
+		sum += value.second;
+		return (true);
+	}
+};
+
+struct BatchSum
+{
+	long sum;
+
+	BatchSum() : sum(0) {}
+
+	bool operator()(const ft::pair<const int, long> *const *values, size_t n)
+	{
+		for (size_t i = 0; i < n; i++)
+			sum += values[i]->second;
+		return (true);
+	}
+};
+
+/**
+ * @brief Sums the values of a map of ENTRIES keys, inserted in scattered order so
+ * that nodes do not sit in key order in memory: with iterators, for_each and
+ * for_each_batch, against the same sum over a flat vector of pairs.
+ */
+void bench_range_scan(void)
+{
+	print_header("Range scan, 2^22 entries");
+
+	long_map m;
+	ft::vector<ft::pair<int, long> > flat;
+	for (unsigned int i = 0; i < ENTRIES; i++)
+	{
+		int key = (int)((i * 2654435761u) % ENTRIES);
+		m.insert(ft::make_pair(key, (long)i));
+	}
+	for (long_map::const_iterator it = m.begin(); it != m.end(); ++it)
+		flat.push_back(*it);
+
+	volatile long sink = 0;
+	double start = now();
+	for (int r = 0; r < ROUNDS; r++)
+	{
+		long sum = 0;
+		for (size_t i = 0; i < flat.size(); i++)
+			sum += flat[i].second;
+		sink = sink + sum;
+	}
+	report("flat vector scan", (double)ROUNDS * ENTRIES, now() - start);
+
+	start = now();
+	for (int r = 0; r < ROUNDS; r++)
+	{
+		long sum = 0;
+		long_map::const_iterator last = m.lower_bound(ENTRIES);
+		for (long_map::const_iterator it = m.lower_bound(0); it != last; ++it)
+			sum += it->second;
+		sink = sink + sum;
+	}
+	report("iterator loop", (double)ROUNDS * ENTRIES, now() - start);
+
+	start = now();
+	for (int r = 0; r < ROUNDS; r++)
+		sink = sink + m.for_each(0, ENTRIES, Sum()).sum;
+	report("for_each", (double)ROUNDS * ENTRIES, now() - start);
+
+	start = now();
+	for (int r = 0; r < ROUNDS; r++)
+		sink = sink + m.for_each_batch(0, ENTRIES, BatchSum()).sum;
+	report("for_each_batch", (double)ROUNDS * ENTRIES, now() - start);
+	(void)sink;
+}
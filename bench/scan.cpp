@@ -0,0 +1,106 @@
+#include "./bench.hpp"
+#include <cstring>
+
+#define ELEMENTS 100000000
+
+/**
+ * @brief Plain loops over ft::random_access_iterator, what callers wrote before.
+ */
+template <typename T>
+struct Scalar
+{
+	static size_t find(const ft::vector<T> &v, T val)
+	{
+		size_t i = 0;
+		while (i < v.size() && !(v[i] == val))
+			i++;
+		return (i);
+	}
+
+	static size_t count(const ft::vector<T> &v, T val)
+	{
+		size_t n = 0;
+		for (typename ft::vector<T>::const_iterator it = v.begin(); it != v.end(); ++it)
+			n += (*it == val);
+		return (n);
+	}
+
+	static size_t min_element(const ft::vector<T> &v)
+	{
+		size_t best = 0;
+		for (size_t i = 1; i < v.size(); i++)
+			if (v[i] < v[best])
+				best = i;
+		return (best);
+	}
+
+	static T accumulate(const ft::vector<T> &v)
+	{
+		T sum = T();
+		for (size_t i = 0; i < v.size(); i++)
+			sum = sum + v[i];
+		return (sum);
+	}
+};
+
+/**
+ * @brief Every scan reads the whole vector once: the value searched for is missing.
+ */
+template <typename T>
+static void run(std::string type, T missing)
+{
+	print_header(type);
+	ft::vector<T> v;
+	v.reserve(ELEMENTS);
+	for (size_t i = 0; i < ELEMENTS; i++)
+		v.push_back(static_cast<T>(i % 1000003));
+	double bytes = (double)ELEMENTS * sizeof(T);
+	volatile size_t sink = 0;
+
+	// Reference: the fastest way libc knows to read and write the same amount.
+	ft::vector<T> copy(v);
+	double start = now();
+	std::memcpy(&copy[0], &v[0], ELEMENTS * sizeof(T));
+	report_bandwidth("memcpy (read + write)", bytes * 2, now() - start);
+
+	start = now();
+	sink = Scalar<T>::find(v, missing);
+	report_bandwidth("find, loop", bytes, now() - start);
+	start = now();
+	sink = ft::find(v.begin(), v.end(), missing) - v.begin();
+	report_bandwidth("ft::find", bytes, now() - start);
+
+	start = now();
+	sink = Scalar<T>::count(v, missing);
+	report_bandwidth("count, loop", bytes, now() - start);
+	start = now();
+	sink = ft::count(v.begin(), v.end(), missing);
+	report_bandwidth("ft::count", bytes, now() - start);
+
+	start = now();
+	sink = Scalar<T>::min_element(v);
+	report_bandwidth("min_element, loop", bytes, now() - start);
+	start = now();
+	sink = ft::min_element(v.begin(), v.end()) - v.begin();
+	report_bandwidth("ft::min_element", bytes, now() - start);
+	start = now();
+	sink = ft::max_element(v.begin(), v.end()) - v.begin();
+	report_bandwidth("ft::max_element", bytes, now() - start);
+
+	start = now();
+	sink = static_cast<size_t>(Scalar<T>::accumulate(v));
+	report_bandwidth("accumulate, loop", bytes, now() - start);
+	start = now();
+	sink = static_cast<size_t>(ft::accumulate(v.begin(), v.end(), T()));
+	report_bandwidth("ft::accumulate", bytes, now() - start);
+	(void)sink;
+}
+
+void bench_scan(void)
+{
+	print_header("Scan 10^8 elements");
+
+	run<int>("int", -1);
+	run<unsigned long>("unsigned long", ~0UL);
+	run<float>("float", -1.0f);
+}
@@ -0,0 +1,98 @@
+#include "./bench.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+#include "../includes/serialize.hpp"
+
+#define VECTOR_ELEMENTS (1 << 24)
+#define MAP_ELEMENTS (1 << 22)
+
+/**
+ * @brief What we do today: operator<< and operator>> per element, map reloaded with
+ * one insert per element.
+ */
+static void stream(const std::string &path, const ft::vector<int> &v, const ft::map<int, int> &m)
+{
+	double start = now();
+	{
+		std::ofstream out(path.c_str());
+		out << v.size() << ' ';
+		for (size_t i = 0; i < v.size(); i++)
+			out << v[i] << ' ';
+	}
+	report_latency("vector operator<<", 1, now() - start);
+	start = now();
+	{
+		std::ifstream in(path.c_str());
+		size_t n;
+		in >> n;
+		ft::vector<int> loaded;
+		int val;
+		for (size_t i = 0; i < n && in >> val; i++)
+			loaded.push_back(val);
+	}
+	report_latency("vector operator>>", 1, now() - start);
+
+	start = now();
+	{
+		std::ofstream out(path.c_str());
+		out << m.size() << ' ';
+		for (ft::map<int, int>::const_iterator it = m.begin(); it != m.end(); ++it)
+			out << it->first << ' ' << it->second << ' ';
+	}
+	report_latency("map operator<<", 1, now() - start);
+	start = now();
+	{
+		std::ifstream in(path.c_str());
+		size_t n;
+		in >> n;
+		ft::map<int, int> loaded;
+		int key;
+		int val;
+		for (size_t i = 0; i < n && in >> key >> val; i++)
+			loaded.insert(ft::make_pair(key, val));
+	}
+	report_latency("map operator>> + insert", 1, now() - start);
+}
+
+static void serialized(const std::string &path, const ft::vector<int> &v, const ft::map<int, int> &m)
+{
+	double start = now();
+	ft::serialize(path, v);
+	report_latency("vector serialize + fsync", 1, now() - start);
+	start = now();
+	{
+		ft::vector<int> loaded;
+		ft::deserialize(path, loaded);
+	}
+	report_latency("vector deserialize", 1, now() - start);
+
+	start = now();
+	ft::serialize(path, m);
+	report_latency("map serialize + fsync", 1, now() - start);
+	start = now();
+	{
+		ft::map<int, int> loaded;
+		ft::deserialize(path, loaded);
+	}
+	report_latency("map deserialize", 1, now() - start);
+}
+
+void bench_serialize(void)
+{
+	print_header("Checkpoint and restore");
+
+	ft::vector<int> v;
+	for (int i = 0; i < VECTOR_ELEMENTS; i++)
+		v.push_back(i * 31);
+	ft::map<int, int> m;
+	for (unsigned int i = 0; i < MAP_ELEMENTS; i++)
+		m.insert(ft::make_pair((int)((i * 40503u) % MAP_ELEMENTS), (int)i));
+
+	std::ostringstream path;
+	path << "/tmp/ft_bench_serialize_" << getpid();
+	stream(path.str(), v, m);
+	serialized(path.str(), v, m);
+	std::remove(path.str().c_str());
+}
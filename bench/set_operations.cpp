@@ -0,0 +1,58 @@
+#include "./bench.hpp"
+#include "../includes/map.hpp"
+
+#define ENTRIES (1 << 20)
+
+typedef ft::map<int, int> int_map;
+
+/**
+ * @brief Two maps of ENTRIES interleaved keys, half of them shared: 2i, and 2i + 1 for
+ * odd i. Both are built with assign_sorted, so the loops below descend balanced
+ * trees, and inserted keys always land between two existing ones.
+ */
+static void build(int_map &m, int odd)
+{
+	ft::vector<ft::pair<int, int> > sorted;
+	for (int i = 0; i < ENTRIES; i++)
+		sorted.push_back(ft::make_pair(2 * i + (i & odd), i));
+	m.assign_sorted(sorted.begin(), sorted.end());
+}
+
+void bench_set_operations(void)
+{
+	print_header("Union / intersection, 2 x 2^20 keys");
+
+	int_map a;
+	int_map b;
+	build(a, 0);
+	build(b, 1);
+
+	double start = now();
+	{
+		int_map result(a);
+		for (int_map::const_iterator it = b.begin(); it != b.end(); ++it)
+			result.insert(*it);
+	}
+	report("union, copy + insert loop", 2 * ENTRIES, now() - start);
+	start = now();
+	{
+		int_map result;
+		ft::set_union(a, b, result);
+	}
+	report("union, ft::set_union", 2 * ENTRIES, now() - start);
+
+	start = now();
+	{
+		int_map result;
+		for (int_map::const_iterator it = a.begin(); it != a.end(); ++it)
+			if (b.find(it->first) != b.end())
+				result.insert(*it);
+	}
+	report("intersection, find + insert loop", 2 * ENTRIES, now() - start);
+	start = now();
+	{
+		int_map result;
+		ft::set_intersection(a, b, result);
+	}
+	report("intersection, ft::set_intersection", 2 * ENTRIES, now() - start);
+}
@@ -0,0 +1,136 @@
+#include "./bench.hpp"
+#include <sstream>
+#include <pthread.h>
+
+#define KEY_SPACE (1 << 16)
+#define TOTAL_OPS (1 << 20)
+#define MAX_THREADS 64
+
+/**
+ * @brief What we run today: one ft::map behind one global mutex.
+ */
+class locked_map
+{
+public:
+	locked_map() { pthread_mutex_init(&_lock, NULL); }
+	~locked_map() { pthread_mutex_destroy(&_lock); }
+
+	bool find(const int &k, int &out) const
+	{
+		pthread_mutex_lock(&_lock);
+		ft::map<int, int>::const_iterator it = _map.find(k);
+		bool found = it != _map.end();
+		if (found)
+			out = it->second;
+		pthread_mutex_unlock(&_lock);
+		return (found);
+	}
+
+	bool insert(const ft::pair<const int, int> &val)
+	{
+		pthread_mutex_lock(&_lock);
+		bool inserted = _map.insert(val).second;
+		pthread_mutex_unlock(&_lock);
+		return (inserted);
+	}
+
+	size_t erase(const int &k)
+	{
+		pthread_mutex_lock(&_lock);
+		size_t erased = _map.erase(k);
+		pthread_mutex_unlock(&_lock);
+		return (erased);
+	}
+
+private:
+	mutable pthread_mutex_t _lock;
+	ft::map<int, int> _map;
+};
+
+template <class Map>
+struct Worker
+{
+	Map *map;
+	unsigned int seed;
+	size_t ops;
+	int read_percent;
+	long hits;
+};
+
+/**
+ * @brief xorshift32, cheap enough not to show up next to the map operations.
+ */
+static inline unsigned int next_random(unsigned int &state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return (state);
+}
+
+template <class Map>
+static void *worker(void *arg)
+{
+	Worker<Map> *w = static_cast<Worker<Map> *>(arg);
+	int out;
+	for (size_t i = 0; i < w->ops; i++)
+	{
+		unsigned int r = next_random(w->seed);
+		int key = r % KEY_SPACE;
+		int action = (r >> 16) % 100;
+		if (action < w->read_percent)
+			w->hits += w->map->find(key, out);
+		else if (action % 2)
+			w->map->insert(ft::make_pair(key, key));
+		else
+			w->map->erase(key);
+	}
+	return (NULL);
+}
+
+template <class Map>
+static void run(std::string label, int threads, int read_percent)
+{
+	Map map;
+	for (int i = 0; i < KEY_SPACE / 2; i++)
+	{
+		int k = (i * 40503) % KEY_SPACE & ~1;
+		map.insert(ft::make_pair(k, k));
+	}
+	pthread_t ids[MAX_THREADS];
+	Worker<Map> workers[MAX_THREADS];
+	double start = now();
+	for (int i = 0; i < threads; i++)
+	{
+		workers[i].map = &map;
+		workers[i].seed = 2463534242u + i * 7919;
+		workers[i].ops = TOTAL_OPS / threads;
+		workers[i].read_percent = read_percent;
+		workers[i].hits = 0;
+		pthread_create(&ids[i], NULL, worker<Map>, &workers[i]);
+	}
+	for (int i = 0; i < threads; i++)
+		pthread_join(ids[i], NULL);
+	double elapsed = now() - start;
+	std::ostringstream name;
+	name << label << " " << threads << " threads";
+	report(name.str(), (TOTAL_OPS / threads) * threads, elapsed);
+}
+
+static void mix(std::string title, int read_percent)
+{
+	print_header(title);
+	for (int threads = 1; threads <= MAX_THREADS; threads *= 2)
+	{
+		run<locked_map>("mutex + ft::map", threads, read_percent);
+		run<ft::sharded_map<int, int, 64> >("sharded_map<64>", threads, read_percent);
+	}
+}
+
+void bench_sharded_map(void)
+{
+	print_header("Sharded map");
+
+	mix("Read heavy (95% find)", 95);
+	mix("Write heavy (50% find)", 50);
+}
@@ -0,0 +1,100 @@
+#include "./bench.hpp"
+#include <algorithm>
+#include <functional>
+#include <sstream>
+
+#define ELEMENTS (1 << 24)
+
+/**
+ * @brief 16-byte record, the shape of what our batch jobs sort.
+ */
+struct Record
+{
+	unsigned long long key;
+	unsigned long long payload;
+
+	bool operator<(const Record &other) const { return (key < other.key); }
+};
+
+typedef ft::vector<Record> records;
+typedef void (*sort_function)(records &, ft::thread_pool *);
+
+/**
+ * @brief xorshift64, cheap enough not to show up next to the sort.
+ */
+static inline unsigned long long next_random(unsigned long long &state)
+{
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return (state);
+}
+
+static void std_sort(records &v, ft::thread_pool *)
+{
+	std::sort(&v[0], &v[0] + v.size());
+}
+
+static void ft_sort(records &v, ft::thread_pool *)
+{
+	ft::sort(v.begin(), v.end());
+}
+
+static void ft_stable_sort(records &v, ft::thread_pool *)
+{
+	ft::stable_sort(v.begin(), v.end());
+}
+
+static void ft_parallel_sort(records &v, ft::thread_pool *pool)
+{
+	ft::parallel_sort(v.begin(), v.end(), std::less<Record>(), *pool);
+}
+
+static void run(std::string label, const records &input, sort_function sorter, ft::thread_pool *pool)
+{
+	records v(input);
+	double start = now();
+	sorter(v, pool);
+	double elapsed = now() - start;
+	for (size_t i = 1; i < v.size(); i++)
+	{
+		if (v[i] < v[i - 1])
+		{
+			std::cout << label << ": not sorted" << std::endl;
+			return;
+		}
+	}
+	report(label, v.size(), elapsed);
+}
+
+void bench_sort(void)
+{
+	print_header("Sort");
+
+	records input;
+	input.reserve(ELEMENTS);
+	unsigned long long seed = 88172645463325252ULL;
+	for (size_t i = 0; i < ELEMENTS; i++)
+	{
+		Record r;
+		r.key = next_random(seed);
+		r.payload = i;
+		input.push_back(r);
+	}
+
+	run("std::sort", input, std_sort, NULL);
+	run("ft::sort", input, ft_sort, NULL);
+	run("ft::stable_sort", input, ft_stable_sort, NULL);
+	size_t cores = ft::thread_pool::hardware_concurrency();
+	if (cores < 2)
+		cores = 2;
+	for (size_t threads = 2; threads < cores * 2; threads *= 2)
+	{
+		if (threads > cores)
+			threads = cores;
+		ft::thread_pool pool(threads);
+		std::ostringstream name;
+		name << "ft::parallel_sort " << threads << " threads";
+		run(name.str(), input, ft_parallel_sort, &pool);
+	}
+}
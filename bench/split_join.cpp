@@ -0,0 +1,39 @@
+#include "./bench.hpp"
+#include "../includes/map.hpp"
+
+#define ENTRIES (1 << 22)
+#define ROUNDS 1000
+
+typedef ft::map<int, long> long_map;
+
+/**
+ * @brief Hands the upper half of a map of ENTRIES keys to another shard and takes it
+ * back: by reinserting every element, then ROUNDS times with split_off and append.
+ */
+void bench_split_join(void)
+{
+	print_header("Repartition 2^22 entries");
+
+	ft::vector<ft::pair<int, long> > sorted;
+	for (int i = 0; i < ENTRIES; i++)
+		sorted.push_back(ft::make_pair(i, (long)i));
+	long_map shard;
+	shard.assign_sorted(sorted.begin(), sorted.end());
+	long_map other;
+
+	double start = now();
+	long_map::iterator middle = shard.lower_bound(ENTRIES / 2);
+	other.insert(middle, shard.end());
+	shard.erase(middle, shard.end());
+	shard.insert(other.begin(), other.end());
+	other.clear();
+	report_latency("insert + erase, split and join", 1, now() - start);
+
+	start = now();
+	for (int i = 0; i < ROUNDS; i++)
+	{
+		shard.split_off(ENTRIES / 2 + i, other);
+		shard.append(other);
+	}
+	report_latency("split_off + append", ROUNDS, now() - start);
+}
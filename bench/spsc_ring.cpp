@@ -0,0 +1,149 @@
+#include "./bench.hpp"
+#include <sstream>
+#include <pthread.h>
+#include <sched.h>
+
+#define HANDOFFS (1 << 21)
+#define BATCH 32
+#define RING_SIZE 1024
+
+template <size_t N>
+struct Payload
+{
+	char bytes[N];
+};
+
+template <size_t N>
+struct Context
+{
+	ft::spsc_ring<Payload<N> > ring;
+	ft::vector<Payload<N> > shared;
+	pthread_mutex_t lock;
+	size_t batch;
+
+	Context(size_t batch) : ring(RING_SIZE), shared(), batch(batch) { pthread_mutex_init(&lock, NULL); }
+	~Context() { pthread_mutex_destroy(&lock); }
+};
+
+template <size_t N>
+static void *ring_producer(void *arg)
+{
+	Context<N> *ctx = static_cast<Context<N> *>(arg);
+	Payload<N> buf[BATCH];
+	for (size_t i = 0; i < BATCH; i++)
+		buf[i].bytes[0] = 1;
+	size_t sent = 0;
+	while (sent < HANDOFFS)
+	{
+		size_t pushed;
+		if (ctx->batch == 1)
+			pushed = ctx->ring.try_push(buf[0]) ? 1 : 0;
+		else
+			pushed = ctx->ring.try_push_n(buf, ctx->batch);
+		if (pushed == 0)
+			sched_yield();
+		sent += pushed;
+	}
+	return (NULL);
+}
+
+template <size_t N>
+static void *mutex_producer(void *arg)
+{
+	Context<N> *ctx = static_cast<Context<N> *>(arg);
+	Payload<N> item;
+	item.bytes[0] = 1;
+	for (size_t sent = 0; sent < HANDOFFS; sent += ctx->batch)
+	{
+		pthread_mutex_lock(&ctx->lock);
+		for (size_t i = 0; i < ctx->batch; i++)
+			ctx->shared.push_back(item);
+		pthread_mutex_unlock(&ctx->lock);
+	}
+	return (NULL);
+}
+
+template <size_t N>
+static void run_ring(size_t batch)
+{
+	Context<N> ctx(batch);
+	Payload<N> buf[BATCH];
+	size_t received = 0;
+	long checksum = 0;
+	pthread_t thread;
+	double start = now();
+	pthread_create(&thread, NULL, ring_producer<N>, &ctx);
+	while (received < HANDOFFS)
+	{
+		size_t n;
+		if (batch == 1)
+			n = ctx.ring.try_pop(buf[0]) ? 1 : 0;
+		else
+			n = ctx.ring.try_pop_n(buf, batch);
+		if (n == 0)
+			sched_yield();
+		for (size_t i = 0; i < n; i++)
+			checksum += buf[i].bytes[0];
+		received += n;
+	}
+	pthread_join(thread, NULL);
+	double elapsed = now() - start;
+	std::ostringstream name;
+	name << "spsc_ring " << N << "B batch " << batch;
+	if (checksum != HANDOFFS)
+		name << " (checksum mismatch)";
+	report(name.str(), HANDOFFS, elapsed);
+}
+
+template <size_t N>
+static void run_mutex(size_t batch)
+{
+	Context<N> ctx(batch);
+	ft::vector<Payload<N> > local;
+	size_t received = 0;
+	long checksum = 0;
+	pthread_t thread;
+	double start = now();
+	pthread_create(&thread, NULL, mutex_producer<N>, &ctx);
+	while (received < HANDOFFS)
+	{
+		pthread_mutex_lock(&ctx.lock);
+		local.swap(ctx.shared);
+		pthread_mutex_unlock(&ctx.lock);
+		if (local.empty())
+			sched_yield();
+		for (size_t i = 0; i < local.size(); i++)
+			checksum += local[i].bytes[0];
+		received += local.size();
+		local.clear();
+	}
+	pthread_join(thread, NULL);
+	double elapsed = now() - start;
+	std::ostringstream name;
+	name << "mutex + ft::vector " << N << "B batch " << batch;
+	if (checksum != HANDOFFS)
+		name << " (checksum mismatch)";
+	report(name.str(), HANDOFFS, elapsed);
+}
+
+template <size_t N>
+static void payload(void)
+{
+	std::ostringstream title;
+	title << "Payload " << N << " bytes";
+	print_header(title.str());
+	run_mutex<N>(1);
+	run_mutex<N>(BATCH);
+	run_ring<N>(1);
+	run_ring<N>(BATCH);
+}
+
+void bench_spsc_ring(void)
+{
+	print_header("SPSC ring handoffs");
+
+	payload<8>();
+	payload<64>();
+	payload<256>();
+	payload<1024>();
+}
@@ -0,0 +1,95 @@
+#include "./bench.hpp"
+#include <vector>
+#include <sstream>
+#include "../includes/map.hpp"
+#if __cplusplus >= 201103L
+#include <unordered_map>
+typedef std::unordered_map<int, int> std_unordered_map;
+#define STD_UNORDERED_MAP "std::unordered_map"
+#else
+#include <tr1/unordered_map>
+typedef std::tr1::unordered_map<int, int> std_unordered_map;
+#define STD_UNORDERED_MAP "std::tr1::unordered_map"
+#endif
+
+#define ELEMENTS (1 << 18)
+#define LOOKUPS (1 << 22)
+
+/**
+ * @brief xorshift32, cheap enough not to show up next to the lookups.
+ */
+static inline unsigned int next_random(unsigned int &state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return (state);
+}
+
+/**
+ * @brief Builds a map holding the even keys of [0, 2 * ELEMENTS), inserted in a
+ * scattered order.
+ */
+template <class Map>
+static void fill(Map &map)
+{
+	for (int i = 0; i < ELEMENTS; i++)
+	{
+		int k = (int)((i * 40503u) % ELEMENTS) * 2;
+		map.insert(typename Map::value_type(k, k));
+	}
+}
+
+/**
+ * @brief LOOKUPS random keys, of which hit_percent are present in the map.
+ */
+static std::vector<int> make_keys(int hit_percent)
+{
+	std::vector<int> keys(LOOKUPS);
+	unsigned int seed = 2463534242u;
+	for (size_t i = 0; i < keys.size(); i++)
+	{
+		unsigned int r = next_random(seed);
+		int k = (r % ELEMENTS) * 2;
+		keys[i] = (int)((r >> 8) % 100) < hit_percent ? k : k + 1;
+	}
+	return (keys);
+}
+
+template <class Map>
+static void run(std::string label, const Map &map, const std::vector<int> &keys)
+{
+	long hits = 0;
+	double start = now();
+	for (size_t i = 0; i < keys.size(); i++)
+		hits += map.find(keys[i]) != map.end();
+	double elapsed = now() - start;
+	report(label, keys.size(), elapsed);
+	// Keeps the loop from being optimized out.
+	if (hits < 0)
+		std::cout << hits << std::endl;
+}
+
+void bench_unordered_map(void)
+{
+	print_header("Unordered map");
+
+	ft::unordered_map<int, int> flat;
+	std_unordered_map chained;
+	ft::map<int, int> tree;
+	fill(flat);
+	fill(chained);
+	fill(tree);
+
+	int mixes[] = {100, 90, 10, 0};
+	for (size_t i = 0; i < sizeof(mixes) / sizeof(*mixes); i++)
+	{
+		std::vector<int> keys = make_keys(mixes[i]);
+		std::ostringstream title;
+		title << mixes[i] << "% hits";
+		print_header(title.str());
+		run("ft::unordered_map", flat, keys);
+		run(STD_UNORDERED_MAP, chained, keys);
+		run("ft::map", tree, keys);
+	}
+}
@@ -1,8 +1,209 @@
 #ifndef ALGORITHM_HPP
 #define ALGORITHM_HPP
 
+#include <memory>
+#include <functional>
+#include <cstddef>
+#include <cstring>
+#include "./utils.hpp"
+#include "./iterator_traits.hpp"
+#include "./iterator.hpp"
+#include "./thread_pool.hpp"
+#include "./simd.hpp"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace ft
 {
+    // BITWISE COMPARISON =========================================================
+    /*
+     * equal and lexicographical_compare (without predicate) compare raw memory when both
+     * ranges are contiguous (pointers or ft::random_access_iterator over pointers) and
+     * hold the same integral or pointer type: for those, two elements are equal exactly
+     * when their bytes are. equal becomes a memcmp; lexicographical_compare looks for the
+     * first differing byte 16 bytes at a time and compares only the element holding it.
+     * Every other range keeps the element by element loop.
+     */
+
+    /**
+     * @brief Raw pointer view of contiguous iterators. value is false for other iterators.
+     */
+    template <typename Iterator>
+    struct contiguous_iterator
+    {
+        static const bool value = false;
+        typedef void value_type;
+    };
+
+    template <typename T>
+    struct contiguous_iterator<T *>
+    {
+        static const bool value = true;
+        typedef T value_type;
+        static const T *address(T *it) { return it; }
+    };
+
+    template <typename T>
+    struct contiguous_iterator<const T *>
+    {
+        static const bool value = true;
+        typedef T value_type;
+        static const T *address(const T *it) { return it; }
+    };
+
+    template <typename T>
+    struct contiguous_iterator<random_access_iterator<T *> >
+    {
+        static const bool value = true;
+        typedef T value_type;
+        static const T *address(random_access_iterator<T *> it) { return it.base(); }
+    };
+
+    template <typename T>
+    struct contiguous_iterator<random_access_iterator<const T *> >
+    {
+        static const bool value = true;
+        typedef T value_type;
+        static const T *address(random_access_iterator<const T *> it) { return it.base(); }
+    };
+
+    /**
+     * @brief True for types whose == and < only depend on their bytes being equal.
+     */
+    template <typename T>
+    struct bitwise_comparable
+    {
+        static const bool value = is_integral<T>::value;
+    };
+
+    template <typename T>
+    struct bitwise_comparable<T *>
+    {
+        static const bool value = true;
+    };
+
+    template <typename T, typename U>
+    struct _same_bitwise_comparable
+    {
+        static const bool value = false;
+    };
+
+    template <typename T>
+    struct _same_bitwise_comparable<T, T>
+    {
+        static const bool value = bitwise_comparable<T>::value;
+    };
+
+    /**
+     * @brief True when [first1, last1) and [first2, ...) can be compared as raw memory.
+     */
+    template <typename Iterator1, typename Iterator2>
+    struct use_bitwise_compare
+    {
+        static const bool value = contiguous_iterator<Iterator1>::value && contiguous_iterator<Iterator2>::value &&
+                                  _same_bitwise_comparable<typename contiguous_iterator<Iterator1>::value_type,
+                                                           typename contiguous_iterator<Iterator2>::value_type>::value;
+    };
+
+    /**
+     * @brief Offset of the first byte differing between a and b, or len if none does.
+     */
+    inline size_t mismatch_bytes(const void *a, const void *b, size_t len)
+    {
+        const unsigned char *p = static_cast<const unsigned char *>(a);
+        const unsigned char *q = static_cast<const unsigned char *>(b);
+        size_t i = 0;
+#if defined(__SSE2__)
+        for (; i + 32 <= len; i += 32)
+        {
+            __m128i eq0 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)),
+                                         _mm_loadu_si128(reinterpret_cast<const __m128i *>(q + i)));
+            __m128i eq1 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i + 16)),
+                                         _mm_loadu_si128(reinterpret_cast<const __m128i *>(q + i + 16)));
+            unsigned int mask = _mm_movemask_epi8(_mm_and_si128(eq0, eq1));
+            if (mask != 0xffff)
+            {
+                unsigned int diff = ~(_mm_movemask_epi8(eq0) | (_mm_movemask_epi8(eq1) << 16));
+                return (i + __builtin_ctz(diff));
+            }
+        }
+        for (; i + 16 <= len; i += 16)
+        {
+            unsigned int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)),
+                                                                 _mm_loadu_si128(reinterpret_cast<const __m128i *>(q + i))));
+            if (mask != 0xffff)
+                return (i + __builtin_ctz(~mask));
+        }
+#endif
+        for (; i < len; i++)
+            if (p[i] != q[i])
+                return (i);
+        return (len);
+    }
+
+    template <bool Bitwise>
+    struct _compare_impl
+    {
+        template <class InputIterator1, class InputIterator2>
+        static bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+        {
+            while (first1 != last1)
+            {
+                if (!(*first1 == *first2))
+                    return false;
+                ++first1;
+                ++first2;
+            }
+            return true;
+        }
+
+        template <class InputIterator1, class InputIterator2>
+        static bool less(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+        {
+            while (first1 != last1)
+            {
+                if (first2 == last2 || *first2 < *first1)
+                    return false;
+                else if (*first1 < *first2)
+                    return true;
+                ++first1;
+                ++first2;
+            }
+            return (first2 != last2);
+        }
+    };
+
+    template <>
+    struct _compare_impl<true>
+    {
+        template <class Iterator1, class Iterator2>
+        static bool equal(Iterator1 first1, Iterator1 last1, Iterator2 first2)
+        {
+            size_t len = (last1 - first1) * sizeof(typename contiguous_iterator<Iterator1>::value_type);
+            return (len == 0 || std::memcmp(contiguous_iterator<Iterator1>::address(first1),
+                                            contiguous_iterator<Iterator2>::address(first2), len) == 0);
+        }
+
+        template <class Iterator1, class Iterator2>
+        static bool less(Iterator1 first1, Iterator1 last1, Iterator2 first2, Iterator2 last2)
+        {
+            typedef typename contiguous_iterator<Iterator1>::value_type value_type;
+
+            size_t len1 = last1 - first1;
+            size_t len2 = last2 - first2;
+            size_t len = len1 < len2 ? len1 : len2;
+            if (len == 0)
+                return (len1 < len2);
+            const value_type *a = contiguous_iterator<Iterator1>::address(first1);
+            const value_type *b = contiguous_iterator<Iterator2>::address(first2);
+            size_t i = mismatch_bytes(a, b, len * sizeof(value_type)) / sizeof(value_type);
+            if (i == len)
+                return (len1 < len2);
+            return (a[i] < b[i]);
+        }
+    };
+
     /**
      * @brief  Compares the elements in the range [first1,last1) with those in the
      * range beginning at first2, and returns true if all of the elements in both
@@ -15,14 +216,7 @@ namespace ft
     template <class InputIterator1, class InputIterator2>
     bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
     {
-        while (first1 != last1)
-        {
-            if (!(*first1 == *first2))
-                return false;
-            ++first1;
-            ++first2;
-        }
-        return true;
+        return _compare_impl<use_bitwise_compare<InputIterator1, InputIterator2>::value>::equal(first1, last1, first2);
     }
 
     /**
@@ -59,16 +253,7 @@ namespace ft
     template <class InputIterator1, class InputIterator2>
     bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
     {
-        while (first1 != last1)
-        {
-            if (first2 == last2 || *first2 < *first1)
-                return false;
-            else if (*first1 < *first2)
-                return true;
-            ++first1;
-            ++first2;
-        }
-        return (first2 != last2);
+        return _compare_impl<use_bitwise_compare<InputIterator1, InputIterator2>::value>::less(first1, last1, first2, last2);
     }
 
     /**
@@ -94,6 +279,957 @@ namespace ft
         }
         return (first2 != last2);
     }
+
+
+    // SCAN =========================================================================
+    /*
+     * find, count, min_element, max_element and accumulate run the kernels of simd.hpp
+     * when the range is contiguous and holds int, a 64-bit unsigned integer or float, and
+     * (for find, count and accumulate) the value has that exact type: find(v.begin(),
+     * v.end(), 3) on a vector of unsigned long stays on the plain loop, since 3 is an int.
+     * accumulate is only vectorized for integers, where adding in another order gives
+     * the same result; a float sum keeps its sequential rounding.
+     */
+
+    /**
+     * @brief Element types with scan kernels, and the type the kernels take them as.
+     */
+    template <typename T>
+    struct simd_scan
+    {
+        static const bool value = false;
+        static const bool exact_sum = false;
+        typedef T kernel_type;
+    };
+
+#if FT_SIMD_X86
+    template <>
+    struct simd_scan<int>
+    {
+        static const bool value = true;
+        static const bool exact_sum = true;
+        typedef int kernel_type;
+    };
+
+    template <>
+    struct simd_scan<unsigned long long>
+    {
+        static const bool value = true;
+        static const bool exact_sum = true;
+        typedef unsigned long long kernel_type;
+    };
+
+#if __SIZEOF_LONG__ == 8
+    template <>
+    struct simd_scan<unsigned long>
+    {
+        static const bool value = true;
+        static const bool exact_sum = true;
+        typedef unsigned long long kernel_type;
+    };
+#endif
+
+    template <>
+    struct simd_scan<float>
+    {
+        static const bool value = true;
+        static const bool exact_sum = false;
+        typedef float kernel_type;
+    };
+#endif
+
+    /**
+     * @brief True when a scan of [first, last) for a value of type T can use the kernels.
+     */
+    template <typename Iterator, typename T>
+    struct use_simd_scan
+    {
+        static const bool value = contiguous_iterator<Iterator>::value &&
+                                  is_same<typename contiguous_iterator<Iterator>::value_type, T>::value &&
+                                  simd_scan<T>::value;
+    };
+
+    template <bool Simd>
+    struct _scan_impl
+    {
+        template <class InputIterator, class T>
+        static InputIterator find(InputIterator first, InputIterator last, const T &val)
+        {
+            while (first != last && !(*first == val))
+                ++first;
+            return (first);
+        }
+
+        template <class InputIterator, class T>
+        static typename iterator_traits<InputIterator>::difference_type count(InputIterator first, InputIterator last, const T &val)
+        {
+            typename iterator_traits<InputIterator>::difference_type n = 0;
+            for (; first != last; ++first)
+                if (*first == val)
+                    n++;
+            return (n);
+        }
+
+        template <bool Max, class ForwardIterator>
+        static ForwardIterator extreme(ForwardIterator first, ForwardIterator last)
+        {
+            if (first == last)
+                return (last);
+            ForwardIterator best = first;
+            while (++first != last)
+                if (Max ? *best < *first : *first < *best)
+                    best = first;
+            return (best);
+        }
+
+        template <class InputIterator, class T>
+        static T accumulate(InputIterator first, InputIterator last, T init)
+        {
+            for (; first != last; ++first)
+                init = init + *first;
+            return (init);
+        }
+    };
+
+    template <>
+    struct _scan_impl<true>
+    {
+        template <class Iterator, class T>
+        static const typename simd_scan<T>::kernel_type *_address(Iterator it)
+        {
+            return (reinterpret_cast<const typename simd_scan<T>::kernel_type *>(contiguous_iterator<Iterator>::address(it)));
+        }
+
+        template <class Iterator, class T>
+        static Iterator find(Iterator first, Iterator last, const T &val)
+        {
+            return (first + simd::find(_address<Iterator, T>(first), last - first, static_cast<typename simd_scan<T>::kernel_type>(val)));
+        }
+
+        template <class Iterator, class T>
+        static typename iterator_traits<Iterator>::difference_type count(Iterator first, Iterator last, const T &val)
+        {
+            return (simd::count(_address<Iterator, T>(first), last - first, static_cast<typename simd_scan<T>::kernel_type>(val)));
+        }
+
+        template <bool Max, class Iterator>
+        static Iterator extreme(Iterator first, Iterator last)
+        {
+            typedef typename contiguous_iterator<Iterator>::value_type value_type;
+
+            if (first == last)
+                return (last);
+            return (first + simd::extreme<Max>(_address<Iterator, value_type>(first), last - first));
+        }
+
+        template <class Iterator, class T>
+        static T accumulate(Iterator first, Iterator last, T init)
+        {
+            return (init + static_cast<T>(simd::sum(_address<Iterator, T>(first), last - first)));
+        }
+    };
+
+    /**
+     * @brief  Returns an iterator to the first element in the range [first,last) that
+     * compares equal to val, or last if there is none.
+     *
+     * @param  first  An input iterator.
+     * @param  last   An input iterator.
+     * @param  val    Value to search for.
+     */
+    template <class InputIterator, class T>
+    InputIterator find(InputIterator first, InputIterator last, const T &val)
+    {
+        return (_scan_impl<use_simd_scan<InputIterator, T>::value>::find(first, last, val));
+    }
+
+    /**
+     * @brief  Returns the number of elements in the range [first,last) that compare equal to val.
+     *
+     * @param  first  An input iterator.
+     * @param  last   An input iterator.
+     * @param  val    Value to count.
+     */
+    template <class InputIterator, class T>
+    typename iterator_traits<InputIterator>::difference_type count(InputIterator first, InputIterator last, const T &val)
+    {
+        return (_scan_impl<use_simd_scan<InputIterator, T>::value>::count(first, last, val));
+    }
+
+    /**
+     * @brief  Returns an iterator to the first smallest element in the range [first,last),
+     * or last if the range is empty.
+     *
+     * @param  first  A forward iterator.
+     * @param  last   A forward iterator.
+     */
+    template <class ForwardIterator>
+    ForwardIterator min_element(ForwardIterator first, ForwardIterator last)
+    {
+        typedef typename iterator_traits<ForwardIterator>::value_type value_type;
+        return (_scan_impl<use_simd_scan<ForwardIterator, value_type>::value>::template extreme<false>(first, last));
+    }
+
+    /**
+     * @brief  Returns an iterator to the first smallest element in the range [first,last)
+     * according to comp, or last if the range is empty.
+     *
+     * @param  first  A forward iterator.
+     * @param  last   A forward iterator.
+     * @param  comp   A binary predicate.
+     */
+    template <class ForwardIterator, class Compare>
+    ForwardIterator min_element(ForwardIterator first, ForwardIterator last, Compare comp)
+    {
+        if (first == last)
+            return (last);
+        ForwardIterator best = first;
+        while (++first != last)
+            if (comp(*first, *best))
+                best = first;
+        return (best);
+    }
+
+    /**
+     * @brief  Returns an iterator to the first largest element in the range [first,last),
+     * or last if the range is empty.
+     *
+     * @param  first  A forward iterator.
+     * @param  last   A forward iterator.
+     */
+    template <class ForwardIterator>
+    ForwardIterator max_element(ForwardIterator first, ForwardIterator last)
+    {
+        typedef typename iterator_traits<ForwardIterator>::value_type value_type;
+        return (_scan_impl<use_simd_scan<ForwardIterator, value_type>::value>::template extreme<true>(first, last));
+    }
+
+    /**
+     * @brief  Returns an iterator to the first largest element in the range [first,last)
+     * according to comp, or last if the range is empty.
+     *
+     * @param  first  A forward iterator.
+     * @param  last   A forward iterator.
+     * @param  comp   A binary predicate.
+     */
+    template <class ForwardIterator, class Compare>
+    ForwardIterator max_element(ForwardIterator first, ForwardIterator last, Compare comp)
+    {
+        if (first == last)
+            return (last);
+        ForwardIterator best = first;
+        while (++first != last)
+            if (comp(*best, *first))
+                best = first;
+        return (best);
+    }
+
+    /**
+     * @brief  Returns init plus every element of the range [first,last).
+     *
+     * @param  first  An input iterator.
+     * @param  last   An input iterator.
+     * @param  init   Initial value of the sum.
+     */
+    template <class InputIterator, class T>
+    T accumulate(InputIterator first, InputIterator last, T init)
+    {
+        return (_scan_impl<use_simd_scan<InputIterator, T>::value && simd_scan<T>::exact_sum>::accumulate(first, last, init));
+    }
+
+    /**
+     * @brief  Folds the elements of the range [first,last) into init with op, in order.
+     *
+     * @param  first  An input iterator.
+     * @param  last   An input iterator.
+     * @param  init   Initial value.
+     * @param  op     A binary operation.
+     */
+    template <class InputIterator, class T, class BinaryOperation>
+    T accumulate(InputIterator first, InputIterator last, T init, BinaryOperation op)
+    {
+        for (; first != last; ++first)
+            init = op(init, *first);
+        return (init);
+    }
+
+    // SORT =========================================================================
+    /*
+     * Helpers shared by sort, stable_sort and parallel_sort. Ranges are random access,
+     * elements only need to be copy constructible and assignable.
+     */
+
+    /**
+     * @brief Below this many elements, partitions are left to the final insertion sort.
+     */
+    static const ptrdiff_t sort_threshold = 16;
+
+    template <class RandomAccessIterator>
+    void _iter_swap(RandomAccessIterator a, RandomAccessIterator b)
+    {
+        typename iterator_traits<RandomAccessIterator>::value_type tmp = *a;
+        *a = *b;
+        *b = tmp;
+    }
+
+    template <class RandomAccessIterator, class Compare>
+    void _insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+    {
+        if (first == last)
+            return;
+        for (RandomAccessIterator i = first + 1; i != last; ++i)
+        {
+            typename iterator_traits<RandomAccessIterator>::value_type val = *i;
+            RandomAccessIterator j = i;
+            if (comp(val, *first))
+            {
+                for (; j != first; --j)
+                    *j = *(j - 1);
+            }
+            else
+            {
+                for (RandomAccessIterator prev = j - 1; comp(val, *prev); --prev)
+                {
+                    *j = *prev;
+                    j = prev;
+                }
+            }
+            *j = val;
+        }
+    }
+
+    template <class RandomAccessIterator, class Distance, class Compare>
+    void _sift_down(RandomAccessIterator first, Distance hole, Distance len, Compare comp)
+    {
+        typename iterator_traits<RandomAccessIterator>::value_type val = *(first + hole);
+        Distance child;
+        while ((child = 2 * hole + 1) < len)
+        {
+            if (child + 1 < len && comp(*(first + child), *(first + child + 1)))
+                child++;
+            if (!comp(val, *(first + child)))
+                break;
+            *(first + hole) = *(first + child);
+            hole = child;
+        }
+        *(first + hole) = val;
+    }
+
+    template <class RandomAccessIterator, class Compare>
+    void _heap_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+    {
+        typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+        difference_type len = last - first;
+        for (difference_type i = len / 2; i-- > 0;)
+            _sift_down(first, i, len, comp);
+        while (--len > 0)
+        {
+            _iter_swap(first, first + len);
+            _sift_down(first, difference_type(0), len, comp);
+        }
+    }
+
+    /**
+     * @brief Moves the median of *a, *b and *c to *result.
+     */
+    template <class RandomAccessIterator, class Compare>
+    void _move_median_to_first(RandomAccessIterator result, RandomAccessIterator a, RandomAccessIterator b,
+                               RandomAccessIterator c, Compare comp)
+    {
+        if (comp(*a, *b))
+        {
+            if (comp(*b, *c))
+                _iter_swap(result, b);
+            else if (comp(*a, *c))
+                _iter_swap(result, c);
+            else
+                _iter_swap(result, a);
+        }
+        else if (comp(*a, *c))
+            _iter_swap(result, a);
+        else if (comp(*b, *c))
+            _iter_swap(result, c);
+        else
+            _iter_swap(result, b);
+    }
+
+    /**
+     * @brief Partitions [first, last) around *pivot, which must not be in the range. The
+     * median-of-three pivot guarantees both scans stop without bound checks.
+     */
+    template <class RandomAccessIterator, class Compare>
+    RandomAccessIterator _unguarded_partition(RandomAccessIterator first, RandomAccessIterator last,
+                                              RandomAccessIterator pivot, Compare comp)
+    {
+        for (;;)
+        {
+            while (comp(*first, *pivot))
+                ++first;
+            --last;
+            while (comp(*pivot, *last))
+                --last;
+            if (!(first < last))
+                return (first);
+            _iter_swap(first, last);
+            ++first;
+        }
+    }
+
+    template <class RandomAccessIterator, class Size, class Compare>
+    void _introsort_loop(RandomAccessIterator first, RandomAccessIterator last, Size depth, Compare comp)
+    {
+        while (last - first > sort_threshold)
+        {
+            if (depth == 0)
+            {
+                _heap_sort(first, last, comp);
+                return;
+            }
+            --depth;
+            _move_median_to_first(first, first + 1, first + (last - first) / 2, last - 1, comp);
+            RandomAccessIterator cut = _unguarded_partition(first + 1, last, first, comp);
+            _introsort_loop(cut, last, depth, comp);
+            last = cut;
+        }
+    }
+
+    /**
+     * @brief Merges the sorted ranges [first1, last1) and [first2, last2) into result.
+     * Equal elements are taken from the first range first.
+     */
+    template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+    OutputIterator _merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+                          OutputIterator result, Compare comp)
+    {
+        while (first1 != last1 && first2 != last2)
+        {
+            if (comp(*first2, *first1))
+                *result = *first2++;
+            else
+                *result = *first1++;
+            ++result;
+        }
+        for (; first1 != last1; ++first1, ++result)
+            *result = *first1;
+        for (; first2 != last2; ++first2, ++result)
+            *result = *first2;
+        return (result);
+    }
+
+    /**
+     * @brief Merges every pair of adjacent sorted runs of width elements from src into dst.
+     */
+    template <class InputIterator, class OutputIterator, class Distance, class Compare>
+    void _merge_pass(InputIterator src, Distance len, OutputIterator dst, Distance width, Compare comp)
+    {
+        for (Distance i = 0; i < len; i += 2 * width)
+        {
+            Distance mid = i + width < len ? i + width : len;
+            Distance end = mid + width < len ? mid + width : len;
+            _merge(src + i, src + mid, src + mid, src + end, dst + i, comp);
+        }
+    }
+
+    /**
+     * @brief  Sorts the elements in the range [first,last) into ascending order,
+     * according to comp. Introsort: quicksort with a median-of-three pivot, falling back
+     * to heapsort when the recursion gets deeper than 2 log n, and one insertion sort pass
+     * over the small partitions left. O(n log n) comparisons, not stable.
+     *
+     * @param  first  A random access iterator.
+     * @param  last   A random access iterator.
+     * @param  comp   A binary predicate.
+     */
+    template <class RandomAccessIterator, class Compare>
+    void sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+    {
+        typename iterator_traits<RandomAccessIterator>::difference_type depth = 0;
+        for (typename iterator_traits<RandomAccessIterator>::difference_type n = last - first; n > 1; n >>= 1)
+            depth += 2;
+        _introsort_loop(first, last, depth, comp);
+        _insertion_sort(first, last, comp);
+    }
+
+    /**
+     * @brief  Sorts the elements in the range [first,last) into ascending order.
+     *
+     * @param  first  A random access iterator.
+     * @param  last   A random access iterator.
+     */
+    template <class RandomAccessIterator>
+    void sort(RandomAccessIterator first, RandomAccessIterator last)
+    {
+        ft::sort(first, last, std::less<typename iterator_traits<RandomAccessIterator>::value_type>());
+    }
+
+    /**
+     * @brief  Sorts the elements in the range [first,last) into ascending order, keeping
+     * the relative order of equal elements. Bottom-up merge sort over insertion-sorted
+     * runs, using a temporary buffer of last - first elements.
+     *
+     * @param  first  A random access iterator.
+     * @param  last   A random access iterator.
+     * @param  comp   A binary predicate.
+     */
+    template <class RandomAccessIterator, class Compare>
+    void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+    {
+        typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+        typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+        difference_type len = last - first;
+        difference_type width = 2 * sort_threshold;
+        for (difference_type i = 0; i < len; i += width)
+            _insertion_sort(first + i, i + width < len ? first + i + width : last, comp);
+        if (len <= width)
+            return;
+
+        std::allocator<value_type> alloc;
+        value_type *buffer = alloc.allocate(len);
+        try
+        {
+            std::uninitialized_copy(first, last, buffer);
+        }
+        catch (...)
+        {
+            alloc.deallocate(buffer, len);
+            throw;
+        }
+        try
+        {
+            for (;;)
+            {
+                _merge_pass(first, len, buffer, width, comp);
+                width *= 2;
+                if (width >= len)
+                {
+                    for (difference_type i = 0; i < len; i++)
+                        first[i] = buffer[i];
+                    break;
+                }
+                _merge_pass(buffer, len, first, width, comp);
+                width *= 2;
+                if (width >= len)
+                    break;
+            }
+        }
+        catch (...)
+        {
+            for (difference_type i = 0; i < len; i++)
+                alloc.destroy(buffer + i);
+            alloc.deallocate(buffer, len);
+            throw;
+        }
+        for (difference_type i = 0; i < len; i++)
+            alloc.destroy(buffer + i);
+        alloc.deallocate(buffer, len);
+    }
+
+    /**
+     * @brief  Sorts the elements in the range [first,last) into ascending order, keeping
+     * the relative order of equal elements.
+     *
+     * @param  first  A random access iterator.
+     * @param  last   A random access iterator.
+     */
+    template <class RandomAccessIterator>
+    void stable_sort(RandomAccessIterator first, RandomAccessIterator last)
+    {
+        ft::stable_sort(first, last, std::less<typename iterator_traits<RandomAccessIterator>::value_type>());
+    }
+
+    // PARALLEL SORT ================================================================
+    /*
+     * parallel_sort cuts the range in one chunk per thread and sorts the chunks with
+     * ft::sort, each task also copying its chunk into a buffer of the same size. Sorted
+     * chunks are then merged pairwise, ping-ponging between the range and the buffer.
+     * Every merge is itself cut into pieces along the merge path, so that all the
+     * threads keep working in the last rounds where only one or two merges are left.
+     */
+
+    /**
+     * @brief Below this many elements per thread, parallel_sort just calls ft::sort.
+     */
+    static const ptrdiff_t parallel_sort_grain = 1 << 14;
+
+    template <class RandomAccessIterator, class Compare>
+    struct _sort_chunk_task
+    {
+        typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+
+        RandomAccessIterator first;
+        RandomAccessIterator last;
+        value_type *buffer;
+        Compare *comp;
+        bool copied;
+        task_failure failure;
+
+        _sort_chunk_task() : copied(false) {}
+
+        static void run(void *arg)
+        {
+            _sort_chunk_task *t = static_cast<_sort_chunk_task *>(arg);
+            try
+            {
+                ft::sort(t->first, t->last, *t->comp);
+                std::uninitialized_copy(t->first, t->last, t->buffer);
+                t->copied = true;
+            }
+            catch (...)
+            {
+                t->failure.capture();
+            }
+        }
+    };
+
+    template <class InputIterator, class OutputIterator, class Compare>
+    struct _merge_task
+    {
+        InputIterator first1;
+        InputIterator last1;
+        InputIterator first2;
+        InputIterator last2;
+        OutputIterator result;
+        Compare *comp;
+        task_failure failure;
+
+        static void run(void *arg)
+        {
+            _merge_task *t = static_cast<_merge_task *>(arg);
+            try
+            {
+                _merge(t->first1, t->last1, t->first2, t->last2, t->result, *t->comp);
+            }
+            catch (...)
+            {
+                t->failure.capture();
+            }
+        }
+    };
+
+    /**
+     * @brief Number of elements of a among the first diag elements of merge(a, b), so
+     * that the merge can be cut there and both halves merged independently.
+     */
+    template <class RandomAccessIterator, class Distance, class Compare>
+    Distance _merge_path(RandomAccessIterator a, Distance len_a, RandomAccessIterator b, Distance len_b, Distance diag, Compare &comp)
+    {
+        Distance lo = diag > len_b ? diag - len_b : 0;
+        Distance hi = diag < len_a ? diag : len_a;
+        while (lo < hi)
+        {
+            Distance mid = lo + (hi - lo) / 2;
+            if (comp(b[diag - mid - 1], a[mid]))
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+        return (lo);
+    }
+
+    /**
+     * @brief Merges the sorted chunks of src two by two into dst, chunk i spanning
+     * [bounds[i], bounds[i + 1]) and pairs starting every 2 * width chunks.
+     */
+    template <class InputIterator, class OutputIterator, class Distance, class Compare>
+    void _parallel_merge_round(InputIterator src, OutputIterator dst, const Distance *bounds, size_t chunks, size_t width,
+                               Compare &comp, thread_pool &pool)
+    {
+        typedef _merge_task<InputIterator, OutputIterator, Compare> task_type;
+
+        size_t pairs = (chunks + 2 * width - 1) / (2 * width);
+        size_t pieces = pool.size() > pairs ? pool.size() / pairs : 1;
+        task_type *tasks = new task_type[pairs * pieces];
+        size_t count = 0;
+        for (size_t c = 0; c < chunks; c += 2 * width)
+        {
+            Distance lo = bounds[c];
+            Distance mid = bounds[c + width < chunks ? c + width : chunks];
+            Distance hi = bounds[c + 2 * width < chunks ? c + 2 * width : chunks];
+            Distance prev_diag = 0;
+            Distance prev_i = 0;
+            for (size_t p = 1; p <= pieces; p++)
+            {
+                Distance diag = (hi - lo) * p / pieces;
+                Distance i = _merge_path(src + lo, mid - lo, src + mid, hi - mid, diag, comp);
+                task_type &t = tasks[count++];
+                t.first1 = src + lo + prev_i;
+                t.last1 = src + lo + i;
+                t.first2 = src + mid + (prev_diag - prev_i);
+                t.last2 = src + mid + (diag - i);
+                t.result = dst + lo + prev_diag;
+                t.comp = &comp;
+                pool.submit(task_type::run, &t);
+                prev_diag = diag;
+                prev_i = i;
+            }
+        }
+        pool.wait();
+        task_failure failure;
+        for (size_t i = 0; i < count && !failure.failed(); i++)
+            failure = tasks[i].failure;
+        delete[] tasks;
+        failure.rethrow();
+    }
+
+    /**
+     * @brief  Sorts the elements in the range [first,last) into ascending order on the
+     * threads of pool. Not stable. Uses a temporary buffer of last - first elements.
+     * If comp or a copy throws on a thread, the buffer is freed once every task has
+     * stopped and the failure is thrown again as a task_failure rethrows it; the range
+     * then holds valid elements in an unspecified order.
+     *
+     * @param  first  A random access iterator.
+     * @param  last   A random access iterator.
+     * @param  comp   A binary predicate.
+     * @param  pool   Threads to sort on.
+     */
+    template <class RandomAccessIterator, class Compare>
+    void parallel_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp, thread_pool &pool)
+    {
+        typedef typename iterator_traits<RandomAccessIterator>::value_type value_type;
+        typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+        typedef _sort_chunk_task<RandomAccessIterator, Compare> chunk_task;
+
+        difference_type len = last - first;
+        size_t chunks = pool.size();
+        if (chunks < 2 || len < parallel_sort_grain * static_cast<difference_type>(chunks))
+        {
+            ft::sort(first, last, comp);
+            return;
+        }
+
+        std::allocator<value_type> alloc;
+        value_type *buffer = alloc.allocate(len);
+        difference_type *bounds = new difference_type[chunks + 1];
+        chunk_task *tasks = new chunk_task[chunks];
+        for (size_t c = 0; c <= chunks; c++)
+            bounds[c] = len * c / chunks;
+        for (size_t c = 0; c < chunks; c++)
+        {
+            tasks[c].first = first + bounds[c];
+            tasks[c].last = first + bounds[c + 1];
+            tasks[c].buffer = buffer + bounds[c];
+            tasks[c].comp = &comp;
+            pool.submit(chunk_task::run, &tasks[c]);
+        }
+        pool.wait();
+        task_failure failure;
+        for (size_t c = 0; c < chunks && !failure.failed(); c++)
+            failure = tasks[c].failure;
+        if (failure.failed())
+        {
+            for (size_t c = 0; c < chunks; c++)
+                if (tasks[c].copied)
+                    for (difference_type i = bounds[c]; i < bounds[c + 1]; i++)
+                        alloc.destroy(buffer + i);
+            delete[] tasks;
+            delete[] bounds;
+            alloc.deallocate(buffer, len);
+            failure.rethrow();
+        }
+        delete[] tasks;
+
+        // The range and the buffer both hold the sorted chunks: start from whichever
+        // makes the last round write into the range.
+        size_t rounds = 0;
+        for (size_t width = 1; width < chunks; width *= 2)
+            rounds++;
+        bool from_buffer = rounds % 2;
+        try
+        {
+            for (size_t width = 1; width < chunks; width *= 2, from_buffer = !from_buffer)
+            {
+                if (from_buffer)
+                    _parallel_merge_round(buffer, first, bounds, chunks, width, comp, pool);
+                else
+                    _parallel_merge_round(first, buffer, bounds, chunks, width, comp, pool);
+            }
+        }
+        catch (...)
+        {
+            delete[] bounds;
+            for (difference_type i = 0; i < len; i++)
+                alloc.destroy(buffer + i);
+            alloc.deallocate(buffer, len);
+            throw;
+        }
+
+        delete[] bounds;
+        for (difference_type i = 0; i < len; i++)
+            alloc.destroy(buffer + i);
+        alloc.deallocate(buffer, len);
+    }
+
+    /**
+     * @brief  Sorts the elements in the range [first,last) into ascending order on a
+     * temporary pool with one thread per core.
+     *
+     * @param  first  A random access iterator.
+     * @param  last   A random access iterator.
+     * @param  comp   A binary predicate.
+     */
+    template <class RandomAccessIterator, class Compare>
+    void parallel_sort(RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+    {
+        if (last - first < parallel_sort_grain * 2)
+        {
+            ft::sort(first, last, comp);
+            return;
+        }
+        thread_pool pool;
+        ft::parallel_sort(first, last, comp, pool);
+    }
+
+    /**
+     * @brief  Sorts the elements in the range [first,last) into ascending order on a
+     * temporary pool with one thread per core.
+     *
+     * @param  first  A random access iterator.
+     * @param  last   A random access iterator.
+     */
+    template <class RandomAccessIterator>
+    void parallel_sort(RandomAccessIterator first, RandomAccessIterator last)
+    {
+        ft::parallel_sort(first, last, std::less<typename iterator_traits<RandomAccessIterator>::value_type>());
+    }
+
+    // SET OPERATIONS ===============================================================
+    /*
+     * Single pass over two ranges sorted by comp: O(n + m) comparisons, whereas looking
+     * every element of one range up in a tree built from the other costs O(m log n).
+     * When an element is in both ranges, the one from [first1, last1) is kept.
+     */
+
+    /**
+     * @brief  Merges the sorted ranges [first1,last1) and [first2,last2) into result,
+     * keeping equal elements in order, those of the first range first.
+     *
+     * @return  The end of the output range.
+     */
+    template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+    OutputIterator merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+                         OutputIterator result, Compare comp)
+    {
+        return (_merge(first1, last1, first2, last2, result, comp));
+    }
+
+    template <class InputIterator1, class InputIterator2, class OutputIterator>
+    OutputIterator merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+                         OutputIterator result)
+    {
+        return (_merge(first1, last1, first2, last2, result,
+                       std::less<typename iterator_traits<InputIterator1>::value_type>()));
+    }
+
+    /**
+     * @brief  Copies to result the elements found in either sorted range, once when
+     * they are in both.
+     *
+     * @return  The end of the output range.
+     */
+    template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+    OutputIterator set_union(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+                             OutputIterator result, Compare comp)
+    {
+        while (first1 != last1 && first2 != last2)
+        {
+            if (comp(*first1, *first2))
+                *result = *first1++;
+            else if (comp(*first2, *first1))
+                *result = *first2++;
+            else
+            {
+                *result = *first1++;
+                ++first2;
+            }
+            ++result;
+        }
+        for (; first1 != last1; ++first1, ++result)
+            *result = *first1;
+        for (; first2 != last2; ++first2, ++result)
+            *result = *first2;
+        return (result);
+    }
+
+    template <class InputIterator1, class InputIterator2, class OutputIterator>
+    OutputIterator set_union(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+                             OutputIterator result)
+    {
+        return (ft::set_union(first1, last1, first2, last2, result,
+                              std::less<typename iterator_traits<InputIterator1>::value_type>()));
+    }
+
+    /**
+     * @brief  Copies to result the elements of [first1,last1) also found in
+     * [first2,last2).
+     *
+     * @return  The end of the output range.
+     */
+    template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+    OutputIterator set_intersection(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                                    InputIterator2 last2, OutputIterator result, Compare comp)
+    {
+        while (first1 != last1 && first2 != last2)
+        {
+            if (comp(*first1, *first2))
+                ++first1;
+            else if (comp(*first2, *first1))
+                ++first2;
+            else
+            {
+                *result = *first1++;
+                ++first2;
+                ++result;
+            }
+        }
+        return (result);
+    }
+
+    template <class InputIterator1, class InputIterator2, class OutputIterator>
+    OutputIterator set_intersection(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                                    InputIterator2 last2, OutputIterator result)
+    {
+        return (ft::set_intersection(first1, last1, first2, last2, result,
+                                     std::less<typename iterator_traits<InputIterator1>::value_type>()));
+    }
+
+    /**
+     * @brief  Copies to result the elements of [first1,last1) not found in
+     * [first2,last2).
+     *
+     * @return  The end of the output range.
+     */
+    template <class InputIterator1, class InputIterator2, class OutputIterator, class Compare>
+    OutputIterator set_difference(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                                  InputIterator2 last2, OutputIterator result, Compare comp)
+    {
+        while (first1 != last1 && first2 != last2)
+        {
+            if (comp(*first1, *first2))
+            {
+                *result = *first1++;
+                ++result;
+            }
+            else
+            {
+                if (!comp(*first2, *first1))
+                    ++first1;
+                ++first2;
+            }
+        }
+        for (; first1 != last1; ++first1, ++result)
+            *result = *first1;
+        return (result);
+    }
+
+    template <class InputIterator1, class InputIterator2, class OutputIterator>
+    OutputIterator set_difference(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+                                  InputIterator2 last2, OutputIterator result)
+    {
+        return (ft::set_difference(first1, last1, first2, last2, result,
+                                   std::less<typename iterator_traits<InputIterator1>::value_type>()));
+    }
 }
 
 #endif // ********************************************** ALGORITHM_HPP end //
\ No newline at end of file
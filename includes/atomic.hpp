@@ -0,0 +1,127 @@
+#ifndef ATOMIC_HPP
+#define ATOMIC_HPP
+
+#include <cstddef>
+
+/**
+ * @brief Size of a cache line on the targets we build for. Used to pad shared
+ * counters so that two cores writing different counters never share a line.
+ */
+#define FT_CACHE_LINE_SIZE 64
+
+namespace ft
+{
+    // memory_order =================================================================
+    /*
+     * Same orderings as the C++11 memory model. The values map directly to the
+     * GCC/Clang __atomic builtins, which are available in C++98 mode.
+     */
+    enum memory_order
+    {
+        memory_order_relaxed = __ATOMIC_RELAXED,
+        memory_order_consume = __ATOMIC_CONSUME,
+        memory_order_acquire = __ATOMIC_ACQUIRE,
+        memory_order_release = __ATOMIC_RELEASE,
+        memory_order_acq_rel = __ATOMIC_ACQ_REL,
+        memory_order_seq_cst = __ATOMIC_SEQ_CST
+    };
+
+    // atomic =======================================================================
+
+    /**
+     * @brief Minimal atomic wrapper for integral and pointer types, modeled after std::atomic.
+     *
+     * @tparam T An integral or pointer type.
+     */
+    template <typename T>
+    class atomic
+    {
+    public:
+        typedef T value_type;
+
+        atomic() : _value() {}
+
+        explicit atomic(value_type val) : _value(val) {}
+
+        /**
+         * @brief Atomically reads the stored value.
+         *
+         */
+        value_type load(memory_order order = memory_order_seq_cst) const
+        {
+            return __atomic_load_n(&_value, order);
+        }
+
+        /**
+         * @brief Atomically replaces the stored value with val.
+         *
+         */
+        void store(value_type val, memory_order order = memory_order_seq_cst)
+        {
+            __atomic_store_n(&_value, val, order);
+        }
+
+        /**
+         * @brief Atomically replaces the stored value with val and returns the previous one.
+         *
+         */
+        value_type exchange(value_type val, memory_order order = memory_order_seq_cst)
+        {
+            return __atomic_exchange_n(&_value, val, order);
+        }
+
+        /**
+         * @brief Stores desired if the current value equals expected, otherwise loads the
+         * current value into expected. Returns true on success.
+         *
+         */
+        bool compare_exchange_strong(value_type &expected, value_type desired, memory_order order = memory_order_seq_cst)
+        {
+            return __atomic_compare_exchange_n(&_value, &expected, desired, false, order, _failure_order(order));
+        }
+
+        /**
+         * @brief Same as compare_exchange_strong, but may fail spuriously. Meant for retry loops.
+         *
+         */
+        bool compare_exchange_weak(value_type &expected, value_type desired, memory_order order = memory_order_seq_cst)
+        {
+            return __atomic_compare_exchange_n(&_value, &expected, desired, true, order, _failure_order(order));
+        }
+
+        /**
+         * @brief Atomically adds val to the stored value and returns the previous one.
+         *
+         */
+        value_type fetch_add(value_type val, memory_order order = memory_order_seq_cst)
+        {
+            return __atomic_fetch_add(&_value, val, order);
+        }
+
+        /**
+         * @brief Atomically subtracts val from the stored value and returns the previous one.
+         *
+         */
+        value_type fetch_sub(value_type val, memory_order order = memory_order_seq_cst)
+        {
+            return __atomic_fetch_sub(&_value, val, order);
+        }
+
+    private:
+        value_type _value;
+
+        atomic(const atomic &);
+        atomic &operator=(const atomic &);
+
+        static int _failure_order(memory_order order)
+        {
+            if (order == memory_order_acq_rel)
+                return memory_order_acquire;
+            if (order == memory_order_release)
+                return memory_order_relaxed;
+            return order;
+        }
+    };
+} // namespace ft
+
+#endif // ********************************************** ATOMIC_HPP end //
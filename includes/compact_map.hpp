@@ -0,0 +1,517 @@
+#ifndef COMPACT_MAP_HPP
+#define COMPACT_MAP_HPP
+
+// LIBS ========================================================================
+#include <memory>
+#include <functional>
+#include <cstddef>
+#include <new>
+#include "./pair.hpp"
+#include "./vector.hpp"
+#include "./algorithm.hpp"
+#include "./reverse_iterator.hpp"
+#include "./iterator_traits.hpp"
+
+namespace ft
+{
+    // NODE ========================================================================
+
+    /**
+     * @brief Slot of the arena of an ft::compact_map: a red-black node linked to its
+     * neighbours by their index in the arena. The element is built in place only while
+     * the slot is in use; a free slot holds no value and chains the free list through
+     * left.
+     *
+     * @tparam T
+     */
+    template <typename T>
+    struct compact_map_node
+    {
+        typedef T value_type;
+        typedef unsigned int index_type;
+
+        /**
+         * @brief Index of no slot: missing child, parent of the root, end().
+         */
+        static const index_type null_index = ~0u;
+
+        enum slot_state
+        {
+            free_slot,
+            black_node,
+            red_node
+        };
+
+        index_type left;
+        index_type right;
+        index_type parent;
+        index_type state;
+
+        compact_map_node() : left(null_index), right(null_index), parent(null_index), state(free_slot) {}
+
+        compact_map_node(const compact_map_node &other)
+            : left(other.left), right(other.right), parent(other.parent), state(other.state)
+        {
+            if (state != free_slot)
+                ::new (_address()) value_type(other.value());
+        }
+
+        ~compact_map_node()
+        {
+            if (state != free_slot)
+                value().~value_type();
+        }
+
+        value_type &value() { return *static_cast<value_type *>(_address()); }
+        const value_type &value() const { return *static_cast<const value_type *>(_address()); }
+
+        /**
+         * @brief Builds val in a free slot, which becomes a detached red node.
+         *
+         */
+        void fill(const value_type &val)
+        {
+            ::new (_address()) value_type(val);
+            left = null_index;
+            right = null_index;
+            parent = null_index;
+            state = red_node;
+        }
+
+        /**
+         * @brief Destroys the element, the slot becoming free.
+         *
+         */
+        void release()
+        {
+            value().~value_type();
+            state = free_slot;
+        }
+
+    private:
+        struct _align_probe
+        {
+            char c;
+            value_type value;
+        };
+
+        /**
+         * @brief Room for one element, aligned like the members of the union: enough for
+         * any type aligned on 8 bytes or less, which the typedef below checks.
+         */
+        union _storage_type
+        {
+            char bytes[sizeof(value_type)];
+            double d;
+            long long ll;
+            void *p;
+        };
+
+        typedef char _alignment_check[sizeof(_align_probe) - sizeof(value_type) <= 8 ? 1 : -1];
+
+        _storage_type _storage;
+
+        void *_address() { return _storage.bytes; }
+        const void *_address() const { return _storage.bytes; }
+
+        compact_map_node &operator=(const compact_map_node &);
+    };
+
+    // ITERATORS ===================================================================
+
+    /**
+     * @brief Bidirectional iterator over an ft::compact_map: the map and the index of a
+     * slot, null_index for end(). Indices do not move when the arena grows, so iterators
+     * stay valid across insertions.
+     *
+     */
+    template <class Map>
+    class compact_map_iterator : public ft::iterator<ft::bidirectional_iterator_tag, typename Map::value_type>
+    {
+    public:
+        typedef typename Map::value_type value_type;
+        typedef value_type *pointer;
+        typedef value_type &reference;
+        typedef ptrdiff_t difference_type;
+        typedef ft::bidirectional_iterator_tag iterator_category;
+        typedef typename Map::index_type index_type;
+
+        Map *_map;
+        index_type _index;
+
+        compact_map_iterator() : _map(NULL), _index(Map::null_index) {}
+
+        compact_map_iterator(Map *map, index_type index) : _map(map), _index(index) {}
+
+        reference operator*() const { return _map->_nodes[_index].value(); }
+
+        pointer operator->() const { return &_map->_nodes[_index].value(); }
+
+        compact_map_iterator &operator++()
+        {
+            _index = _map->_next(_index);
+            return *this;
+        }
+
+        compact_map_iterator operator++(int)
+        {
+            compact_map_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        compact_map_iterator &operator--()
+        {
+            _index = _map->_prev(_index);
+            return *this;
+        }
+
+        compact_map_iterator operator--(int)
+        {
+            compact_map_iterator tmp(*this);
+            --(*this);
+            return tmp;
+        }
+
+        bool operator==(const compact_map_iterator &other) const { return _index == other._index; }
+
+        bool operator!=(const compact_map_iterator &other) const { return _index != other._index; }
+    };
+
+    template <class Map>
+    class compact_map_const_iterator : public ft::iterator<ft::bidirectional_iterator_tag, typename Map::value_type, ptrdiff_t, const typename Map::value_type *, const typename Map::value_type &>
+    {
+    public:
+        typedef typename Map::value_type value_type;
+        typedef const value_type *pointer;
+        typedef const value_type &reference;
+        typedef ptrdiff_t difference_type;
+        typedef ft::bidirectional_iterator_tag iterator_category;
+        typedef typename Map::index_type index_type;
+
+        const Map *_map;
+        index_type _index;
+
+        compact_map_const_iterator() : _map(NULL), _index(Map::null_index) {}
+
+        compact_map_const_iterator(const Map *map, index_type index) : _map(map), _index(index) {}
+
+        compact_map_const_iterator(const compact_map_iterator<Map> &other) : _map(other._map), _index(other._index) {}
+
+        reference operator*() const { return _map->_nodes[_index].value(); }
+
+        pointer operator->() const { return &_map->_nodes[_index].value(); }
+
+        compact_map_const_iterator &operator++()
+        {
+            _index = _map->_next(_index);
+            return *this;
+        }
+
+        compact_map_const_iterator operator++(int)
+        {
+            compact_map_const_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        compact_map_const_iterator &operator--()
+        {
+            _index = _map->_prev(_index);
+            return *this;
+        }
+
+        compact_map_const_iterator operator--(int)
+        {
+            compact_map_const_iterator tmp(*this);
+            --(*this);
+            return tmp;
+        }
+
+        bool operator==(const compact_map_const_iterator &other) const { return _index == other._index; }
+
+        bool operator!=(const compact_map_const_iterator &other) const { return _index != other._index; }
+    };
+
+    template <class Map>
+    bool operator==(const compact_map_iterator<Map> &lhs, const compact_map_const_iterator<Map> &rhs)
+    {
+        return (lhs._index == rhs._index);
+    }
+
+    template <class Map>
+    bool operator!=(const compact_map_iterator<Map> &lhs, const compact_map_const_iterator<Map> &rhs)
+    {
+        return (lhs._index != rhs._index);
+    }
+
+    // CLASS =======================================================================
+
+    /**
+     * @brief Ordered map whose red-black tree lives in one ft::vector of slots, linked by
+     * 32-bit indices instead of pointers.
+     *
+     * A node costs 16 bytes of links and color next to its element, against 40 for
+     * ft::map, and nodes sit side by side in one buffer: copying a map is one allocation
+     * and a pass over the buffer, with no relinking. Erased slots go on a free list and
+     * are reused by the next insertions; clear() keeps the buffer, like vector::clear.
+     *
+     * Iterators are indices, so they survive insertions. References and pointers to
+     * elements do not survive an insertion that grows the buffer: reserve() first when
+     * they must. A map holds at most 2^32 - 1 elements.
+     *
+     * @tparam Key Key type.
+     * @tparam T Mapped type.
+     * @tparam Compare Strict weak ordering of keys.
+     * @tparam Alloc Allocator, rebound to slots.
+     */
+    template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+    class compact_map
+    {
+    public:
+        // MEMBER TYPES ========================================================
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef ft::pair<const key_type, mapped_type> value_type;
+        typedef Compare key_compare;
+        typedef Alloc allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef typename allocator_type::size_type size_type;
+        typedef typename allocator_type::difference_type difference_type;
+
+    private:
+        typedef compact_map_node<value_type> node_type;
+        typedef typename allocator_type::template rebind<node_type>::other node_allocator_type;
+        typedef ft::vector<node_type, node_allocator_type> arena_type;
+
+    public:
+        typedef typename node_type::index_type index_type;
+
+        static const index_type null_index = node_type::null_index;
+
+        // MEMBER CLASSES ======================================================
+
+        class value_compare : public std::binary_function<value_type, value_type, bool>
+        {
+            friend class compact_map;
+
+        protected:
+            Compare comp;
+            explicit value_compare(Compare c) : comp(c) {}
+
+        public:
+            bool operator()(const value_type &x, const value_type &y) const
+            {
+                return comp(x.first, y.first);
+            }
+        };
+
+        // ITERATORS ===========================================================
+        typedef compact_map_iterator<compact_map> iterator;
+        typedef compact_map_const_iterator<compact_map> const_iterator;
+        typedef ft::reverse_iterator<iterator> reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+        friend class compact_map_iterator<compact_map>;
+        friend class compact_map_const_iterator<compact_map>;
+
+    private:
+        // ATTRIBUTES ==========================================================
+        arena_type _nodes;
+        index_type _root;
+        index_type _free;
+        size_type _size;
+        key_compare _comp;
+
+    public:
+        // MEMBER FUNCTIONS ====================================================
+
+        /**
+         * @brief Constructs an empty map. Allocates nothing.
+         *
+         */
+        explicit compact_map(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+
+        /**
+         * @brief Constructs a map with the elements of [first,last).
+         *
+         */
+        template <class InputIterator>
+        compact_map(InputIterator first, InputIterator last, const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+
+        /**
+         * @brief Copies x slot by slot into one buffer: links are indices, nothing is
+         * relinked.
+         *
+         */
+        compact_map(const compact_map &x);
+
+        ~compact_map();
+
+        compact_map &operator=(const compact_map &x);
+
+        // ITERATORS ===========================================================
+
+        iterator begin();
+        const_iterator begin() const;
+        iterator end();
+        const_iterator end() const;
+        reverse_iterator rbegin();
+        const_reverse_iterator rbegin() const;
+        reverse_iterator rend();
+        const_reverse_iterator rend() const;
+
+        // CAPACITY ============================================================
+
+        bool empty() const;
+        size_type size() const;
+
+        /**
+         * @brief Returns the maximum number of elements, bounded by the 32-bit indices.
+         *
+         */
+        size_type max_size() const;
+
+        /**
+         * @brief Returns the number of slots the buffer holds without growing, free slots
+         * included.
+         *
+         */
+        size_type capacity() const;
+
+        /**
+         * @brief Grows the buffer to hold n slots, so that the next insertions up to n
+         * slots keep references to elements valid. Throws std::length_error past
+         * max_size().
+         *
+         */
+        void reserve(size_type n);
+
+        // ELEMENT ACCESS ======================================================
+
+        /**
+         * @brief Returns a reference to the mapped value of k, inserting a value
+         * initialized one when k is missing.
+         *
+         */
+        mapped_type &operator[](const key_type &k);
+
+        // MODIFIERS ===========================================================
+
+        /**
+         * @brief Inserts val unless its key is already in the map. Reuses a free slot when
+         * there is one.
+         *
+         */
+        ft::pair<iterator, bool> insert(const value_type &val);
+
+        iterator insert(iterator position, const value_type &val);
+
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last);
+
+        /**
+         * @brief Erases the element at position; its slot goes on the free list. Other
+         * iterators stay valid.
+         *
+         */
+        void erase(iterator position);
+
+        size_type erase(const key_type &k);
+
+        void erase(iterator first, iterator last);
+
+        /**
+         * @brief Exchanges the contents of two maps. Iterators keep referring to the map
+         * object they were taken from, not to the elements.
+         *
+         */
+        void swap(compact_map &x);
+
+        /**
+         * @brief Removes every element, keeping the buffer for the next insertions.
+         *
+         */
+        void clear();
+
+        // OBSERVERS ===========================================================
+
+        key_compare key_comp() const;
+        value_compare value_comp() const;
+
+        // OPERATIONS ==========================================================
+
+        iterator find(const key_type &k);
+        const_iterator find(const key_type &k) const;
+        size_type count(const key_type &k) const;
+        iterator lower_bound(const key_type &k);
+        const_iterator lower_bound(const key_type &k) const;
+        iterator upper_bound(const key_type &k);
+        const_iterator upper_bound(const key_type &k) const;
+        ft::pair<iterator, iterator> equal_range(const key_type &k);
+        ft::pair<const_iterator, const_iterator> equal_range(const key_type &k) const;
+
+        // ALLOCATOR ===========================================================
+
+        allocator_type get_allocator() const;
+
+    private:
+        // SLOTS ===============================================================
+
+        index_type _allocate(const value_type &val);
+        void _release(index_type i);
+
+        // TREE ================================================================
+
+        const key_type &_key(index_type i) const { return _nodes[i].value().first; }
+
+        bool _is_red(index_type i) const { return i != null_index && _nodes[i].state == node_type::red_node; }
+
+        void _set_red(index_type i, bool red) { _nodes[i].state = red ? node_type::red_node : node_type::black_node; }
+
+        index_type _lowest(index_type i) const;
+        index_type _highest(index_type i) const;
+        index_type _next(index_type i) const;
+        index_type _prev(index_type i) const;
+        index_type _lower_bound(const key_type &k) const;
+        index_type _upper_bound(const key_type &k) const;
+        index_type _find(const key_type &k) const;
+
+        void _transplant(index_type node, index_type replacement);
+        void _rotate_left(index_type node);
+        void _rotate_right(index_type node);
+        void _insert_fixup(index_type node);
+        void _unlink(index_type node);
+        void _erase_fixup(index_type node, index_type parent);
+    };
+
+    // NON MEMBER FUNCTIONS ==========================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator==(const compact_map<Key, T, Compare, Alloc> &lhs, const compact_map<Key, T, Compare, Alloc> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator!=(const compact_map<Key, T, Compare, Alloc> &lhs, const compact_map<Key, T, Compare, Alloc> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator<(const compact_map<Key, T, Compare, Alloc> &lhs, const compact_map<Key, T, Compare, Alloc> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator<=(const compact_map<Key, T, Compare, Alloc> &lhs, const compact_map<Key, T, Compare, Alloc> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator>(const compact_map<Key, T, Compare, Alloc> &lhs, const compact_map<Key, T, Compare, Alloc> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator>=(const compact_map<Key, T, Compare, Alloc> &lhs, const compact_map<Key, T, Compare, Alloc> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc>
+    void swap(compact_map<Key, T, Compare, Alloc> &x, compact_map<Key, T, Compare, Alloc> &y);
+} // namespace ft
+
+#include "./compact_map.tpp"
+
+#endif // ********************************************** COMPACT_MAP_HPP end //
@@ -0,0 +1,731 @@
+#ifndef COMPACT_MAP_TPP
+#define COMPACT_MAP_TPP
+
+#include <stdexcept>
+#include "compact_map.hpp"
+
+namespace ft
+{
+    // CONSTRUCTORS =================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    compact_map<Key, T, Compare, Alloc>::compact_map(const key_compare &comp, const allocator_type &alloc)
+        : _nodes(node_allocator_type(alloc)), _root(null_index), _free(null_index), _size(0), _comp(comp){};
+
+    template <class Key, class T, class Compare, class Alloc>
+    template <class InputIterator>
+    compact_map<Key, T, Compare, Alloc>::compact_map(InputIterator first, InputIterator last, const key_compare &comp, const allocator_type &alloc)
+        : _nodes(node_allocator_type(alloc)), _root(null_index), _free(null_index), _size(0), _comp(comp)
+    {
+        insert(first, last);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    compact_map<Key, T, Compare, Alloc>::compact_map(const compact_map &x)
+        : _nodes(x._nodes), _root(x._root), _free(x._free), _size(x._size), _comp(x._comp){};
+
+    // DESTRUCTOR ==================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    compact_map<Key, T, Compare, Alloc>::~compact_map(){};
+
+    template <class Key, class T, class Compare, class Alloc>
+    compact_map<Key, T, Compare, Alloc> &compact_map<Key, T, Compare, Alloc>::operator=(const compact_map &x)
+    {
+        if (this != &x)
+        {
+            compact_map copy(x);
+            swap(copy);
+        }
+        return (*this);
+    };
+
+    // ITERATORS ====================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::iterator compact_map<Key, T, Compare, Alloc>::begin()
+    {
+        return (iterator(this, _lowest(_root)));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::const_iterator compact_map<Key, T, Compare, Alloc>::begin() const
+    {
+        return (const_iterator(this, _lowest(_root)));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::iterator compact_map<Key, T, Compare, Alloc>::end()
+    {
+        return (iterator(this, null_index));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::const_iterator compact_map<Key, T, Compare, Alloc>::end() const
+    {
+        return (const_iterator(this, null_index));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::reverse_iterator compact_map<Key, T, Compare, Alloc>::rbegin()
+    {
+        return (reverse_iterator(end()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::const_reverse_iterator compact_map<Key, T, Compare, Alloc>::rbegin() const
+    {
+        return (const_reverse_iterator(end()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::reverse_iterator compact_map<Key, T, Compare, Alloc>::rend()
+    {
+        return (reverse_iterator(begin()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::const_reverse_iterator compact_map<Key, T, Compare, Alloc>::rend() const
+    {
+        return (const_reverse_iterator(begin()));
+    };
+
+    // CAPACITY =====================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool compact_map<Key, T, Compare, Alloc>::empty() const
+    {
+        return (_size == 0);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::size_type compact_map<Key, T, Compare, Alloc>::size() const
+    {
+        return (_size);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::size_type compact_map<Key, T, Compare, Alloc>::max_size() const
+    {
+        size_type slots = _nodes.max_size();
+        return (slots < null_index ? slots : null_index);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::size_type compact_map<Key, T, Compare, Alloc>::capacity() const
+    {
+        return (_nodes.capacity());
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    void compact_map<Key, T, Compare, Alloc>::reserve(size_type n)
+    {
+        if (n > max_size())
+            throw std::length_error("compact_map::reserve");
+        _nodes.reserve(n);
+    };
+
+    // ELEMENT ACCESS ===============================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::mapped_type &compact_map<Key, T, Compare, Alloc>::operator[](const key_type &k)
+    {
+        return (insert(value_type(k, mapped_type())).first->second);
+    };
+
+    // MODIFIERS ====================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    ft::pair<typename compact_map<Key, T, Compare, Alloc>::iterator, bool> compact_map<Key, T, Compare, Alloc>::insert(const value_type &val)
+    {
+        index_type parent = null_index;
+        bool left = true;
+        for (index_type i = _root; i != null_index;)
+        {
+            parent = i;
+            if (_comp(val.first, _key(i)))
+            {
+                left = true;
+                i = _nodes[i].left;
+            }
+            else if (_comp(_key(i), val.first))
+            {
+                left = false;
+                i = _nodes[i].right;
+            }
+            else
+                return (ft::make_pair(iterator(this, i), false));
+        }
+        index_type node = _allocate(val);
+        _nodes[node].parent = parent;
+        if (parent == null_index)
+            _root = node;
+        else if (left)
+            _nodes[parent].left = node;
+        else
+            _nodes[parent].right = node;
+        _size++;
+        _insert_fixup(node);
+        return (ft::make_pair(iterator(this, node), true));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::iterator compact_map<Key, T, Compare, Alloc>::insert(iterator position, const value_type &val)
+    {
+        (void)position;
+        return (insert(val).first);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    template <class InputIterator>
+    void compact_map<Key, T, Compare, Alloc>::insert(InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+            insert(*first);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    void compact_map<Key, T, Compare, Alloc>::erase(iterator position)
+    {
+        _unlink(position._index);
+        _release(position._index);
+        _size--;
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::size_type compact_map<Key, T, Compare, Alloc>::erase(const key_type &k)
+    {
+        index_type i = _find(k);
+        if (i == null_index)
+            return (0);
+        erase(iterator(this, i));
+        return (1);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    void compact_map<Key, T, Compare, Alloc>::erase(iterator first, iterator last)
+    {
+        if (first == begin() && last == end())
+        {
+            clear();
+            return;
+        }
+        while (first != last)
+            erase(first++);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    void compact_map<Key, T, Compare, Alloc>::swap(compact_map &x)
+    {
+        index_type tmp_root = _root;
+        index_type tmp_free = _free;
+        size_type tmp_size = _size;
+        key_compare tmp_comp = _comp;
+
+        _nodes.swap(x._nodes);
+        _root = x._root;
+        _free = x._free;
+        _size = x._size;
+        _comp = x._comp;
+
+        x._root = tmp_root;
+        x._free = tmp_free;
+        x._size = tmp_size;
+        x._comp = tmp_comp;
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    void compact_map<Key, T, Compare, Alloc>::clear()
+    {
+        _nodes.clear();
+        _root = null_index;
+        _free = null_index;
+        _size = 0;
+    };
+
+    // OBSERVERS ====================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::key_compare compact_map<Key, T, Compare, Alloc>::key_comp() const
+    {
+        return (_comp);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::value_compare compact_map<Key, T, Compare, Alloc>::value_comp() const
+    {
+        return (value_compare(_comp));
+    };
+
+    // OPERATIONS ===================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::iterator compact_map<Key, T, Compare, Alloc>::find(const key_type &k)
+    {
+        return (iterator(this, _find(k)));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::const_iterator compact_map<Key, T, Compare, Alloc>::find(const key_type &k) const
+    {
+        return (const_iterator(this, _find(k)));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::size_type compact_map<Key, T, Compare, Alloc>::count(const key_type &k) const
+    {
+        return (_find(k) != null_index);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::iterator compact_map<Key, T, Compare, Alloc>::lower_bound(const key_type &k)
+    {
+        return (iterator(this, _lower_bound(k)));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::const_iterator compact_map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) const
+    {
+        return (const_iterator(this, _lower_bound(k)));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::iterator compact_map<Key, T, Compare, Alloc>::upper_bound(const key_type &k)
+    {
+        return (iterator(this, _upper_bound(k)));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::const_iterator compact_map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) const
+    {
+        return (const_iterator(this, _upper_bound(k)));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    ft::pair<typename compact_map<Key, T, Compare, Alloc>::iterator, typename compact_map<Key, T, Compare, Alloc>::iterator>
+    compact_map<Key, T, Compare, Alloc>::equal_range(const key_type &k)
+    {
+        return (ft::make_pair(lower_bound(k), upper_bound(k)));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    ft::pair<typename compact_map<Key, T, Compare, Alloc>::const_iterator, typename compact_map<Key, T, Compare, Alloc>::const_iterator>
+    compact_map<Key, T, Compare, Alloc>::equal_range(const key_type &k) const
+    {
+        return (ft::make_pair(lower_bound(k), upper_bound(k)));
+    };
+
+    // ALLOCATOR ====================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::allocator_type compact_map<Key, T, Compare, Alloc>::get_allocator() const
+    {
+        return (allocator_type(_nodes.get_allocator()));
+    };
+
+    // SLOTS ========================================================================
+
+    /**
+     * @brief Builds val in the first free slot, or in a new slot at the end of the
+     * buffer, which may grow it.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::index_type compact_map<Key, T, Compare, Alloc>::_allocate(const value_type &val)
+    {
+        if (_free != null_index)
+        {
+            index_type i = _free;
+            _free = _nodes[i].left;
+            try
+            {
+                _nodes[i].fill(val);
+            }
+            catch (...)
+            {
+                _nodes[i].left = _free;
+                _free = i;
+                throw;
+            }
+            return (i);
+        }
+        if (_nodes.size() >= max_size())
+            throw std::length_error("compact_map");
+        _nodes.push_back(node_type());
+        index_type i = static_cast<index_type>(_nodes.size() - 1);
+        try
+        {
+            _nodes[i].fill(val);
+        }
+        catch (...)
+        {
+            _nodes.pop_back();
+            throw;
+        }
+        return (i);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    void compact_map<Key, T, Compare, Alloc>::_release(index_type i)
+    {
+        _nodes[i].release();
+        _nodes[i].left = _free;
+        _free = i;
+    };
+
+    // TREE =========================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::index_type compact_map<Key, T, Compare, Alloc>::_lowest(index_type i) const
+    {
+        if (i == null_index)
+            return (null_index);
+        while (_nodes[i].left != null_index)
+            i = _nodes[i].left;
+        return (i);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::index_type compact_map<Key, T, Compare, Alloc>::_highest(index_type i) const
+    {
+        if (i == null_index)
+            return (null_index);
+        while (_nodes[i].right != null_index)
+            i = _nodes[i].right;
+        return (i);
+    };
+
+    /**
+     * @brief Next slot in key order, null_index after the highest.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::index_type compact_map<Key, T, Compare, Alloc>::_next(index_type i) const
+    {
+        if (_nodes[i].right != null_index)
+            return (_lowest(_nodes[i].right));
+        index_type parent = _nodes[i].parent;
+        while (parent != null_index && i == _nodes[parent].right)
+        {
+            i = parent;
+            parent = _nodes[parent].parent;
+        }
+        return (parent);
+    };
+
+    /**
+     * @brief Previous slot in key order; from null_index, the highest.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::index_type compact_map<Key, T, Compare, Alloc>::_prev(index_type i) const
+    {
+        if (i == null_index)
+            return (_highest(_root));
+        if (_nodes[i].left != null_index)
+            return (_highest(_nodes[i].left));
+        index_type parent = _nodes[i].parent;
+        while (parent != null_index && i == _nodes[parent].left)
+        {
+            i = parent;
+            parent = _nodes[parent].parent;
+        }
+        return (parent);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::index_type compact_map<Key, T, Compare, Alloc>::_lower_bound(const key_type &k) const
+    {
+        index_type result = null_index;
+        for (index_type i = _root; i != null_index;)
+        {
+            if (_comp(_key(i), k))
+                i = _nodes[i].right;
+            else
+            {
+                result = i;
+                i = _nodes[i].left;
+            }
+        }
+        return (result);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::index_type compact_map<Key, T, Compare, Alloc>::_upper_bound(const key_type &k) const
+    {
+        index_type result = null_index;
+        for (index_type i = _root; i != null_index;)
+        {
+            if (_comp(k, _key(i)))
+            {
+                result = i;
+                i = _nodes[i].left;
+            }
+            else
+                i = _nodes[i].right;
+        }
+        return (result);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename compact_map<Key, T, Compare, Alloc>::index_type compact_map<Key, T, Compare, Alloc>::_find(const key_type &k) const
+    {
+        index_type i = _lower_bound(k);
+        if (i == null_index || _comp(k, _key(i)))
+            return (null_index);
+        return (i);
+    };
+
+    /**
+     * @brief Put replacement, which may be null_index, where node hangs from its parent.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc>
+    void compact_map<Key, T, Compare, Alloc>::_transplant(index_type node, index_type replacement)
+    {
+        index_type parent = _nodes[node].parent;
+        if (parent == null_index)
+            _root = replacement;
+        else if (_nodes[parent].left == node)
+            _nodes[parent].left = replacement;
+        else
+            _nodes[parent].right = replacement;
+        if (replacement != null_index)
+            _nodes[replacement].parent = parent;
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    void compact_map<Key, T, Compare, Alloc>::_rotate_left(index_type node)
+    {
+        index_type child = _nodes[node].right;
+        _nodes[node].right = _nodes[child].left;
+        if (_nodes[child].left != null_index)
+            _nodes[_nodes[child].left].parent = node;
+        _transplant(node, child);
+        _nodes[child].left = node;
+        _nodes[node].parent = child;
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    void compact_map<Key, T, Compare, Alloc>::_rotate_right(index_type node)
+    {
+        index_type child = _nodes[node].left;
+        _nodes[node].left = _nodes[child].right;
+        if (_nodes[child].right != null_index)
+            _nodes[_nodes[child].right].parent = node;
+        _transplant(node, child);
+        _nodes[child].right = node;
+        _nodes[node].parent = child;
+    };
+
+    /**
+     * @brief Fix a red node under a red parent, as tree::_insert_fixup does.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc>
+    void compact_map<Key, T, Compare, Alloc>::_insert_fixup(index_type node)
+    {
+        while (_is_red(_nodes[node].parent))
+        {
+            index_type parent = _nodes[node].parent;
+            index_type grandparent = _nodes[parent].parent;
+            bool parent_left = parent == _nodes[grandparent].left;
+            index_type uncle = parent_left ? _nodes[grandparent].right : _nodes[grandparent].left;
+            if (_is_red(uncle))
+            {
+                _set_red(parent, false);
+                _set_red(uncle, false);
+                _set_red(grandparent, true);
+                node = grandparent;
+                continue;
+            }
+            if (parent_left)
+            {
+                if (node == _nodes[parent].right)
+                {
+                    _rotate_left(parent);
+                    parent = node;
+                }
+                _rotate_right(grandparent);
+            }
+            else
+            {
+                if (node == _nodes[parent].left)
+                {
+                    _rotate_right(parent);
+                    parent = node;
+                }
+                _rotate_left(grandparent);
+            }
+            _set_red(parent, false);
+            _set_red(grandparent, true);
+            break;
+        }
+        _set_red(_root, false);
+    };
+
+    /**
+     * @brief Take node out of the tree without touching its slot, as tree::unlink does.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc>
+    void compact_map<Key, T, Compare, Alloc>::_unlink(index_type node)
+    {
+        bool removed_red = _is_red(node);
+        index_type child;
+        index_type child_parent;
+        if (_nodes[node].left == null_index)
+        {
+            child = _nodes[node].right;
+            child_parent = _nodes[node].parent;
+            _transplant(node, child);
+        }
+        else if (_nodes[node].right == null_index)
+        {
+            child = _nodes[node].left;
+            child_parent = _nodes[node].parent;
+            _transplant(node, child);
+        }
+        else
+        {
+            index_type moved = _lowest(_nodes[node].right);
+            removed_red = _is_red(moved);
+            child = _nodes[moved].right;
+            if (_nodes[moved].parent == node)
+                child_parent = moved;
+            else
+            {
+                child_parent = _nodes[moved].parent;
+                _transplant(moved, child);
+                _nodes[moved].right = _nodes[node].right;
+                _nodes[_nodes[moved].right].parent = moved;
+            }
+            _transplant(node, moved);
+            _nodes[moved].left = _nodes[node].left;
+            _nodes[_nodes[moved].left].parent = moved;
+            _nodes[moved].state = _nodes[node].state;
+        }
+        if (!removed_red)
+            _erase_fixup(child, child_parent);
+    };
+
+    /**
+     * @brief Give back the black node removed above node, which may be null_index and
+     * so is given with its parent, as tree::_erase_fixup does.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc>
+    void compact_map<Key, T, Compare, Alloc>::_erase_fixup(index_type node, index_type parent)
+    {
+        while (node != _root && !_is_red(node))
+        {
+            if (node == _nodes[parent].left)
+            {
+                index_type sibling = _nodes[parent].right;
+                if (_is_red(sibling))
+                {
+                    _set_red(sibling, false);
+                    _set_red(parent, true);
+                    _rotate_left(parent);
+                    sibling = _nodes[parent].right;
+                }
+                if (!_is_red(_nodes[sibling].left) && !_is_red(_nodes[sibling].right))
+                {
+                    _set_red(sibling, true);
+                    node = parent;
+                    parent = _nodes[node].parent;
+                    continue;
+                }
+                if (!_is_red(_nodes[sibling].right))
+                {
+                    _set_red(_nodes[sibling].left, false);
+                    _set_red(sibling, true);
+                    _rotate_right(sibling);
+                    sibling = _nodes[parent].right;
+                }
+                _nodes[sibling].state = _nodes[parent].state;
+                _set_red(parent, false);
+                _set_red(_nodes[sibling].right, false);
+                _rotate_left(parent);
+            }
+            else
+            {
+                index_type sibling = _nodes[parent].left;
+                if (_is_red(sibling))
+                {
+                    _set_red(sibling, false);
+                    _set_red(parent, true);
+                    _rotate_right(parent);
+                    sibling = _nodes[parent].left;
+                }
+                if (!_is_red(_nodes[sibling].left) && !_is_red(_nodes[sibling].right))
+                {
+                    _set_red(sibling, true);
+                    node = parent;
+                    parent = _nodes[node].parent;
+                    continue;
+                }
+                if (!_is_red(_nodes[sibling].left))
+                {
+                    _set_red(_nodes[sibling].right, false);
+                    _set_red(sibling, true);
+                    _rotate_left(sibling);
+                    sibling = _nodes[parent].left;
+                }
+                _nodes[sibling].state = _nodes[parent].state;
+                _set_red(parent, false);
+                _set_red(_nodes[sibling].left, false);
+                _rotate_right(parent);
+            }
+            node = _root;
+        }
+        if (node != null_index)
+            _set_red(node, false);
+    };
+
+    // NON MEMBER FUNCTIONS ===========================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator==(const compact_map<Key, T, Compare, Alloc> &lhs, const compact_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator!=(const compact_map<Key, T, Compare, Alloc> &lhs, const compact_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator<(const compact_map<Key, T, Compare, Alloc> &lhs, const compact_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator<=(const compact_map<Key, T, Compare, Alloc> &lhs, const compact_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator>(const compact_map<Key, T, Compare, Alloc> &lhs, const compact_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator>=(const compact_map<Key, T, Compare, Alloc> &lhs, const compact_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    void swap(compact_map<Key, T, Compare, Alloc> &x, compact_map<Key, T, Compare, Alloc> &y)
+    {
+        x.swap(y);
+    }
+} // namespace ft
+
+#endif // ********************************************** COMPACT_MAP_TPP end //
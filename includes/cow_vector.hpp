@@ -0,0 +1,199 @@
+#ifndef COW_VECTOR_HPP
+#define COW_VECTOR_HPP
+
+// LIBS ========================================================================
+#include <memory>
+#include <cstddef>
+#include "./utils.hpp"
+#include "./atomic.hpp"
+#include "./iterator.hpp"
+#include "./algorithm.hpp"
+
+namespace ft
+{
+    // CLASS =======================================================================
+
+    /**
+     * @brief Vector whose copies share one buffer until one of them is modified.
+     *
+     * Copies and assignments only take a reference on the buffer, counted atomically so
+     * that copies can live and die on different threads. The first mutating access on a
+     * shared copy (non-const iterators and element access, or any modifier) gives it its
+     * own copy of the elements; once unique, a cow_vector behaves like ft::vector.
+     * Const element access and const iteration read the buffer directly.
+     *
+     * As with any implicitly shared container, a reference or iterator obtained through
+     * non-const access must not be kept across a copy of the vector: writes through it
+     * would show in both copies. Read through a const reference to avoid detaching.
+     *
+     * @tparam T Element type.
+     * @tparam Alloc Allocator of the elements, also rebound to allocate the counter.
+     */
+    template <typename T, typename Alloc = std::allocator<T> >
+    class cow_vector
+    {
+    public:
+        // TYPEDEFS ==================================================================
+        typedef T value_type;
+        typedef Alloc allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef typename allocator_type::size_type size_type;
+
+        // ITERATORS =================================================================
+        typedef ft::random_access_iterator<pointer> iterator;
+        typedef ft::random_access_iterator<const_pointer> const_iterator;
+        typedef ft::reverse_iterator<iterator> reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    private:
+        typedef ft::atomic<size_t> counter_type;
+        typedef typename allocator_type::template rebind<counter_type>::other counter_allocator_type;
+
+        // ATTRIBUTES =================================================================
+        pointer _data;
+        size_type _size;
+        size_type _capacity;
+        counter_type *_refs;
+        allocator_type _alloc;
+        counter_allocator_type _counter_alloc;
+
+    public:
+        // CONSTRUCTORS ==========================================================
+
+        explicit cow_vector(const allocator_type &alloc = allocator_type());
+        explicit cow_vector(size_type n, const value_type &val = value_type(), const allocator_type &alloc = allocator_type());
+
+        template <class InputIterator>
+        cow_vector(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(),
+                   typename ft::enable_if<InputIterator, !ft::is_integral<InputIterator>::value>::type * = NULL);
+
+        /**
+         * @brief Shares the buffer of x. O(1).
+         *
+         */
+        cow_vector(const cow_vector &x);
+
+        // DESTRUCTOR =============================================================
+
+        /**
+         * @brief Drops this copy's reference; the last copy destroys the elements.
+         *
+         */
+        ~cow_vector();
+
+        // OPERATORS =============================================================
+
+        /**
+         * @brief Shares the buffer of x, dropping the current one. O(1).
+         *
+         */
+        cow_vector &operator=(const cow_vector &x);
+
+        // ITERATORS =============================================================
+
+        iterator begin();
+        const_iterator begin() const;
+        iterator end();
+        const_iterator end() const;
+        reverse_iterator rbegin();
+        const_reverse_iterator rbegin() const;
+        reverse_iterator rend();
+        const_reverse_iterator rend() const;
+
+        // CAPACITY ===============================================================
+
+        size_type size() const;
+        size_type max_size() const;
+        void resize(size_type n, value_type val = value_type());
+        size_type capacity() const;
+        bool empty(void) const;
+        void reserve(size_type n);
+
+        // ELEMENT ACCESS =============================================================
+
+        reference operator[](size_type n);
+        const_reference operator[](size_type n) const;
+        reference at(size_type n);
+        const_reference at(size_type n) const;
+        reference front();
+        const_reference front() const;
+        reference back();
+        const_reference back() const;
+
+        /**
+         * @brief Read-only pointer to the elements, shared with the other copies.
+         *
+         */
+        const_pointer data() const;
+
+        // MODIFIERS =============================================================
+
+        template <class InputIterator>
+        void assign(InputIterator first, InputIterator last,
+                    typename ft::enable_if<InputIterator, !ft::is_integral<InputIterator>::value>::type * = NULL);
+        void assign(size_type n, const value_type &val);
+        void push_back(const value_type &val);
+        void pop_back();
+        iterator insert(iterator position, const value_type &val);
+        iterator erase(iterator position);
+        iterator erase(iterator first, iterator last);
+        void swap(cow_vector &x);
+
+        /**
+         * @brief Removes every element. A shared buffer is left to the other copies
+         * instead of being copied.
+         *
+         */
+        void clear();
+
+        // SHARING =============================================================
+
+        /**
+         * @brief Number of copies sharing the buffer, 0 when nothing is allocated.
+         *
+         */
+        size_type use_count() const;
+
+        // ALLOCATOR =============================================================
+
+        allocator_type get_allocator() const;
+
+    private:
+        bool _shared() const;
+        void _unshare();
+        void _reallocate(size_type capacity);
+        void _release();
+    };
+
+    // NON MEMBER OVERLOADS ======================================================
+
+    template <typename T, typename Alloc>
+    bool operator==(const cow_vector<T, Alloc> &lhs, const cow_vector<T, Alloc> &rhs);
+
+    template <typename T, typename Alloc>
+    bool operator!=(const cow_vector<T, Alloc> &lhs, const cow_vector<T, Alloc> &rhs);
+
+    template <typename T, typename Alloc>
+    bool operator<(const cow_vector<T, Alloc> &lhs, const cow_vector<T, Alloc> &rhs);
+
+    template <typename T, typename Alloc>
+    bool operator<=(const cow_vector<T, Alloc> &lhs, const cow_vector<T, Alloc> &rhs);
+
+    template <typename T, typename Alloc>
+    bool operator>(const cow_vector<T, Alloc> &lhs, const cow_vector<T, Alloc> &rhs);
+
+    template <typename T, typename Alloc>
+    bool operator>=(const cow_vector<T, Alloc> &lhs, const cow_vector<T, Alloc> &rhs);
+
+    template <typename T, typename Alloc>
+    void swap(cow_vector<T, Alloc> &x, cow_vector<T, Alloc> &y);
+
+} // namespace ft
+
+#include "cow_vector.tpp"
+
+#endif // ********************************************** COW_VECTOR_HPP end //
@@ -0,0 +1,510 @@
+#ifndef COW_VECTOR_TPP
+#define COW_VECTOR_TPP
+
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include "cow_vector.hpp"
+
+namespace ft
+{
+    // CONSTRUCTORS =================================================================
+
+    template <typename T, typename Alloc>
+    cow_vector<T, Alloc>::cow_vector(const allocator_type &alloc)
+        : _data(NULL), _size(0), _capacity(0), _refs(NULL), _alloc(alloc), _counter_alloc(alloc)
+    {
+    };
+
+    template <typename T, typename Alloc>
+    cow_vector<T, Alloc>::cow_vector(size_type n, const value_type &val, const allocator_type &alloc)
+        : _data(NULL), _size(0), _capacity(0), _refs(NULL), _alloc(alloc), _counter_alloc(alloc)
+    {
+        assign(n, val);
+    };
+
+    template <typename T, typename Alloc>
+    template <class InputIterator>
+    cow_vector<T, Alloc>::cow_vector(InputIterator first, InputIterator last, const allocator_type &alloc,
+                                     typename ft::enable_if<InputIterator, !ft::is_integral<InputIterator>::value>::type *)
+        : _data(NULL), _size(0), _capacity(0), _refs(NULL), _alloc(alloc), _counter_alloc(alloc)
+    {
+        try
+        {
+            assign(first, last);
+        }
+        catch (...)
+        {
+            _release();
+            throw;
+        }
+    };
+
+    template <typename T, typename Alloc>
+    cow_vector<T, Alloc>::cow_vector(const cow_vector &x)
+        : _data(x._data), _size(x._size), _capacity(x._capacity), _refs(x._refs), _alloc(x._alloc),
+          _counter_alloc(x._counter_alloc)
+    {
+        if (_refs)
+            _refs->fetch_add(1, memory_order_relaxed);
+    };
+
+    // DESTRUCTOR ==================================================================
+
+    template <typename T, typename Alloc>
+    cow_vector<T, Alloc>::~cow_vector()
+    {
+        _release();
+    };
+
+    // OPERATORS ===================================================================
+
+    template <typename T, typename Alloc>
+    cow_vector<T, Alloc> &cow_vector<T, Alloc>::operator=(const cow_vector &x)
+    {
+        if (_refs != x._refs)
+        {
+            if (x._refs)
+                x._refs->fetch_add(1, memory_order_relaxed);
+            _release();
+            _data = x._data;
+            _size = x._size;
+            _capacity = x._capacity;
+            _refs = x._refs;
+            _alloc = x._alloc;
+            _counter_alloc = x._counter_alloc;
+        }
+        return (*this);
+    };
+
+    template <typename T, typename Alloc>
+    bool operator==(const cow_vector<T, Alloc> &lhs, const cow_vector<T, Alloc> &rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        if (lhs.data() == rhs.data())
+            return true;
+        return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    };
+
+    template <class T, class Alloc>
+    bool operator!=(const cow_vector<T, Alloc> &lhs, const cow_vector<T, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T, class Alloc>
+    bool operator<(const cow_vector<T, Alloc> &lhs, const cow_vector<T, Alloc> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class T, class Alloc>
+    bool operator<=(const cow_vector<T, Alloc> &lhs, const cow_vector<T, Alloc> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T, class Alloc>
+    bool operator>(const cow_vector<T, Alloc> &lhs, const cow_vector<T, Alloc> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T, class Alloc>
+    bool operator>=(const cow_vector<T, Alloc> &lhs, const cow_vector<T, Alloc> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class T, class Alloc>
+    void swap(cow_vector<T, Alloc> &x, cow_vector<T, Alloc> &y)
+    {
+        x.swap(y);
+    }
+
+    // MODIFIERS ====================================================================
+
+    template <typename T, typename Alloc>
+    void cow_vector<T, Alloc>::push_back(const value_type &val)
+    {
+        if (_size == _capacity)
+        {
+            value_type copy(val);
+            _reallocate(_capacity == 0 ? 1 : _capacity * 2);
+            _alloc.construct(_data + _size, copy);
+        }
+        else
+        {
+            _unshare();
+            _alloc.construct(_data + _size, val);
+        }
+        _size++;
+    };
+
+    template <typename T, typename Alloc>
+    void cow_vector<T, Alloc>::pop_back()
+    {
+        if (_size == 0)
+            throw std::out_of_range("cow_vector");
+        _unshare();
+        _alloc.destroy(_data + _size - 1);
+        _size--;
+    };
+
+    template <typename T, typename Alloc>
+    void cow_vector<T, Alloc>::clear()
+    {
+        if (_shared())
+        {
+            _release();
+            _data = NULL;
+            _capacity = 0;
+            _refs = NULL;
+        }
+        else
+        {
+            for (size_type i = 0; i < _size; i++)
+                _alloc.destroy(_data + i);
+        }
+        _size = 0;
+    };
+
+    template <typename T, typename Alloc>
+    void cow_vector<T, Alloc>::assign(size_type n, const value_type &val)
+    {
+        value_type copy(val);
+        clear();
+        reserve(n);
+        for (; _size < n; _size++)
+            _alloc.construct(_data + _size, copy);
+    };
+
+    template <typename T, typename Alloc>
+    template <typename InputIterator>
+    void cow_vector<T, Alloc>::assign(InputIterator first, InputIterator last,
+                                      typename ft::enable_if<InputIterator, !ft::is_integral<InputIterator>::value>::type *)
+    {
+        clear();
+        for (; first != last; ++first)
+            push_back(*first);
+    };
+
+    template <typename T, class Alloc>
+    typename cow_vector<T, Alloc>::iterator cow_vector<T, Alloc>::insert(iterator position, const value_type &val)
+    {
+        size_type pos = position.base() - _data;
+        value_type copy(val);
+
+        if (_size == _capacity)
+            _reallocate(_capacity == 0 ? 1 : _capacity * 2);
+        else
+            _unshare();
+        if (pos == _size)
+            _alloc.construct(_data + _size, copy);
+        else
+        {
+            _alloc.construct(_data + _size, _data[_size - 1]);
+            for (size_type i = _size - 1; i > pos; i--)
+                _data[i] = _data[i - 1];
+            _data[pos] = copy;
+        }
+        _size++;
+        return (iterator(_data + pos));
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::iterator cow_vector<T, Alloc>::erase(iterator position)
+    {
+        return (erase(position, position + 1));
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::iterator cow_vector<T, Alloc>::erase(iterator first, iterator last)
+    {
+        size_type pos = first.base() - _data;
+        size_type n = last - first;
+        _unshare();
+        for (size_type i = pos; i + n < _size; i++)
+            _data[i] = _data[i + n];
+        for (size_type i = 0; i < n; i++)
+            _alloc.destroy(_data + _size - i - 1);
+        _size -= n;
+        return (iterator(_data + pos));
+    };
+
+    template <typename T, typename Alloc>
+    void cow_vector<T, Alloc>::swap(cow_vector &x)
+    {
+        pointer tmp_data = _data;
+        size_type tmp_size = _size;
+        size_type tmp_capacity = _capacity;
+        counter_type *tmp_refs = _refs;
+        allocator_type tmp_alloc = _alloc;
+        counter_allocator_type tmp_counter_alloc = _counter_alloc;
+
+        _data = x._data;
+        _size = x._size;
+        _capacity = x._capacity;
+        _refs = x._refs;
+        _alloc = x._alloc;
+        _counter_alloc = x._counter_alloc;
+
+        x._data = tmp_data;
+        x._size = tmp_size;
+        x._capacity = tmp_capacity;
+        x._refs = tmp_refs;
+        x._alloc = tmp_alloc;
+        x._counter_alloc = tmp_counter_alloc;
+    };
+
+    // SHARING =====================================================================
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::size_type cow_vector<T, Alloc>::use_count() const
+    {
+        return (_refs ? _refs->load(memory_order_acquire) : 0);
+    };
+
+    // ALLOCATOR ====================================================================
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::allocator_type cow_vector<T, Alloc>::get_allocator() const
+    {
+        return _alloc;
+    };
+
+    // CAPACITY ===============================================================
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::size_type cow_vector<T, Alloc>::size() const
+    {
+        return (_size);
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::size_type cow_vector<T, Alloc>::max_size() const
+    {
+        return (_alloc.max_size());
+    };
+
+    template <typename T, typename Alloc>
+    void cow_vector<T, Alloc>::resize(size_type n, value_type val)
+    {
+        if (n > _capacity)
+            _reallocate(n);
+        else
+            _unshare();
+        for (; _size < n; _size++)
+            _alloc.construct(_data + _size, val);
+        for (; _size > n; _size--)
+            _alloc.destroy(_data + _size - 1);
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::size_type cow_vector<T, Alloc>::capacity() const
+    {
+        return (_capacity);
+    };
+
+    template <typename T, typename Alloc>
+    bool cow_vector<T, Alloc>::empty(void) const
+    {
+        return (_size == 0);
+    };
+
+    template <typename T, typename Alloc>
+    void cow_vector<T, Alloc>::reserve(size_type n)
+    {
+        if (n > max_size())
+            throw std::length_error("cow_vector::reserve");
+        if (n > _capacity)
+            _reallocate(n);
+    };
+
+    // ACCESSORS ====================================================================
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::reference cow_vector<T, Alloc>::operator[](size_type n)
+    {
+        _unshare();
+        return (_data[n]);
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::const_reference cow_vector<T, Alloc>::operator[](size_type n) const
+    {
+        return (_data[n]);
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::reference cow_vector<T, Alloc>::at(size_type n)
+    {
+        if (n >= _size)
+            throw std::out_of_range("cow_vector::at");
+        _unshare();
+        return (_data[n]);
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::const_reference cow_vector<T, Alloc>::at(size_type n) const
+    {
+        if (n >= _size)
+            throw std::out_of_range("cow_vector::at");
+        return (_data[n]);
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::reference cow_vector<T, Alloc>::front()
+    {
+        _unshare();
+        return (_data[0]);
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::const_reference cow_vector<T, Alloc>::front() const
+    {
+        return (_data[0]);
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::reference cow_vector<T, Alloc>::back()
+    {
+        _unshare();
+        return (_data[_size - 1]);
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::const_reference cow_vector<T, Alloc>::back() const
+    {
+        return (_data[_size - 1]);
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::const_pointer cow_vector<T, Alloc>::data() const
+    {
+        return (_data);
+    };
+
+    // ITERATORS ====================================================================
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::iterator cow_vector<T, Alloc>::begin()
+    {
+        _unshare();
+        return (iterator(_data));
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::const_iterator cow_vector<T, Alloc>::begin() const
+    {
+        return (const_iterator(_data));
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::iterator cow_vector<T, Alloc>::end()
+    {
+        _unshare();
+        return (iterator(_data + _size));
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::const_iterator cow_vector<T, Alloc>::end() const
+    {
+        return (const_iterator(_data + _size));
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::reverse_iterator cow_vector<T, Alloc>::rbegin()
+    {
+        return (reverse_iterator(end()));
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::const_reverse_iterator cow_vector<T, Alloc>::rbegin() const
+    {
+        return (const_reverse_iterator(end()));
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::reverse_iterator cow_vector<T, Alloc>::rend()
+    {
+        return (reverse_iterator(begin()));
+    };
+
+    template <typename T, typename Alloc>
+    typename cow_vector<T, Alloc>::const_reverse_iterator cow_vector<T, Alloc>::rend() const
+    {
+        return (const_reverse_iterator(begin()));
+    };
+
+    // PRIVATE ======================================================================
+
+    /**
+     * @brief Whether another copy holds the buffer. When the count is 1 no other
+     * thread can raise it, since that takes a copy of this object.
+     *
+     */
+    template <typename T, typename Alloc>
+    bool cow_vector<T, Alloc>::_shared() const
+    {
+        return (_refs && _refs->load(memory_order_acquire) != 1);
+    };
+
+    template <typename T, typename Alloc>
+    void cow_vector<T, Alloc>::_unshare()
+    {
+        if (_shared())
+            _reallocate(_capacity);
+    };
+
+    /**
+     * @brief Moves the elements to a new buffer of the given capacity, owned by this copy
+     * alone. The old buffer is released, so it is only destroyed if it was not shared.
+     *
+     */
+    template <typename T, typename Alloc>
+    void cow_vector<T, Alloc>::_reallocate(size_type capacity)
+    {
+        pointer data = _alloc.allocate(capacity);
+        size_type i = 0;
+        counter_type *refs = NULL;
+        try
+        {
+            for (; i < _size; i++)
+                _alloc.construct(data + i, _data[i]);
+            refs = _counter_alloc.allocate(1);
+        }
+        catch (...)
+        {
+            while (i > 0)
+                _alloc.destroy(data + --i);
+            _alloc.deallocate(data, capacity);
+            throw;
+        }
+        new (refs) counter_type(1);
+        _release();
+        _data = data;
+        _capacity = capacity;
+        _refs = refs;
+    };
+
+    /**
+     * @brief Drops this copy's reference, destroying the buffer if it was the last one.
+     * Copies sharing a buffer never modify it, so they all agree on its size.
+     *
+     */
+    template <typename T, typename Alloc>
+    void cow_vector<T, Alloc>::_release()
+    {
+        if (!_refs || _refs->fetch_sub(1, memory_order_acq_rel) != 1)
+            return;
+        for (size_type i = 0; i < _size; i++)
+            _alloc.destroy(_data + i);
+        _alloc.deallocate(_data, _capacity);
+        _refs->~counter_type();
+        _counter_alloc.deallocate(_refs, 1);
+    };
+}
+
+#endif // ********************************************** COW_VECTOR_TPP end //
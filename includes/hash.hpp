@@ -0,0 +1,105 @@
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include <cstddef>
+#include <string>
+#include "./utils.hpp"
+
+namespace ft
+{
+    /**
+     * @brief Finalizer of splitmix64. Every input bit affects every output bit, so both
+     * the low bits (bucket or shard index) and the high bits of the result are usable.
+     *
+     * @param x Value to mix.
+     * @return size_t
+     */
+    inline size_t hash_mix(unsigned long long x)
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return static_cast<size_t>(x);
+    }
+
+    /**
+     * @brief FNV-1a over a byte range, followed by hash_mix.
+     *
+     * @param bytes First byte.
+     * @param len Number of bytes.
+     * @return size_t
+     */
+    inline size_t hash_bytes(const void *bytes, size_t len)
+    {
+        const unsigned char *p = static_cast<const unsigned char *>(bytes);
+        unsigned long long h = 0xcbf29ce484222325ULL;
+        for (size_t i = 0; i < len; i++)
+        {
+            h ^= p[i];
+            h *= 0x100000001b3ULL;
+        }
+        return hash_mix(h);
+    }
+
+    // hash =========================================================================
+
+    /**
+     * @brief Hash of integral types, only defined when T is integral.
+     *
+     */
+    template <typename T, bool = ft::is_integral<T>::value>
+    struct integral_hash
+    {
+    };
+
+    template <typename T>
+    struct integral_hash<T, true>
+    {
+        typedef T argument_type;
+        typedef size_t result_type;
+
+        size_t operator()(T val) const
+        {
+            return hash_mix(static_cast<unsigned long long>(val));
+        }
+    };
+
+    /**
+     * @brief Function object hashing a key to a size_t, modeled after std::hash.
+     * Defined for integral types, pointers and std::string.
+     *
+     * @tparam T Key type.
+     */
+    template <typename T>
+    struct hash : public integral_hash<T>
+    {
+    };
+
+    template <typename T>
+    struct hash<T *>
+    {
+        typedef T *argument_type;
+        typedef size_t result_type;
+
+        size_t operator()(T *ptr) const
+        {
+            return hash_mix(static_cast<unsigned long long>(reinterpret_cast<size_t>(ptr)));
+        }
+    };
+
+    template <>
+    struct hash<std::string>
+    {
+        typedef std::string argument_type;
+        typedef size_t result_type;
+
+        size_t operator()(const std::string &str) const
+        {
+            return hash_bytes(str.data(), str.size());
+        }
+    };
+} // namespace ft
+
+#endif // ********************************************** HASH_HPP end //
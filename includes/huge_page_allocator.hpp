@@ -0,0 +1,238 @@
+#ifndef HUGE_PAGE_ALLOCATOR_HPP
+#define HUGE_PAGE_ALLOCATOR_HPP
+
+// LIBS ========================================================================
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <sys/mman.h>
+#include "./utils.hpp"
+#include "./vector.hpp"
+
+namespace ft
+{
+    // RELOCATION ==================================================================
+
+    /**
+     * @brief True for types that stay valid when their bytes move to another address,
+     * so a buffer of them can be moved page by page instead of copy constructed.
+     * Specialize it for other types that hold no pointer into themselves.
+     */
+    template <typename T>
+    struct trivially_relocatable
+    {
+        static const bool value = is_integral<T>::value;
+    };
+
+    template <typename T>
+    struct trivially_relocatable<T *>
+    {
+        static const bool value = true;
+    };
+
+    template <>
+    struct trivially_relocatable<float>
+    {
+        static const bool value = true;
+    };
+
+    template <>
+    struct trivially_relocatable<double>
+    {
+        static const bool value = true;
+    };
+
+    template <>
+    struct trivially_relocatable<long double>
+    {
+        static const bool value = true;
+    };
+
+    // CLASS =======================================================================
+
+    /**
+     * @brief Allocator backing large buffers with transparent huge pages.
+     *
+     * Requests of huge_page_size bytes or more get their own anonymous mapping, rounded
+     * up and aligned to 2 MiB and marked MADV_HUGEPAGE, so that the kernel can back it
+     * with huge pages and a random access over the buffer costs one TLB entry per 2 MiB
+     * instead of one per 4 KiB. Smaller requests go to operator new. reallocate() grows a
+     * mapped buffer with mremap, which moves page table entries rather than bytes;
+     * ft::vector uses it through allocator_growth for trivially relocatable types.
+     * Allocation failures throw std::bad_alloc.
+     */
+    template <typename T>
+    class huge_page_allocator
+    {
+    public:
+        typedef T value_type;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef size_t size_type;
+        typedef ptrdiff_t difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef huge_page_allocator<U> other;
+        };
+
+        static const size_t huge_page_size = 2 * 1024 * 1024;
+
+        huge_page_allocator() {}
+        huge_page_allocator(const huge_page_allocator &) {}
+        template <typename U>
+        huge_page_allocator(const huge_page_allocator<U> &) {}
+        ~huge_page_allocator() {}
+
+        pointer address(reference x) const { return &x; }
+        const_pointer address(const_reference x) const { return &x; }
+
+        size_type max_size() const
+        {
+            return (std::numeric_limits<size_type>::max() - huge_page_size) / sizeof(T);
+        }
+
+        pointer allocate(size_type n, const void * = 0)
+        {
+            if (n > max_size())
+                throw std::bad_alloc();
+            if (!mapped(n))
+                return static_cast<pointer>(::operator new(n * sizeof(T)));
+            return static_cast<pointer>(_map(_length(n)));
+        }
+
+        void deallocate(pointer p, size_type n)
+        {
+            if (p == NULL)
+                return;
+            if (!mapped(n))
+                ::operator delete(p);
+            else
+                munmap(p, _length(n));
+        }
+
+        /**
+         * @brief Grows or shrinks the mapped buffer p of old_n elements to new_n without
+         * copying it: in place when the address space after it is free, otherwise by
+         * moving its pages to a new 2 MiB aligned range. Returns the buffer, or NULL when
+         * either size is below huge_page_size or the kernel refuses; p is then untouched.
+         *
+         */
+        pointer reallocate(pointer p, size_type old_n, size_type new_n)
+        {
+            if (p == NULL || !mapped(old_n) || !mapped(new_n) || new_n > max_size())
+                return NULL;
+            size_t old_length = _length(old_n);
+            size_t new_length = _length(new_n);
+            if (old_length == new_length)
+                return p;
+#ifdef MREMAP_FIXED
+            if (mremap(p, old_length, new_length, 0) != MAP_FAILED)
+            {
+                _advise(p, new_length);
+                return p;
+            }
+            void *target;
+            try
+            {
+                target = _map(new_length);
+            }
+            catch (std::bad_alloc &)
+            {
+                return NULL;
+            }
+            if (mremap(p, old_length, new_length, MREMAP_MAYMOVE | MREMAP_FIXED, target) == MAP_FAILED)
+            {
+                munmap(target, new_length);
+                return NULL;
+            }
+            return static_cast<pointer>(target);
+#else
+            return NULL;
+#endif
+        }
+
+        /**
+         * @brief True when a buffer of n elements gets its own huge page mapping.
+         *
+         */
+        static bool mapped(size_type n)
+        {
+            return n >= huge_page_size / sizeof(T);
+        }
+
+        void construct(pointer p, const_reference val) { new (p) T(val); }
+        void destroy(pointer p) { p->~T(); }
+
+    private:
+        static size_t _length(size_type n)
+        {
+            return (n * sizeof(T) + huge_page_size - 1) / huge_page_size * huge_page_size;
+        }
+
+        static void _advise(void *addr, size_t length)
+        {
+#ifdef MADV_HUGEPAGE
+            madvise(addr, length, MADV_HUGEPAGE);
+#else
+            (void)addr;
+            (void)length;
+#endif
+        }
+
+        /**
+         * @brief Maps length bytes at a 2 MiB boundary: maps one huge page more than
+         * asked and unmaps the misaligned head and the tail.
+         *
+         */
+        static void *_map(size_t length)
+        {
+            void *addr = mmap(NULL, length + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (addr == MAP_FAILED)
+                throw std::bad_alloc();
+            char *raw = static_cast<char *>(addr);
+            char *aligned = reinterpret_cast<char *>(
+                (reinterpret_cast<size_t>(raw) + huge_page_size - 1) / huge_page_size * huge_page_size);
+            if (aligned != raw)
+                munmap(raw, aligned - raw);
+            if (raw + huge_page_size != aligned)
+                munmap(aligned + length, raw + huge_page_size - aligned);
+            _advise(aligned, length);
+            return aligned;
+        }
+    };
+
+    template <typename T, typename U>
+    bool operator==(const huge_page_allocator<T> &, const huge_page_allocator<U> &)
+    {
+        return true;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const huge_page_allocator<T> &, const huge_page_allocator<U> &)
+    {
+        return false;
+    }
+
+    // VECTOR GROWTH ===============================================================
+
+    /**
+     * @brief ft::vector of trivially relocatable elements grows through mremap.
+     *
+     */
+    template <typename T>
+    struct allocator_growth<huge_page_allocator<T> >
+    {
+        static T *grow(huge_page_allocator<T> &alloc, T *p, size_t old_n, size_t new_n)
+        {
+            if (!trivially_relocatable<T>::value)
+                return NULL;
+            return alloc.reallocate(p, old_n, new_n);
+        }
+    };
+} // namespace ft
+
+#endif // ********************************************** HUGE_PAGE_ALLOCATOR_HPP end //
@@ -161,5 +161,39 @@ namespace ft
     {
         return lhs.base() >= rhs.base();
     }
+
+    /**
+     * @brief Output iterator calling push_back on a container for every value assigned
+     * through it.
+     *
+     * @tparam Container
+     */
+    template <typename Container>
+    class back_insert_iterator : public iterator<output_iterator_tag, void, void, void, void>
+    {
+    public:
+        typedef Container container_type;
+
+        explicit back_insert_iterator(Container &x) : _container(&x) {}
+
+        back_insert_iterator &operator=(const typename Container::value_type &val)
+        {
+            _container->push_back(val);
+            return *this;
+        }
+
+        back_insert_iterator &operator*() { return *this; }
+        back_insert_iterator &operator++() { return *this; }
+        back_insert_iterator operator++(int) { return *this; }
+
+    protected:
+        Container *_container;
+    };
+
+    template <typename Container>
+    back_insert_iterator<Container> back_inserter(Container &x)
+    {
+        return back_insert_iterator<Container>(x);
+    }
 }
 #endif // ********************************************** ITERATOR_HPP end //
\ No newline at end of file
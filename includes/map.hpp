@@ -4,24 +4,20 @@
 #include <memory>
 #include <functional>
 #include "tree.hpp"
+#include "node_handle.hpp"
 #include "reverse_iterator.hpp"
 #include "iterator_traits.hpp"
 #include "pair.hpp"
+#include "algorithm.hpp"
+#include "vector.hpp"
+#include "thread_pool.hpp"
+
 namespace ft
 {
-    template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+    template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> >,
+              class Layout = inline_node_layout, class Stats = ft::null_stats>
     class map
     {
-        // TREE NODE ===========================================================
-
-    private:
-        typedef ft::tree<ft::pair<const Key, T>, Compare, Alloc> _tree;
-        typedef typename _tree::iterator _tree_iterator;
-        typedef typename _tree::const_iterator _tree_const_iterator;
-        typedef ft::reverse_iterator<_tree_iterator> reverse_iterator;
-        typedef ft::reverse_iterator<_tree_const_iterator> const_reverse_iterator;
-        typedef typename ft::iterator_traits<_tree_iterator>::difference_type difference_type;
-
     public:
         // MEMBER TYPES ========================================================
         typedef Key key_type;
@@ -29,18 +25,23 @@ namespace ft
         typedef ft::pair<const key_type, mapped_type> value_type;
         typedef Compare key_compare;
         typedef Alloc allocator_type;
+        typedef Stats stats_policy;
         typedef typename allocator_type::reference reference;
         typedef typename allocator_type::const_reference const_reference;
         typedef typename allocator_type::pointer pointer;
         typedef typename allocator_type::const_pointer const_pointer;
         typedef typename allocator_type::size_type size_type;
-        // typedef typename allocator_type::difference_type difference_type;
+
+        /**
+         * @brief Number of elements for_each_batch hands over at a time.
+         */
+        static const size_type for_each_batch_size = 64;
 
         // MEMBER CLASSES ======================================================
 
         class value_compare : public std::binary_function<value_type, value_type, bool>
         {
-            friend class map<Key, T, Compare, Alloc>;
+            friend class map<Key, T, Compare, Alloc, Layout, Stats>;
 
         protected:
             Compare comp;
@@ -51,8 +52,57 @@ namespace ft
             {
                 return comp(x.first, y.first);
             }
+
+            /**
+             * @brief Compares anything with a key as first member, like the key kept
+             * in the nodes of split_node_layout.
+             *
+             */
+            template <class U, class V>
+            bool operator()(const U &x, const V &y) const
+            {
+                return comp(x.first, y.first);
+            }
+            /**
+             * @brief Compares a bare key with the key of a node, so that lookups never
+             * build a value_type.
+             *
+             */
+            template <class V>
+            bool operator()(const key_type &k, const V &y) const
+            {
+                return comp(k, y.first);
+            }
+
+            template <class U>
+            bool operator()(const U &x, const key_type &k) const
+            {
+                return comp(x.first, k);
+            }
         };
 
+    private:
+        // TREE NODE ===========================================================
+        typedef typename Layout::template node<value_type, allocator_type>::type tree_node_type;
+        typedef typename allocator_type::template rebind<tree_node_type>::other node_allocator_type;
+        typedef ft::tree<value_type, value_compare, tree_node_type, allocator_type, node_allocator_type, Stats> tree_type;
+
+    public:
+        // ITERATORS ===========================================================
+        typedef typename tree_type::iterator iterator;
+        typedef typename tree_type::const_iterator const_iterator;
+        typedef ft::reverse_iterator<iterator> reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+        typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+
+        // NODE HANDLES ========================================================
+        typedef map_node_handle<tree_node_type, node_allocator_type, key_type, mapped_type> node_type;
+        typedef node_insert_return<iterator, node_type> insert_return_type;
+
+    private:
+        // ATTRIBUTES ==========================================================
+        tree_type _tree;
+
     public:
         // MEMBER FUNCTIONS ====================================================
 
@@ -93,25 +143,25 @@ namespace ft
          * @brief Returns an iterator referring to the first element in the map container.
          *
          */
-        _tree_iterator begin();
+        iterator begin();
 
         /**
          * @brief Returns an iterator referring to the past-the-end element in the map container.
          *
          */
-        _tree_iterator end();
+        iterator end();
 
         /**
-         * @brief Returns a _tree_const_iterator referring to the first element in the map container.
+         * @brief Returns a const_iterator referring to the first element in the map container.
          *
          */
-        _tree_const_iterator begin() const;
+        const_iterator begin() const;
 
         /**
-         * @brief Returns a _tree_const_iterator referring to the past-the-end element in the map container.
+         * @brief Returns a const_iterator referring to the past-the-end element in the map container.
          *
          */
-        _tree_const_iterator end() const;
+        const_iterator end() const;
 
         /**
          * @brief Returns a reverse_iterator pointing to the last element in the map container.
@@ -173,13 +223,13 @@ namespace ft
          * @brief Inserts an element into the map container, if the container doesn't already contain an element with an equivalent key.
          *
          */
-        ft::pair<_tree_iterator, bool> insert(const value_type &val);
+        ft::pair<iterator, bool> insert(const value_type &val);
 
         /**
          * @brief Inserts an element into the map container, if the container doesn't already contain an element with an equivalent key.
          *
          */
-        _tree_iterator insert(_tree_iterator position, const value_type &val);
+        iterator insert(iterator position, const value_type &val);
 
         /**
          * @brief Inserts elements from range [first,last) into the map.
@@ -188,11 +238,63 @@ namespace ft
         template <class InputIterator>
         void insert(InputIterator first, InputIterator last);
 
+        /**
+         * @brief Replaces the content with the range [first,last), which must be sorted by key
+         * without duplicates, in O(n) instead of n inserts. Throws std::invalid_argument otherwise.
+         *
+         */
+        template <class RandomAccessIterator>
+        void assign_sorted(RandomAccessIterator first, RandomAccessIterator last);
+
+        /**
+         * @brief Links the node held by nh, which becomes empty, unless its key is already
+         * in the map: the node is then handed back in the result. Nothing is allocated
+         * nor copied.
+         *
+         */
+        insert_return_type insert(const node_type &nh);
+
+        /**
+         * @brief Unlinks the element at position and returns the handle owning its node.
+         *
+         */
+        node_type extract(iterator position);
+
+        /**
+         * @brief Unlinks the element with key k, if any, and returns the handle owning its
+         * node. The handle is empty when k is missing.
+         *
+         */
+        node_type extract(const key_type &k);
+
+        /**
+         * @brief Moves every element of source whose key is not in the map into it, by
+         * relinking its node. Elements with a key already here stay in source.
+         *
+         */
+        void merge(map &source);
+
+        /**
+         * @brief Moves the elements with a key not less than k into right, replacing its
+         * content, in O(log n) and without copying elements. Iterators to the elements
+         * moved are invalidated.
+         *
+         */
+        void split_off(const key_type &k, map &right);
+
+        /**
+         * @brief Moves every element of other into the map in O(log n), other becoming
+         * empty. The keys of other must all go after the keys here, or all before;
+         * throws std::invalid_argument otherwise.
+         *
+         */
+        void append(map &other);
+
         /**
          * @brief Erases an element from the map container.
          *
          */
-        void erase(_tree_iterator position);
+        void erase(iterator position);
 
         /**
          * @brief Erases an element from the map container.
@@ -201,10 +303,11 @@ namespace ft
         size_type erase(const key_type &k);
 
         /**
-         * @brief Erases elements from the map container.
+         * @brief Erases the elements in [first,last) from the map container, in
+         * O(k + log n) for k elements. Iterators outside the range stay valid.
          *
          */
-        void erase(_tree_iterator first, _tree_iterator last);
+        void erase(iterator first, iterator last);
 
         /**
          * @brief Exchanges the content of the container by the content of x, which is another map of the same type. Sizes may differ.
@@ -240,14 +343,14 @@ namespace ft
          * an iterator to it if found, otherwise it returns an iterator to map::end.
          *
          */
-        _tree_iterator find(const key_type &k);
+        iterator find(const key_type &k);
 
         /**
          * @brief Searches the container for an element with a key equivalent to k and returns
          * an iterator to it if found, otherwise it returns an iterator to map::end.
          *
          */
-        _tree_const_iterator find(const key_type &k) const;
+        const_iterator find(const key_type &k) const;
 
         /**
          * @brief Searches the container for elements with a key equivalent to k and returns
@@ -261,42 +364,94 @@ namespace ft
          * is not considered to go before k (i.e., either it is equivalent or goes after).
          *
          */
-        _tree_iterator lower_bound(const key_type &k);
+        iterator lower_bound(const key_type &k);
 
         /**
          * @brief Returns an iterator pointing to the first element in the container whose key
          * is not considered to go before k (i.e., either it is equivalent or goes after).
          *
          */
-        _tree_const_iterator lower_bound(const key_type &k) const;
+        const_iterator lower_bound(const key_type &k) const;
 
         /**
          * @brief Returns an iterator pointing to the first element in the container whose key
          * is considered to go after k.
          *
          */
-        _tree_iterator upper_bound(const key_type &k);
+        iterator upper_bound(const key_type &k);
 
         /**
          * @brief Returns an iterator pointing to the first element in the container whose key
          * is considered to go after k.
          *
          */
-        _tree_const_iterator upper_bound(const key_type &k) const;
+        const_iterator upper_bound(const key_type &k) const;
 
         /**
          * @brief Returns the bounds of a range that includes all the elements in the container
          * which have a key equivalent to k.
          *
          */
-        ft::pair<_tree_const_iterator, _tree_const_iterator> equal_range(const key_type &k) const;
+        ft::pair<const_iterator, const_iterator> equal_range(const key_type &k) const;
 
         /**
          * @brief Returns the bounds of a range that includes all the elements in the container
          * which have a key equivalent to k.
          *
          */
-        ft::pair<_tree_iterator, _tree_iterator> equal_range(const key_type &k);
+        ft::pair<iterator, iterator> equal_range(const key_type &k);
+
+        /**
+         * @brief Returns an iterator to the element of rank n in key order, in O(log n),
+         * or map::end when n is not less than size().
+         *
+         */
+        iterator nth(size_type n);
+
+        /**
+         * @brief Returns an iterator to the element of rank n in key order, in O(log n),
+         * or map::end when n is not less than size().
+         *
+         */
+        const_iterator nth(size_type n) const;
+
+        /**
+         * @brief Calls visitor(value_type &) on the elements with a key not less than
+         * first_key and less than last_key, in key order, until it returns false. Faster
+         * than an iterator loop: see tree::visit.
+         *
+         * @return The visitor, so it can carry results out like std::for_each.
+         */
+        template <class Visitor>
+        Visitor for_each(const key_type &first_key, const key_type &last_key, Visitor visitor);
+
+        /**
+         * @brief Calls visitor(const value_type &) on the elements with a key not less
+         * than first_key and less than last_key, in key order, until it returns false.
+         *
+         * @return The visitor, so it can carry results out like std::for_each.
+         */
+        template <class Visitor>
+        Visitor for_each(const key_type &first_key, const key_type &last_key, Visitor visitor) const;
+
+        /**
+         * @brief Like for_each, but hands the elements over by batches of up to
+         * for_each_batch_size, as visitor(pointer *values, size_type n), so that the
+         * visitor runs a tight loop over each batch. Returning false stops the walk.
+         *
+         * @return The visitor, so it can carry results out like std::for_each.
+         */
+        template <class Visitor>
+        Visitor for_each_batch(const key_type &first_key, const key_type &last_key, Visitor visitor);
+
+        /**
+         * @brief Like for_each, but hands the elements over by batches of up to
+         * for_each_batch_size, as visitor(const_pointer *values, size_type n).
+         *
+         * @return The visitor, so it can carry results out like std::for_each.
+         */
+        template <class Visitor>
+        Visitor for_each_batch(const key_type &first_key, const key_type &last_key, Visitor visitor) const;
 
         // ALLOCATOR ===========================================================
 
@@ -305,7 +460,139 @@ namespace ft
          *
          */
         allocator_type get_allocator() const;
+
+        // DIAGNOSTICS =========================================================
+
+        /**
+         * @brief Returns the height and the depth distribution of the tree, in O(n).
+         *
+         */
+        tree_shape shape() const;
+
+        /**
+         * @brief Checks the tree: links, key order, subtree sizes and red-black rules.
+         *
+         * @return NULL when sound, otherwise a description of the first problem found.
+         */
+        const char *validate() const;
+
+        /**
+         * @brief Counts comparisons, rotations and node allocations of the following
+         * operations into counters, until detached with NULL. Copies of the map do not
+         * count.
+         *
+         */
+        void set_counters(tree_counters *counters);
+
     };
+
+    // NON MEMBER OVERLOADS ======================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool operator==(const map<Key, T, Compare, Alloc, Layout, Stats> &lhs, const map<Key, T, Compare, Alloc, Layout, Stats> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool operator!=(const map<Key, T, Compare, Alloc, Layout, Stats> &lhs, const map<Key, T, Compare, Alloc, Layout, Stats> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool operator<(const map<Key, T, Compare, Alloc, Layout, Stats> &lhs, const map<Key, T, Compare, Alloc, Layout, Stats> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool operator<=(const map<Key, T, Compare, Alloc, Layout, Stats> &lhs, const map<Key, T, Compare, Alloc, Layout, Stats> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool operator>(const map<Key, T, Compare, Alloc, Layout, Stats> &lhs, const map<Key, T, Compare, Alloc, Layout, Stats> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool operator>=(const map<Key, T, Compare, Alloc, Layout, Stats> &lhs, const map<Key, T, Compare, Alloc, Layout, Stats> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void swap(map<Key, T, Compare, Alloc, Layout, Stats> &x, map<Key, T, Compare, Alloc, Layout, Stats> &y);
+
+    // SET OPERATIONS ============================================================
+    /*
+     * One merge pass over both maps in key order into a sorted buffer, from which result
+     * is built with assign_sorted: O(n + m) with no tree descent. result may be a or b.
+     * A key in both maps keeps its value from a.
+     */
+
+    /**
+     * @brief Replaces result with the entries whose key is in a or in b.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void set_union(const map<Key, T, Compare, Alloc, Layout, Stats> &a, const map<Key, T, Compare, Alloc, Layout, Stats> &b,
+                   map<Key, T, Compare, Alloc, Layout, Stats> &result);
+
+    /**
+     * @brief Replaces result with the entries of a whose key is also in b.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void set_intersection(const map<Key, T, Compare, Alloc, Layout, Stats> &a, const map<Key, T, Compare, Alloc, Layout, Stats> &b,
+                          map<Key, T, Compare, Alloc, Layout, Stats> &result);
+
+    /**
+     * @brief Replaces result with the entries of a whose key is not in b.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void set_difference(const map<Key, T, Compare, Alloc, Layout, Stats> &a, const map<Key, T, Compare, Alloc, Layout, Stats> &b,
+                        map<Key, T, Compare, Alloc, Layout, Stats> &result);
+
+    // PARALLEL OPERATIONS =======================================================
+    /*
+     * Both run on the threads of a thread_pool, whose tasks cannot wait for one another:
+     * the recursion of join-based algorithms is unrolled into one level of independent
+     * parts, cut and glued back with split_off and append at O(log n) each, so only the
+     * work in between runs in parallel. Inputs smaller than parallel_map_grain elements
+     * per thread are handled on the calling thread.
+     */
+
+    /**
+     * @brief Below this many elements per thread, the parallel operations do not split.
+     */
+    static const size_t parallel_map_grain = 1 << 14;
+
+    /**
+     * @brief Replaces result with the pairs of the range [first,last), in any order: they
+     * are copied into a buffer, sorted with parallel_sort, then each thread bulk-loads one
+     * slice of the buffer with assign_sorted and the slices are joined. Of several pairs
+     * with the same key, an unspecified one is kept. If sorting or building fails on a
+     * thread, the buffer and the parts built are freed, result is left untouched and the
+     * failure is thrown again on the calling thread, as a task_failure rethrows it.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats, class InputIterator>
+    void parallel_build(InputIterator first, InputIterator last, map<Key, T, Compare, Alloc, Layout, Stats> &result, thread_pool &pool);
+
+    /**
+     * @brief parallel_build on a temporary pool with one thread per core.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats, class InputIterator>
+    void parallel_build(InputIterator first, InputIterator last, map<Key, T, Compare, Alloc, Layout, Stats> &result);
+
+    /**
+     * @brief Moves every element of source whose key is not in target into target, like
+     * target.merge(source): elements with a key already in target stay in source. Both
+     * maps are split around median keys into one pair of parts per task, each pair is
+     * merged on a thread by relinking nodes, and the parts are appended back in order.
+     * Maps must share an allocator whose nodes can go from one map to the other. If the
+     * comparator throws on a thread, that merge stops with every node in one of its two
+     * parts, the parts are still appended back, and the failure is thrown again on the
+     * calling thread, as a task_failure rethrows it.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void parallel_union(map<Key, T, Compare, Alloc, Layout, Stats> &target, map<Key, T, Compare, Alloc, Layout, Stats> &source, thread_pool &pool);
+
+    /**
+     * @brief parallel_union on a temporary pool with one thread per core.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void parallel_union(map<Key, T, Compare, Alloc, Layout, Stats> &target, map<Key, T, Compare, Alloc, Layout, Stats> &source);
 }
 
 #include "map.tpp"
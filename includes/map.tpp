@@ -1,10 +1,675 @@
 #ifndef MAP_TPP
 #define MAP_TPP
 
+#include <new>
+#include <stdexcept>
 #include "map.hpp"
 
 namespace ft
 {
+    // CONSTRUCTORS =================================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    map<Key, T, Compare, Alloc, Layout, Stats>::map(const key_compare &comp, const allocator_type &alloc)
+        : _tree(value_compare(comp), alloc, node_allocator_type(alloc)){};
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    template <class InputIterator>
+    map<Key, T, Compare, Alloc, Layout, Stats>::map(InputIterator first, InputIterator last, const key_compare &comp, const allocator_type &alloc)
+        : _tree(value_compare(comp), alloc, node_allocator_type(alloc))
+    {
+        insert(first, last);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    map<Key, T, Compare, Alloc, Layout, Stats>::map(const map &x) : _tree(x._tree){};
+
+    // DESTRUCTOR ==================================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    map<Key, T, Compare, Alloc, Layout, Stats>::~map(){};
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    map<Key, T, Compare, Alloc, Layout, Stats> &map<Key, T, Compare, Alloc, Layout, Stats>::operator=(const map &x)
+    {
+        if (this != &x)
+            _tree = x._tree;
+        return (*this);
+    };
+
+    // ITERATORS ====================================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::iterator map<Key, T, Compare, Alloc, Layout, Stats>::begin()
+    {
+        return (_tree.begin());
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::iterator map<Key, T, Compare, Alloc, Layout, Stats>::end()
+    {
+        return (_tree.end());
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::const_iterator map<Key, T, Compare, Alloc, Layout, Stats>::begin() const
+    {
+        return (_tree.begin());
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::const_iterator map<Key, T, Compare, Alloc, Layout, Stats>::end() const
+    {
+        return (_tree.end());
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::reverse_iterator map<Key, T, Compare, Alloc, Layout, Stats>::rbegin()
+    {
+        return (reverse_iterator(end()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::reverse_iterator map<Key, T, Compare, Alloc, Layout, Stats>::rend()
+    {
+        return (reverse_iterator(begin()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::const_reverse_iterator map<Key, T, Compare, Alloc, Layout, Stats>::rbegin() const
+    {
+        return (const_reverse_iterator(end()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::const_reverse_iterator map<Key, T, Compare, Alloc, Layout, Stats>::rend() const
+    {
+        return (const_reverse_iterator(begin()));
+    };
+
+    // CAPACITY ===============================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool map<Key, T, Compare, Alloc, Layout, Stats>::empty() const
+    {
+        return (_tree.size() == 0);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::size_type map<Key, T, Compare, Alloc, Layout, Stats>::size() const
+    {
+        return (_tree.size());
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::size_type map<Key, T, Compare, Alloc, Layout, Stats>::max_size() const
+    {
+        return (_tree.max_size());
+    };
+
+    // ELEMENT ACCESS ==============================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::mapped_type &map<Key, T, Compare, Alloc, Layout, Stats>::operator[](const key_type &k)
+    {
+        return (insert(value_type(k, mapped_type())).first->second);
+    };
+
+    // MODIFIERS ====================================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    ft::pair<typename map<Key, T, Compare, Alloc, Layout, Stats>::iterator, bool> map<Key, T, Compare, Alloc, Layout, Stats>::insert(const value_type &val)
+    {
+        return (_tree.insert(val));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::iterator map<Key, T, Compare, Alloc, Layout, Stats>::insert(iterator position, const value_type &val)
+    {
+        (void)position;
+        return (_tree.insert(val).first);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    template <class InputIterator>
+    void map<Key, T, Compare, Alloc, Layout, Stats>::insert(InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+            _tree.insert(*first);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    template <class RandomAccessIterator>
+    void map<Key, T, Compare, Alloc, Layout, Stats>::assign_sorted(RandomAccessIterator first, RandomAccessIterator last)
+    {
+        key_compare comp = key_comp();
+        for (RandomAccessIterator it = first; it != last && it + 1 != last; ++it)
+            if (!comp((*it).first, (*(it + 1)).first))
+                throw std::invalid_argument("map::assign_sorted: range is not sorted by unique keys");
+        _tree.assign_sorted(first, static_cast<size_type>(last - first));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::insert_return_type map<Key, T, Compare, Alloc, Layout, Stats>::insert(const node_type &nh)
+    {
+        if (nh.empty())
+            return (insert_return_type(end(), false, node_type()));
+        tree_node_type *node = nh.release();
+        ft::pair<iterator, bool> res = _tree.insert_node(node);
+        if (!res.second)
+            return (insert_return_type(res.first, false, node_type(node, _tree.get_node_allocator())));
+        return (insert_return_type(res.first, true, node_type()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::node_type map<Key, T, Compare, Alloc, Layout, Stats>::extract(iterator position)
+    {
+        return (node_type(_tree.unlink(position._node), _tree.get_node_allocator()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::node_type map<Key, T, Compare, Alloc, Layout, Stats>::extract(const key_type &k)
+    {
+        iterator it = find(k);
+        if (it == end())
+            return (node_type());
+        return (extract(it));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void map<Key, T, Compare, Alloc, Layout, Stats>::merge(map &source)
+    {
+        _tree.merge(source._tree);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void map<Key, T, Compare, Alloc, Layout, Stats>::split_off(const key_type &k, map &right)
+    {
+        _tree.split(k, right._tree);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void map<Key, T, Compare, Alloc, Layout, Stats>::append(map &other)
+    {
+        _tree.join(other._tree);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void map<Key, T, Compare, Alloc, Layout, Stats>::erase(iterator position)
+    {
+        _tree.remove(position._node);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::size_type map<Key, T, Compare, Alloc, Layout, Stats>::erase(const key_type &k)
+    {
+        return (_tree.remove(k));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void map<Key, T, Compare, Alloc, Layout, Stats>::erase(iterator first, iterator last)
+    {
+        _tree.remove(first._node, last._node);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void map<Key, T, Compare, Alloc, Layout, Stats>::swap(map &x)
+    {
+        _tree.swap(x._tree);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void map<Key, T, Compare, Alloc, Layout, Stats>::clear()
+    {
+        _tree.clear();
+    };
+
+    // OBSERVERS ====================================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::key_compare map<Key, T, Compare, Alloc, Layout, Stats>::key_comp() const
+    {
+        return (_tree.value_comp().comp);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::value_compare map<Key, T, Compare, Alloc, Layout, Stats>::value_comp() const
+    {
+        return (_tree.value_comp());
+    };
+
+    // OPERATIONS ===================================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::iterator map<Key, T, Compare, Alloc, Layout, Stats>::find(const key_type &k)
+    {
+        return (iterator(_tree.search(k), _tree.end_node()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::const_iterator map<Key, T, Compare, Alloc, Layout, Stats>::find(const key_type &k) const
+    {
+        return (const_iterator(_tree.search(k), _tree.end_node()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::size_type map<Key, T, Compare, Alloc, Layout, Stats>::count(const key_type &k) const
+    {
+        return (_tree.search(k) == _tree.end_node() ? 0 : 1);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::iterator map<Key, T, Compare, Alloc, Layout, Stats>::lower_bound(const key_type &k)
+    {
+        return (iterator(_tree.lower_bound(k), _tree.end_node()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::const_iterator map<Key, T, Compare, Alloc, Layout, Stats>::lower_bound(const key_type &k) const
+    {
+        return (const_iterator(_tree.lower_bound(k), _tree.end_node()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::iterator map<Key, T, Compare, Alloc, Layout, Stats>::upper_bound(const key_type &k)
+    {
+        return (iterator(_tree.upper_bound(k), _tree.end_node()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::const_iterator map<Key, T, Compare, Alloc, Layout, Stats>::upper_bound(const key_type &k) const
+    {
+        return (const_iterator(_tree.upper_bound(k), _tree.end_node()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    ft::pair<typename map<Key, T, Compare, Alloc, Layout, Stats>::const_iterator, typename map<Key, T, Compare, Alloc, Layout, Stats>::const_iterator>
+    map<Key, T, Compare, Alloc, Layout, Stats>::equal_range(const key_type &k) const
+    {
+        return (ft::make_pair(lower_bound(k), upper_bound(k)));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    ft::pair<typename map<Key, T, Compare, Alloc, Layout, Stats>::iterator, typename map<Key, T, Compare, Alloc, Layout, Stats>::iterator>
+    map<Key, T, Compare, Alloc, Layout, Stats>::equal_range(const key_type &k)
+    {
+        return (ft::make_pair(lower_bound(k), upper_bound(k)));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::iterator map<Key, T, Compare, Alloc, Layout, Stats>::nth(size_type n)
+    {
+        return (iterator(_tree.select(n), _tree.end_node()));
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::const_iterator map<Key, T, Compare, Alloc, Layout, Stats>::nth(size_type n) const
+    {
+        return (const_iterator(_tree.select(n), _tree.end_node()));
+    };
+
+    template <class Visitor>
+    struct _const_visitor
+    {
+        Visitor *visitor;
+
+        _const_visitor(Visitor &v) : visitor(&v) {}
+
+        template <class Value>
+        bool operator()(const Value &value)
+        {
+            return ((*visitor)(value));
+        }
+    };
+
+    template <class Visitor, class Pointer, size_t Size>
+    struct _batch_visitor
+    {
+        Visitor *visitor;
+        Pointer values[Size];
+        size_t count;
+
+        _batch_visitor(Visitor &v) : visitor(&v), count(0) {}
+
+        template <class Value>
+        bool operator()(Value &value)
+        {
+            values[count++] = &value;
+            if (count < Size)
+                return (true);
+            return (flush());
+        }
+
+        bool flush()
+        {
+            size_t n = count;
+            count = 0;
+            return (n == 0 || (*visitor)(values, n));
+        }
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    template <class Visitor>
+    Visitor map<Key, T, Compare, Alloc, Layout, Stats>::for_each(const key_type &first_key, const key_type &last_key, Visitor visitor)
+    {
+        _tree.visit(first_key, last_key, visitor);
+        return (visitor);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    template <class Visitor>
+    Visitor map<Key, T, Compare, Alloc, Layout, Stats>::for_each(const key_type &first_key, const key_type &last_key, Visitor visitor) const
+    {
+        _const_visitor<Visitor> adapter(visitor);
+        _tree.visit(first_key, last_key, adapter);
+        return (visitor);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    template <class Visitor>
+    Visitor map<Key, T, Compare, Alloc, Layout, Stats>::for_each_batch(const key_type &first_key, const key_type &last_key, Visitor visitor)
+    {
+        _batch_visitor<Visitor, pointer, for_each_batch_size> batch(visitor);
+        if (_tree.visit(first_key, last_key, batch))
+            batch.flush();
+        return (visitor);
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    template <class Visitor>
+    Visitor map<Key, T, Compare, Alloc, Layout, Stats>::for_each_batch(const key_type &first_key, const key_type &last_key, Visitor visitor) const
+    {
+        _batch_visitor<Visitor, const_pointer, for_each_batch_size> batch(visitor);
+        if (_tree.visit(first_key, last_key, batch))
+            batch.flush();
+        return (visitor);
+    };
+
+    // ALLOCATOR ====================================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    typename map<Key, T, Compare, Alloc, Layout, Stats>::allocator_type map<Key, T, Compare, Alloc, Layout, Stats>::get_allocator() const
+    {
+        return (_tree.get_allocator());
+    };
+
+    // DIAGNOSTICS ==================================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    tree_shape map<Key, T, Compare, Alloc, Layout, Stats>::shape() const
+    {
+        return (_tree.shape());
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    const char *map<Key, T, Compare, Alloc, Layout, Stats>::validate() const
+    {
+        return (_tree.validate());
+    };
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void map<Key, T, Compare, Alloc, Layout, Stats>::set_counters(tree_counters *counters)
+    {
+        _tree.set_counters(counters);
+    };
+
+    // NON MEMBER OVERLOADS =======================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool operator==(const map<Key, T, Compare, Alloc, Layout, Stats> &lhs, const map<Key, T, Compare, Alloc, Layout, Stats> &rhs)
+    {
+        return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool operator!=(const map<Key, T, Compare, Alloc, Layout, Stats> &lhs, const map<Key, T, Compare, Alloc, Layout, Stats> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool operator<(const map<Key, T, Compare, Alloc, Layout, Stats> &lhs, const map<Key, T, Compare, Alloc, Layout, Stats> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool operator<=(const map<Key, T, Compare, Alloc, Layout, Stats> &lhs, const map<Key, T, Compare, Alloc, Layout, Stats> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool operator>(const map<Key, T, Compare, Alloc, Layout, Stats> &lhs, const map<Key, T, Compare, Alloc, Layout, Stats> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    bool operator>=(const map<Key, T, Compare, Alloc, Layout, Stats> &lhs, const map<Key, T, Compare, Alloc, Layout, Stats> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void swap(map<Key, T, Compare, Alloc, Layout, Stats> &x, map<Key, T, Compare, Alloc, Layout, Stats> &y)
+    {
+        x.swap(y);
+    }
+
+    // SET OPERATIONS =============================================================
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void set_union(const map<Key, T, Compare, Alloc, Layout, Stats> &a, const map<Key, T, Compare, Alloc, Layout, Stats> &b,
+                   map<Key, T, Compare, Alloc, Layout, Stats> &result)
+    {
+        ft::vector<ft::pair<Key, T> > sorted;
+        sorted.reserve(a.size() + b.size());
+        ft::set_union(a.begin(), a.end(), b.begin(), b.end(), ft::back_inserter(sorted), a.value_comp());
+        result.assign_sorted(sorted.begin(), sorted.end());
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void set_intersection(const map<Key, T, Compare, Alloc, Layout, Stats> &a, const map<Key, T, Compare, Alloc, Layout, Stats> &b,
+                          map<Key, T, Compare, Alloc, Layout, Stats> &result)
+    {
+        ft::vector<ft::pair<Key, T> > sorted;
+        sorted.reserve(a.size() < b.size() ? a.size() : b.size());
+        ft::set_intersection(a.begin(), a.end(), b.begin(), b.end(), ft::back_inserter(sorted), a.value_comp());
+        result.assign_sorted(sorted.begin(), sorted.end());
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void set_difference(const map<Key, T, Compare, Alloc, Layout, Stats> &a, const map<Key, T, Compare, Alloc, Layout, Stats> &b,
+                        map<Key, T, Compare, Alloc, Layout, Stats> &result)
+    {
+        ft::vector<ft::pair<Key, T> > sorted;
+        sorted.reserve(a.size());
+        ft::set_difference(a.begin(), a.end(), b.begin(), b.end(), ft::back_inserter(sorted), a.value_comp());
+        result.assign_sorted(sorted.begin(), sorted.end());
+    }
+
+    // PARALLEL OPERATIONS ========================================================
+
+    template <class Key, class T, class Compare>
+    struct _pair_key_compare
+    {
+        Compare comp;
+
+        _pair_key_compare(const Compare &c) : comp(c) {}
+
+        bool operator()(const ft::pair<Key, T> &x, const ft::pair<Key, T> &y) const
+        {
+            return (comp(x.first, y.first));
+        }
+    };
+
+    template <class Map, class RandomAccessIterator>
+    struct _assign_sorted_task
+    {
+        Map *part;
+        RandomAccessIterator first;
+        RandomAccessIterator last;
+        task_failure failure;
+
+        static void run(void *arg)
+        {
+            _assign_sorted_task *t = static_cast<_assign_sorted_task *>(arg);
+            try
+            {
+                t->part->assign_sorted(t->first, t->last);
+            }
+            catch (...)
+            {
+                t->failure.capture();
+            }
+        }
+    };
+
+    template <class Map>
+    struct _merge_map_task
+    {
+        Map *target;
+        Map *source;
+        task_failure failure;
+
+        static void run(void *arg)
+        {
+            _merge_map_task *t = static_cast<_merge_map_task *>(arg);
+            try
+            {
+                t->target->merge(*t->source);
+            }
+            catch (...)
+            {
+                t->failure.capture();
+            }
+        }
+    };
+
+    /**
+     * @brief Cuts target and source at the same keys into pieces parts each, moved into
+     * targets and sources in key order. The cuts are at evenly spaced ranks of source,
+     * whose size drives the cost of merging a pair of parts.
+     */
+    template <class Map>
+    void _split_parts(Map &target, Map &source, size_t pieces, Map *targets, Map *sources)
+    {
+        if (pieces == 1 || source.empty())
+        {
+            targets[0].swap(target);
+            sources[0].swap(source);
+            return;
+        }
+        size_t low = pieces / 2;
+        typename Map::key_type k = source.nth(source.size() * low / pieces)->first;
+        Map upper_target(target.key_comp(), target.get_allocator());
+        Map upper_source(source.key_comp(), source.get_allocator());
+        target.split_off(k, upper_target);
+        source.split_off(k, upper_source);
+        _split_parts(target, source, low, targets, sources);
+        _split_parts(upper_target, upper_source, pieces - low, targets + low, sources + low);
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats, class InputIterator>
+    void parallel_build(InputIterator first, InputIterator last, map<Key, T, Compare, Alloc, Layout, Stats> &result, thread_pool &pool)
+    {
+        typedef map<Key, T, Compare, Alloc, Layout, Stats> map_type;
+        typedef ft::vector<ft::pair<Key, T> > buffer_type;
+        typedef _assign_sorted_task<map_type, typename buffer_type::iterator> task_type;
+
+        Compare comp = result.key_comp();
+        buffer_type sorted;
+        for (; first != last; ++first)
+            sorted.push_back(*first);
+        ft::parallel_sort(sorted.begin(), sorted.end(), _pair_key_compare<Key, T, Compare>(comp), pool);
+        size_t kept = 0;
+        for (size_t i = 0; i < sorted.size(); i++)
+        {
+            if (kept != 0 && !comp(sorted[kept - 1].first, sorted[i].first))
+                continue;
+            if (kept != i)
+                sorted[kept] = sorted[i];
+            kept++;
+        }
+        sorted.erase(sorted.begin() + kept, sorted.end());
+
+        size_t pieces = pool.size();
+        if (pieces < 2 || kept < parallel_map_grain * pieces)
+            pieces = 1;
+        ft::vector<map_type> parts(pieces, map_type(comp, result.get_allocator()));
+        ft::vector<task_type> tasks(pieces);
+        for (size_t i = 0; i < pieces; i++)
+        {
+            tasks[i].part = &parts[i];
+            tasks[i].first = sorted.begin() + kept * i / pieces;
+            tasks[i].last = sorted.begin() + kept * (i + 1) / pieces;
+            if (pieces == 1)
+                parts[i].assign_sorted(tasks[i].first, tasks[i].last);
+            else
+                pool.submit(task_type::run, &tasks[i]);
+        }
+        pool.wait();
+        for (size_t i = 0; i < pieces; i++)
+            tasks[i].failure.rethrow();
+        result.swap(parts[0]);
+        for (size_t i = 1; i < pieces; i++)
+            result.append(parts[i]);
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats, class InputIterator>
+    void parallel_build(InputIterator first, InputIterator last, map<Key, T, Compare, Alloc, Layout, Stats> &result)
+    {
+        thread_pool pool;
+        ft::parallel_build(first, last, result, pool);
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void parallel_union(map<Key, T, Compare, Alloc, Layout, Stats> &target, map<Key, T, Compare, Alloc, Layout, Stats> &source, thread_pool &pool)
+    {
+        typedef map<Key, T, Compare, Alloc, Layout, Stats> map_type;
+        typedef _merge_map_task<map_type> task_type;
+
+        size_t pieces = pool.size();
+        if (pieces < 2 || &target == &source || target.empty() || source.size() < parallel_map_grain * pieces)
+        {
+            target.merge(source);
+            return;
+        }
+        map_type empty(target.key_comp(), target.get_allocator());
+        ft::vector<map_type> targets(pieces, empty);
+        ft::vector<map_type> sources(pieces, empty);
+        _split_parts(target, source, pieces, &targets[0], &sources[0]);
+        ft::vector<task_type> tasks(pieces);
+        for (size_t i = 0; i < pieces; i++)
+        {
+            tasks[i].target = &targets[i];
+            tasks[i].source = &sources[i];
+            pool.submit(task_type::run, &tasks[i]);
+        }
+        pool.wait();
+        target.swap(targets[0]);
+        source.swap(sources[0]);
+        for (size_t i = 1; i < pieces; i++)
+        {
+            target.append(targets[i]);
+            source.append(sources[i]);
+        }
+        for (size_t i = 0; i < pieces; i++)
+            tasks[i].failure.rethrow();
+    }
+
+    template <class Key, class T, class Compare, class Alloc, class Layout, class Stats>
+    void parallel_union(map<Key, T, Compare, Alloc, Layout, Stats> &target, map<Key, T, Compare, Alloc, Layout, Stats> &source)
+    {
+        if (source.size() < parallel_map_grain * 2)
+        {
+            target.merge(source);
+            return;
+        }
+        thread_pool pool;
+        ft::parallel_union(target, source, pool);
+    }
 }
 
-#endif // ********************************************** MAP_TPP end //
\ No newline at end of file
+#endif // ********************************************** MAP_TPP end //
@@ -0,0 +1,198 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+// LIBS ========================================================================
+#include <cstddef>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace ft
+{
+    // CLASS =======================================================================
+
+    /**
+     * @brief A file descriptor and one shared mapping of the whole file.
+     *
+     * Writable files are mapped MAP_SHARED, so stores land in the page cache and reach
+     * the disk on sync() or whenever the kernel writes them back. Read-only files are
+     * mapped PROT_READ, and every process opening the same file shares its pages.
+     * Errors are reported as std::runtime_error carrying the path and strerror(errno).
+     */
+    class mapped_file
+    {
+    public:
+        enum open_mode
+        {
+            read_only,
+            open_existing,
+            create,
+            open_or_create
+        };
+
+        mapped_file() : _fd(-1), _addr(NULL), _length(0), _writable(false) {}
+
+        ~mapped_file()
+        {
+            close();
+        }
+
+        /**
+         * @brief Opens path and maps its current content. create truncates the file,
+         * open_existing and read_only fail when it is missing.
+         *
+         */
+        void open(const std::string &path, open_mode mode)
+        {
+            close();
+            int flags = O_RDWR;
+            if (mode == read_only)
+                flags = O_RDONLY;
+            else if (mode == create)
+                flags |= O_CREAT | O_TRUNC;
+            else if (mode == open_or_create)
+                flags |= O_CREAT;
+            _path = path;
+            _fd = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+            if (_fd < 0)
+                _fail("open");
+            _writable = mode != read_only;
+            struct stat st;
+            if (fstat(_fd, &st) != 0)
+                _fail("fstat");
+            _map(static_cast<size_t>(st.st_size));
+        }
+
+        /**
+         * @brief Sets the file length, keeping its content up to the smaller length.
+         * The mapping may move.
+         *
+         */
+        void resize(size_t length)
+        {
+            if (!_writable)
+                throw std::runtime_error("mapped_file: " + _path + " is not writable");
+            if (ftruncate(_fd, static_cast<off_t>(length)) != 0)
+                _fail("ftruncate");
+            if (_addr && length)
+            {
+#ifdef MREMAP_MAYMOVE
+                void *addr = mremap(_addr, _length, length, MREMAP_MAYMOVE);
+                if (addr == MAP_FAILED)
+                    _fail("mremap");
+                _addr = addr;
+                _length = length;
+                return;
+#endif
+            }
+            _unmap();
+            _map(length);
+        }
+
+        /**
+         * @brief Flushes the first length bytes of the mapping to the file, all of it by
+         * default, and waits for the write unless async.
+         *
+         */
+        void sync(size_t length = static_cast<size_t>(-1), bool async = false)
+        {
+            if (!_addr || !_writable)
+                return;
+            if (msync(_addr, length < _length ? length : _length, async ? MS_ASYNC : MS_SYNC) != 0)
+                _fail("msync");
+        }
+
+        /**
+         * @brief Unmaps and closes the file. Unsynced stores still reach it later.
+         *
+         */
+        void close()
+        {
+            _unmap();
+            if (_fd >= 0)
+                ::close(_fd);
+            _fd = -1;
+            _writable = false;
+        }
+
+        /**
+         * @brief Hints the kernel about the access pattern of the whole mapping.
+         *
+         */
+        void advise(int advice) const
+        {
+            if (_addr)
+                madvise(_addr, _length, advice);
+        }
+
+        void swap(mapped_file &x)
+        {
+            std::swap(_fd, x._fd);
+            std::swap(_addr, x._addr);
+            std::swap(_length, x._length);
+            std::swap(_writable, x._writable);
+            _path.swap(x._path);
+        }
+
+        bool is_open() const { return _fd >= 0; }
+        bool writable() const { return _writable; }
+        void *data() const { return _addr; }
+        size_t size() const { return _length; }
+        const std::string &path() const { return _path; }
+
+        static size_t page_size()
+        {
+            static size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            return size;
+        }
+
+    private:
+        int _fd;
+        void *_addr;
+        size_t _length;
+        bool _writable;
+        std::string _path;
+
+        mapped_file(const mapped_file &);
+        mapped_file &operator=(const mapped_file &);
+
+        void _map(size_t length)
+        {
+            _length = length;
+            if (length == 0)
+                return;
+            int prot = _writable ? PROT_READ | PROT_WRITE : PROT_READ;
+            void *addr = mmap(NULL, length, prot, MAP_SHARED, _fd, 0);
+            if (addr == MAP_FAILED)
+            {
+                _length = 0;
+                _fail("mmap");
+            }
+            _addr = addr;
+        }
+
+        void _unmap()
+        {
+            if (_addr)
+                munmap(_addr, _length);
+            _addr = NULL;
+            _length = 0;
+        }
+
+        void _fail(const char *call)
+        {
+            std::string message = "mapped_file: " + std::string(call) + " " + _path + ": " + std::strerror(errno);
+            if (!_addr)
+                close();
+            throw std::runtime_error(message);
+        }
+    };
+} // namespace ft
+
+#endif // ********************************************** MAPPED_FILE_HPP end //
@@ -0,0 +1,325 @@
+#ifndef MAPPED_MAP_VIEW_HPP
+#define MAPPED_MAP_VIEW_HPP
+
+// LIBS ========================================================================
+#include <cstddef>
+#include <string>
+#include <functional>
+#include "./iterator_traits.hpp"
+#include "./mapped_file.hpp"
+#include "./serialize.hpp"
+
+namespace ft
+{
+    // FORMAT ======================================================================
+
+    /**
+     * @brief First 64 bytes of a map image. Sections follow in order: count sorted keys
+     * at keys_offset, count + 1 offsets of 8 bytes into the value blob, then the blob.
+     *
+     */
+    struct map_image_header
+    {
+        char magic[8];
+        unsigned int version;
+        unsigned int key_size;
+        unsigned int value_kind;
+        unsigned int value_size;
+        unsigned long long count;
+        unsigned long long keys_offset;
+        unsigned long long offsets_offset;
+        unsigned long long values_offset;
+        unsigned long long values_size;
+    };
+
+    /**
+     * @brief Bytes of a string value inside a mapped image.
+     *
+     */
+    struct byte_view
+    {
+        const char *data;
+        size_t size;
+
+        byte_view(const char *data, size_t size) : data(data), size(size) {}
+
+        std::string str() const { return std::string(data, size); }
+
+        bool operator==(const std::string &other) const
+        {
+            return size == other.size() && std::memcmp(data, other.data(), size) == 0;
+        }
+
+        bool operator!=(const std::string &other) const { return !(*this == other); }
+    };
+
+    /**
+     * @brief How values of type V are laid out in the blob and read back. Bitwise
+     * serializable values are stored as their bytes and read in place; std::string is
+     * stored as its characters and read as a byte_view.
+     *
+     */
+    template <typename V, typename Enable = void>
+    struct map_image_value;
+
+    template <typename V>
+    struct map_image_value<V, typename ft::enable_if<void, bitwise_serializable<V>::value>::type>
+    {
+        typedef const V &reference;
+        static const unsigned int kind = 1;
+        static const unsigned int fixed_size = sizeof(V);
+
+        static size_t size(const V &) { return sizeof(V); }
+        static void write(fd_writer &out, const V &val) { out.write(&val, sizeof(V)); }
+        static reference view(const char *data, size_t) { return *reinterpret_cast<const V *>(data); }
+    };
+
+    template <>
+    struct map_image_value<std::string>
+    {
+        typedef byte_view reference;
+        static const unsigned int kind = 2;
+        static const unsigned int fixed_size = 0;
+
+        static size_t size(const std::string &val) { return val.size(); }
+        static void write(fd_writer &out, const std::string &val) { out.write(val.data(), val.size()); }
+        static reference view(const char *data, size_t size) { return byte_view(data, size); }
+    };
+
+    // ITERATORS ===================================================================
+
+    /**
+     * @brief What a mapped_map_view iterator points to: a copy of the key and a view of
+     * the value in the mapped pages.
+     *
+     */
+    template <typename Key, typename Reference>
+    struct map_image_entry
+    {
+        Key first;
+        Reference second;
+
+        map_image_entry(const Key &key, Reference value) : first(key), second(value) {}
+    };
+
+    /**
+     * @brief Random access iterator over the entries of a mapped_map_view, by index.
+     * Entries are built on dereference, so operator-> goes through a proxy.
+     *
+     */
+    template <typename View>
+    class map_image_iterator
+    {
+    public:
+        typedef typename View::entry_type value_type;
+        typedef value_type reference;
+        typedef ptrdiff_t difference_type;
+        typedef ft::random_access_iterator_tag iterator_category;
+
+        struct pointer
+        {
+            value_type entry;
+
+            explicit pointer(const value_type &entry) : entry(entry) {}
+            const value_type *operator->() const { return &entry; }
+        };
+
+        map_image_iterator() : _view(NULL), _index(0) {}
+        map_image_iterator(const View *view, size_t index) : _view(view), _index(index) {}
+
+        reference operator*() const { return _view->entry_at(_index); }
+        pointer operator->() const { return pointer(_view->entry_at(_index)); }
+        reference operator[](difference_type n) const { return _view->entry_at(_index + n); }
+
+        const typename View::key_type &key() const { return _view->key_at(_index); }
+        typename View::value_reference value() const { return _view->value_at(_index); }
+        size_t index() const { return _index; }
+
+        map_image_iterator &operator++()
+        {
+            _index++;
+            return *this;
+        }
+
+        map_image_iterator operator++(int)
+        {
+            map_image_iterator tmp(*this);
+            _index++;
+            return tmp;
+        }
+
+        map_image_iterator &operator--()
+        {
+            _index--;
+            return *this;
+        }
+
+        map_image_iterator operator--(int)
+        {
+            map_image_iterator tmp(*this);
+            _index--;
+            return tmp;
+        }
+
+        map_image_iterator &operator+=(difference_type n)
+        {
+            _index += n;
+            return *this;
+        }
+
+        map_image_iterator &operator-=(difference_type n)
+        {
+            _index -= n;
+            return *this;
+        }
+
+        map_image_iterator operator+(difference_type n) const { return map_image_iterator(_view, _index + n); }
+        map_image_iterator operator-(difference_type n) const { return map_image_iterator(_view, _index - n); }
+        difference_type operator-(const map_image_iterator &other) const { return _index - other._index; }
+
+        bool operator==(const map_image_iterator &other) const { return _index == other._index; }
+        bool operator!=(const map_image_iterator &other) const { return _index != other._index; }
+        bool operator<(const map_image_iterator &other) const { return _index < other._index; }
+        bool operator>(const map_image_iterator &other) const { return _index > other._index; }
+        bool operator<=(const map_image_iterator &other) const { return _index <= other._index; }
+        bool operator>=(const map_image_iterator &other) const { return _index >= other._index; }
+
+    private:
+        const View *_view;
+        size_t _index;
+    };
+
+    // CLASS =======================================================================
+
+    /**
+     * @brief Read-only sorted map answered straight from a file written by
+     * write_map_image().
+     *
+     * Opening maps the file and checks its header and section bounds, nothing else:
+     * lookups binary search the key array in the mapped pages and values are read in
+     * place, so there is no deserialization and no heap allocation per entry. Pages are
+     * mapped read-only and shared by every process that opens the same file.
+     *
+     * @tparam Key Bitwise serializable key type, stored as its bytes.
+     * @tparam V Bitwise serializable value type, or std::string read as byte_view.
+     * @tparam Compare The order the image was written in.
+     */
+    template <class Key, class V, class Compare = std::less<Key> >
+    class mapped_map_view
+    {
+    public:
+        // MEMBER TYPES ========================================================
+        typedef Key key_type;
+        typedef V mapped_type;
+        typedef Compare key_compare;
+        typedef size_t size_type;
+        typedef map_image_value<V> value_traits;
+        typedef typename value_traits::reference value_reference;
+        typedef map_image_entry<Key, value_reference> entry_type;
+        typedef map_image_iterator<mapped_map_view> iterator;
+        typedef iterator const_iterator;
+
+        static const unsigned int version = 1;
+
+    private:
+        /**
+         * @brief Keys are read as the bytes the writer stored: a key type holding
+         * pointers would point into another process.
+         */
+        typedef char _key_must_be_bitwise[bitwise_serializable<Key>::value ? 1 : -1];
+
+        // ATTRIBUTES ==========================================================
+        mapped_file _file;
+        const Key *_keys;
+        const unsigned long long *_offsets;
+        const char *_values;
+        unsigned long long _values_size;
+        size_type _size;
+        key_compare _comp;
+
+    public:
+        // CONSTRUCTORS ========================================================
+
+        explicit mapped_map_view(const key_compare &comp = key_compare());
+
+        /**
+         * @brief Opens the image at path, see open().
+         *
+         */
+        explicit mapped_map_view(const std::string &path, const key_compare &comp = key_compare());
+
+        // FILE ================================================================
+
+        /**
+         * @brief Maps the image at path. Throws std::runtime_error when it cannot be
+         * mapped, was written for other key or value types, or has sections out of
+         * the file.
+         *
+         */
+        void open(const std::string &path);
+        void close();
+        bool is_open() const;
+
+        // ITERATORS ===========================================================
+
+        iterator begin() const;
+        iterator end() const;
+
+        // CAPACITY ============================================================
+
+        bool empty() const;
+        size_type size() const;
+
+        // LOOKUP ==============================================================
+
+        iterator find(const key_type &k) const;
+        size_type count(const key_type &k) const;
+        iterator lower_bound(const key_type &k) const;
+        iterator upper_bound(const key_type &k) const;
+
+        /**
+         * @brief Returns the value of k, throws std::out_of_range if k is missing.
+         *
+         */
+        value_reference at(const key_type &k) const;
+
+        // ENTRIES =============================================================
+
+        const key_type &key_at(size_type i) const;
+
+        /**
+         * @brief Value of the i-th entry. Throws std::runtime_error if its offsets fall
+         * outside the value blob.
+         *
+         */
+        value_reference value_at(size_type i) const;
+        entry_type entry_at(size_type i) const;
+
+        key_compare key_comp() const;
+
+    private:
+        mapped_map_view(const mapped_map_view &);
+        mapped_map_view &operator=(const mapped_map_view &);
+    };
+
+    // WRITERS =====================================================================
+
+    /**
+     * @brief Writes the sorted range [first, last) of pairs as a map image, through a
+     * temporary file renamed over path, so that views already open keep the old image.
+     * Throws std::invalid_argument if the keys are not strictly increasing for comp.
+     *
+     */
+    template <class ForwardIterator, class Compare>
+    void write_map_image(const std::string &path, ForwardIterator first, ForwardIterator last, Compare comp);
+
+    template <class ForwardIterator>
+    void write_map_image(const std::string &path, ForwardIterator first, ForwardIterator last);
+
+    template <class Key, class V, class Compare, class Alloc, class Layout, class Stats>
+    void write_map_image(const std::string &path, const ft::map<Key, V, Compare, Alloc, Layout, Stats> &map);
+} // namespace ft
+
+#include "mapped_map_view.tpp"
+
+#endif // ********************************************** MAPPED_MAP_VIEW_HPP end //
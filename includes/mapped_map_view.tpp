@@ -0,0 +1,292 @@
+#ifndef MAPPED_MAP_VIEW_TPP
+#define MAPPED_MAP_VIEW_TPP
+
+#include <cstring>
+#include <stdexcept>
+#include "mapped_map_view.hpp"
+
+namespace ft
+{
+    // CONSTRUCTORS =================================================================
+
+    template <class Key, class V, class Compare>
+    mapped_map_view<Key, V, Compare>::mapped_map_view(const key_compare &comp)
+        : _keys(NULL), _offsets(NULL), _values(NULL), _values_size(0), _size(0), _comp(comp)
+    {
+    };
+
+    template <class Key, class V, class Compare>
+    mapped_map_view<Key, V, Compare>::mapped_map_view(const std::string &path, const key_compare &comp)
+        : _keys(NULL), _offsets(NULL), _values(NULL), _values_size(0), _size(0), _comp(comp)
+    {
+        open(path);
+    };
+
+    // FILE =========================================================================
+
+    template <class Key, class V, class Compare>
+    void mapped_map_view<Key, V, Compare>::open(const std::string &path)
+    {
+        close();
+        _file.open(path, mapped_file::read_only);
+        const map_image_header *header = static_cast<const map_image_header *>(_file.data());
+        unsigned long long length = _file.size();
+        if (length < sizeof(map_image_header) || std::memcmp(header->magic, "ftmapimg", sizeof(header->magic)) != 0 ||
+            header->version != version || header->key_size != sizeof(Key) ||
+            header->value_kind != value_traits::kind || header->value_size != value_traits::fixed_size ||
+            header->count > length / sizeof(Key) || header->count >= length / sizeof(unsigned long long) ||
+            header->keys_offset > length - header->count * sizeof(Key) || header->keys_offset % sizeof(unsigned long long) ||
+            header->offsets_offset > length - (header->count + 1) * sizeof(unsigned long long) ||
+            header->offsets_offset % sizeof(unsigned long long) ||
+            header->values_offset > length || header->values_size > length - header->values_offset)
+        {
+            _file.close();
+            throw std::runtime_error("mapped_map_view: " + path + " is not a map image of these types");
+        }
+        const char *base = static_cast<const char *>(_file.data());
+        _keys = reinterpret_cast<const Key *>(base + header->keys_offset);
+        _offsets = reinterpret_cast<const unsigned long long *>(base + header->offsets_offset);
+        _values = base + header->values_offset;
+        _values_size = header->values_size;
+        _size = static_cast<size_type>(header->count);
+    };
+
+    template <class Key, class V, class Compare>
+    void mapped_map_view<Key, V, Compare>::close()
+    {
+        _file.close();
+        _keys = NULL;
+        _offsets = NULL;
+        _values = NULL;
+        _values_size = 0;
+        _size = 0;
+    };
+
+    template <class Key, class V, class Compare>
+    bool mapped_map_view<Key, V, Compare>::is_open() const
+    {
+        return (_file.is_open());
+    };
+
+    // ITERATORS ====================================================================
+
+    template <class Key, class V, class Compare>
+    typename mapped_map_view<Key, V, Compare>::iterator mapped_map_view<Key, V, Compare>::begin() const
+    {
+        return (iterator(this, 0));
+    };
+
+    template <class Key, class V, class Compare>
+    typename mapped_map_view<Key, V, Compare>::iterator mapped_map_view<Key, V, Compare>::end() const
+    {
+        return (iterator(this, _size));
+    };
+
+    // CAPACITY ===============================================================
+
+    template <class Key, class V, class Compare>
+    bool mapped_map_view<Key, V, Compare>::empty() const
+    {
+        return (_size == 0);
+    };
+
+    template <class Key, class V, class Compare>
+    typename mapped_map_view<Key, V, Compare>::size_type mapped_map_view<Key, V, Compare>::size() const
+    {
+        return (_size);
+    };
+
+    // LOOKUP =======================================================================
+
+    template <class Key, class V, class Compare>
+    typename mapped_map_view<Key, V, Compare>::iterator mapped_map_view<Key, V, Compare>::lower_bound(const key_type &k) const
+    {
+        size_type first = 0;
+        size_type count = _size;
+        while (count > 0)
+        {
+            size_type half = count / 2;
+            if (_comp(_keys[first + half], k))
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+                count = half;
+        }
+        return (iterator(this, first));
+    };
+
+    template <class Key, class V, class Compare>
+    typename mapped_map_view<Key, V, Compare>::iterator mapped_map_view<Key, V, Compare>::upper_bound(const key_type &k) const
+    {
+        size_type first = 0;
+        size_type count = _size;
+        while (count > 0)
+        {
+            size_type half = count / 2;
+            if (!_comp(k, _keys[first + half]))
+            {
+                first += half + 1;
+                count -= half + 1;
+            }
+            else
+                count = half;
+        }
+        return (iterator(this, first));
+    };
+
+    template <class Key, class V, class Compare>
+    typename mapped_map_view<Key, V, Compare>::iterator mapped_map_view<Key, V, Compare>::find(const key_type &k) const
+    {
+        iterator it = lower_bound(k);
+        if (it == end() || _comp(k, _keys[it.index()]))
+            return (end());
+        return (it);
+    };
+
+    template <class Key, class V, class Compare>
+    typename mapped_map_view<Key, V, Compare>::size_type mapped_map_view<Key, V, Compare>::count(const key_type &k) const
+    {
+        return (find(k) == end() ? 0 : 1);
+    };
+
+    template <class Key, class V, class Compare>
+    typename mapped_map_view<Key, V, Compare>::value_reference mapped_map_view<Key, V, Compare>::at(const key_type &k) const
+    {
+        iterator it = find(k);
+        if (it == end())
+            throw std::out_of_range("mapped_map_view::at");
+        return (value_at(it.index()));
+    };
+
+    // ENTRIES ======================================================================
+
+    template <class Key, class V, class Compare>
+    const typename mapped_map_view<Key, V, Compare>::key_type &mapped_map_view<Key, V, Compare>::key_at(size_type i) const
+    {
+        return (_keys[i]);
+    };
+
+    template <class Key, class V, class Compare>
+    typename mapped_map_view<Key, V, Compare>::value_reference mapped_map_view<Key, V, Compare>::value_at(size_type i) const
+    {
+        unsigned long long begin = _offsets[i];
+        unsigned long long end = _offsets[i + 1];
+        if (begin > end || end > _values_size || (value_traits::fixed_size && end - begin != value_traits::fixed_size))
+            throw std::runtime_error("mapped_map_view: corrupt value offsets");
+        return (value_traits::view(_values + begin, static_cast<size_t>(end - begin)));
+    };
+
+    template <class Key, class V, class Compare>
+    typename mapped_map_view<Key, V, Compare>::entry_type mapped_map_view<Key, V, Compare>::entry_at(size_type i) const
+    {
+        return (entry_type(_keys[i], value_at(i)));
+    };
+
+    template <class Key, class V, class Compare>
+    typename mapped_map_view<Key, V, Compare>::key_compare mapped_map_view<Key, V, Compare>::key_comp() const
+    {
+        return (_comp);
+    };
+
+    // WRITERS ======================================================================
+
+    /**
+     * @brief Pads the stream with zeros up to the next multiple of 64.
+     *
+     */
+    inline unsigned long long map_image_pad(fd_writer &out, unsigned long long offset)
+    {
+        static const char zeros[64] = {0};
+        unsigned long long aligned = (offset + 63) / 64 * 64;
+        out.write(zeros, static_cast<size_t>(aligned - offset));
+        return (aligned);
+    }
+
+    /**
+     * @brief Writes the image laid out by header: keys, value offsets, then values.
+     *
+     */
+    template <class ForwardIterator, class ValueTraits>
+    struct _map_image_writer
+    {
+        typedef typename ft::iterator_traits<ForwardIterator>::value_type pair_type;
+        typedef typename pair_type::first_type key_type;
+
+        const map_image_header &header;
+        ForwardIterator first;
+        ForwardIterator last;
+
+        _map_image_writer(const map_image_header &h, ForwardIterator f, ForwardIterator l) : header(h), first(f), last(l) {}
+
+        void operator()(fd_writer &out) const
+        {
+            out.write(&header, sizeof(header));
+            for (ForwardIterator it = first; it != last; ++it)
+            {
+                key_type key = (*it).first;
+                out.write(&key, sizeof(key));
+            }
+            map_image_pad(out, header.keys_offset + header.count * sizeof(key_type));
+            unsigned long long offset = 0;
+            for (ForwardIterator it = first; it != last; ++it)
+            {
+                out.write(&offset, sizeof(offset));
+                offset += ValueTraits::size((*it).second);
+            }
+            out.write(&offset, sizeof(offset));
+            map_image_pad(out, header.offsets_offset + (header.count + 1) * sizeof(unsigned long long));
+            for (ForwardIterator it = first; it != last; ++it)
+                ValueTraits::write(out, (*it).second);
+        }
+    };
+
+    template <class ForwardIterator, class Compare>
+    void write_map_image(const std::string &path, ForwardIterator first, ForwardIterator last, Compare comp)
+    {
+        typedef typename ft::iterator_traits<ForwardIterator>::value_type pair_type;
+        typedef typename pair_type::first_type key_type;
+        typedef typename pair_type::second_type mapped_type;
+        typedef map_image_value<mapped_type> value_traits;
+        typedef char key_must_be_bitwise[bitwise_serializable<key_type>::value ? 1 : -1];
+        (void)sizeof(key_must_be_bitwise);
+
+        map_image_header header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, "ftmapimg", sizeof(header.magic));
+        header.version = mapped_map_view<key_type, mapped_type, Compare>::version;
+        header.key_size = sizeof(key_type);
+        header.value_kind = value_traits::kind;
+        header.value_size = value_traits::fixed_size;
+        for (ForwardIterator it = first; it != last; ++it)
+        {
+            ForwardIterator next = it;
+            if (++next != last && !comp((*it).first, (*next).first))
+                throw std::invalid_argument("write_map_image: range is not sorted by unique keys");
+            header.count++;
+            header.values_size += value_traits::size((*it).second);
+        }
+        header.keys_offset = sizeof(map_image_header);
+        header.offsets_offset = (header.keys_offset + header.count * sizeof(key_type) + 63) / 64 * 64;
+        header.values_offset = (header.offsets_offset + (header.count + 1) * sizeof(unsigned long long) + 63) / 64 * 64;
+
+        _map_image_writer<ForwardIterator, value_traits> writer(header, first, last);
+        write_file_atomically(path, "write_map_image", writer);
+    }
+
+    template <class ForwardIterator>
+    void write_map_image(const std::string &path, ForwardIterator first, ForwardIterator last)
+    {
+        typedef typename ft::iterator_traits<ForwardIterator>::value_type pair_type;
+        write_map_image(path, first, last, std::less<typename pair_type::first_type>());
+    }
+
+    template <class Key, class V, class Compare, class Alloc, class Layout, class Stats>
+    void write_map_image(const std::string &path, const ft::map<Key, V, Compare, Alloc, Layout, Stats> &map)
+    {
+        write_map_image(path, map.begin(), map.end(), map.key_comp());
+    }
+}
+
+#endif // ********************************************** MAPPED_MAP_VIEW_TPP end //
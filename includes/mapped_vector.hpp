@@ -0,0 +1,226 @@
+#ifndef MAPPED_VECTOR_HPP
+#define MAPPED_VECTOR_HPP
+
+// LIBS ========================================================================
+#include <cstddef>
+#include <string>
+#include "./utils.hpp"
+#include "./iterator.hpp"
+#include "./algorithm.hpp"
+#include "./mapped_file.hpp"
+
+namespace ft
+{
+    // HEADER ======================================================================
+
+    /**
+     * @brief First 64 bytes of a mapped_vector file. The elements follow it, so any
+     * element alignment up to a cache line is kept.
+     *
+     */
+    struct mapped_vector_header
+    {
+        char magic[8];
+        unsigned int version;
+        unsigned int value_size;
+        unsigned long long size;
+        char reserved[40];
+    };
+
+    // CLASS =======================================================================
+
+    /**
+     * @brief Vector of trivially copyable elements stored in a memory-mapped file.
+     *
+     * The elements live in the file's pages: opening an existing file maps it and is
+     * done, without reading or copying anything, and elements are loaded by page faults
+     * as they are touched. Growing the vector extends the file with ftruncate and the
+     * mapping with mremap, doubling the capacity like ft::vector.
+     *
+     * The element count is written to the file header by sync() and close(), which the
+     * destructor calls; sync() also flushes the pages to disk. A process that crashes
+     * after its last sync() reopens with the size of that sync().
+     *
+     * T must be trivially copyable and hold no pointers: elements are moved with
+     * memmove, never constructed or destroyed, and read back by other processes. The
+     * file is owned by one object, so the vector cannot be copied.
+     *
+     * @tparam T Element type.
+     */
+    template <typename T>
+    class mapped_vector
+    {
+    public:
+        // TYPEDEFS ==================================================================
+        typedef T value_type;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef ptrdiff_t difference_type;
+        typedef size_t size_type;
+        typedef mapped_file::open_mode open_mode;
+
+        static const unsigned int version = 1;
+        static const size_type header_size = sizeof(mapped_vector_header);
+
+        // ITERATORS =================================================================
+        typedef ft::random_access_iterator<pointer> iterator;
+        typedef ft::random_access_iterator<const_pointer> const_iterator;
+        typedef ft::reverse_iterator<iterator> reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    private:
+        // ATTRIBUTES =================================================================
+        mapped_file _file;
+        pointer _data;
+        size_type _size;
+        size_type _capacity;
+
+    public:
+        // CONSTRUCTORS ==========================================================
+
+        /**
+         * @brief A vector with no file. It can only be opened.
+         *
+         */
+        mapped_vector();
+
+        /**
+         * @brief Opens path, see open().
+         *
+         */
+        explicit mapped_vector(const std::string &path, open_mode mode = mapped_file::open_or_create);
+
+        // DESTRUCTOR =============================================================
+
+        /**
+         * @brief Closes the file, recording its size. Pages are written back by the
+         * kernel, call sync() first to wait for them.
+         *
+         */
+        ~mapped_vector();
+
+        // FILE ==================================================================
+
+        /**
+         * @brief Maps the vector stored at path, or starts an empty one when the file is
+         * new or truncated by create. Throws std::runtime_error if the file cannot be
+         * mapped or holds another kind of data, and std::invalid_argument for read_only.
+         *
+         */
+        void open(const std::string &path, open_mode mode = mapped_file::open_or_create);
+
+        /**
+         * @brief Records the size and flushes the elements to disk.
+         *
+         */
+        void sync();
+
+        /**
+         * @brief Records the size and unmaps the file. The vector is then empty.
+         *
+         */
+        void close();
+
+        bool is_open() const;
+
+        // ITERATORS =============================================================
+
+        iterator begin();
+        const_iterator begin() const;
+        iterator end();
+        const_iterator end() const;
+        reverse_iterator rbegin();
+        const_reverse_iterator rbegin() const;
+        reverse_iterator rend();
+        const_reverse_iterator rend() const;
+
+        // CAPACITY ===============================================================
+
+        size_type size() const;
+        size_type max_size() const;
+        void resize(size_type n, value_type val = value_type());
+        size_type capacity() const;
+        bool empty(void) const;
+
+        /**
+         * @brief Extends the file so that it holds at least n elements, rounded up to a
+         * whole page. Throws std::runtime_error when no file is open.
+         *
+         */
+        void reserve(size_type n);
+
+        // ELEMENT ACCESS =============================================================
+
+        reference operator[](size_type n);
+        const_reference operator[](size_type n) const;
+        reference at(size_type n);
+        const_reference at(size_type n) const;
+        reference front();
+        const_reference front() const;
+        reference back();
+        const_reference back() const;
+        pointer data();
+        const_pointer data() const;
+
+        // MODIFIERS =============================================================
+
+        template <class InputIterator>
+        void assign(InputIterator first, InputIterator last,
+                    typename ft::enable_if<InputIterator, !ft::is_integral<InputIterator>::value>::type * = NULL);
+        void assign(size_type n, const value_type &val);
+        void push_back(const value_type &val);
+        void pop_back();
+        iterator insert(iterator position, const value_type &val);
+        void insert(iterator position, size_type n, const value_type &val);
+        template <class InputIterator>
+        void insert(iterator position, InputIterator first, InputIterator last,
+                    typename ft::enable_if<InputIterator, !ft::is_integral<InputIterator>::value>::type * = NULL);
+        iterator erase(iterator position);
+        iterator erase(iterator first, iterator last);
+        void swap(mapped_vector &x);
+
+        /**
+         * @brief Removes every element. The file keeps its length.
+         *
+         */
+        void clear();
+
+    private:
+        mapped_vector(const mapped_vector &);
+        mapped_vector &operator=(const mapped_vector &);
+
+        mapped_vector_header *_header() const;
+        void _attach();
+        size_type _make_room(size_type pos, size_type n);
+    };
+
+    // NON MEMBER OVERLOADS ======================================================
+
+    template <typename T>
+    bool operator==(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs);
+
+    template <typename T>
+    bool operator!=(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs);
+
+    template <typename T>
+    bool operator<(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs);
+
+    template <typename T>
+    bool operator<=(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs);
+
+    template <typename T>
+    bool operator>(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs);
+
+    template <typename T>
+    bool operator>=(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs);
+
+    template <typename T>
+    void swap(mapped_vector<T> &x, mapped_vector<T> &y);
+
+} // namespace ft
+
+#include "mapped_vector.tpp"
+
+#endif // ********************************************** MAPPED_VECTOR_HPP end //
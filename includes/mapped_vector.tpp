@@ -0,0 +1,454 @@
+#ifndef MAPPED_VECTOR_TPP
+#define MAPPED_VECTOR_TPP
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include "mapped_vector.hpp"
+
+namespace ft
+{
+    // CONSTRUCTORS =================================================================
+
+    template <typename T>
+    mapped_vector<T>::mapped_vector() : _data(NULL), _size(0), _capacity(0)
+    {
+    };
+
+    template <typename T>
+    mapped_vector<T>::mapped_vector(const std::string &path, open_mode mode) : _data(NULL), _size(0), _capacity(0)
+    {
+        open(path, mode);
+    };
+
+    // DESTRUCTOR ==================================================================
+
+    template <typename T>
+    mapped_vector<T>::~mapped_vector()
+    {
+        close();
+    };
+
+    // FILE =========================================================================
+
+    template <typename T>
+    void mapped_vector<T>::open(const std::string &path, open_mode mode)
+    {
+        if (mode == mapped_file::read_only)
+            throw std::invalid_argument("mapped_vector: read_only files cannot be modified");
+        close();
+        _file.open(path, mode);
+        try
+        {
+            if (_file.size() == 0)
+            {
+                _file.resize(mapped_file::page_size());
+                mapped_vector_header *header = _header();
+                std::memset(header, 0, header_size);
+                std::memcpy(header->magic, "ftmapvec", sizeof(header->magic));
+                header->version = version;
+                header->value_size = sizeof(value_type);
+                header->size = 0;
+            }
+            mapped_vector_header *header = _header();
+            if (_file.size() < header_size || std::memcmp(header->magic, "ftmapvec", sizeof(header->magic)) != 0 ||
+                header->version != version || header->value_size != sizeof(value_type) ||
+                header->size > (_file.size() - header_size) / sizeof(value_type))
+                throw std::runtime_error("mapped_vector: " + path + " does not hold elements of this size");
+            _size = header->size;
+            _attach();
+        }
+        catch (...)
+        {
+            _file.close();
+            throw;
+        }
+    };
+
+    /**
+     * @brief Flushes the elements first and the header last, so that the size on disk
+     * never counts elements that did not reach it.
+     *
+     */
+    template <typename T>
+    void mapped_vector<T>::sync()
+    {
+        if (!_file.is_open())
+            return;
+        _file.sync(header_size + _size * sizeof(value_type));
+        _header()->size = _size;
+        _file.sync(header_size);
+    };
+
+    template <typename T>
+    void mapped_vector<T>::close()
+    {
+        if (_file.is_open())
+            _header()->size = _size;
+        _file.close();
+        _data = NULL;
+        _size = 0;
+        _capacity = 0;
+    };
+
+    template <typename T>
+    bool mapped_vector<T>::is_open() const
+    {
+        return (_file.is_open());
+    };
+
+    // NON MEMBER OVERLOADS =======================================================
+
+    template <typename T>
+    bool operator==(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+        return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    };
+
+    template <typename T>
+    bool operator!=(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <typename T>
+    bool operator<(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename T>
+    bool operator<=(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <typename T>
+    bool operator>(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <typename T>
+    bool operator>=(const mapped_vector<T> &lhs, const mapped_vector<T> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template <typename T>
+    void swap(mapped_vector<T> &x, mapped_vector<T> &y)
+    {
+        x.swap(y);
+    }
+
+    // MODIFIERS ====================================================================
+
+    template <typename T>
+    void mapped_vector<T>::push_back(const value_type &val)
+    {
+        if (_size == _capacity)
+        {
+            value_type copy(val);
+            reserve(_capacity == 0 ? 1 : _capacity * 2);
+            _data[_size++] = copy;
+        }
+        else
+            _data[_size++] = val;
+    };
+
+    template <typename T>
+    void mapped_vector<T>::pop_back()
+    {
+        if (_size == 0)
+            throw std::out_of_range("mapped_vector");
+        _size--;
+    };
+
+    template <typename T>
+    void mapped_vector<T>::clear()
+    {
+        _size = 0;
+    };
+
+    template <typename T>
+    void mapped_vector<T>::assign(size_type n, const value_type &val)
+    {
+        value_type copy(val);
+        clear();
+        reserve(n);
+        for (; _size < n; _size++)
+            _data[_size] = copy;
+    };
+
+    template <typename T>
+    template <typename InputIterator>
+    void mapped_vector<T>::assign(InputIterator first, InputIterator last,
+                                  typename ft::enable_if<InputIterator, !ft::is_integral<InputIterator>::value>::type *)
+    {
+        clear();
+        for (; first != last; ++first)
+            push_back(*first);
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::iterator mapped_vector<T>::insert(iterator position, const value_type &val)
+    {
+        value_type copy(val);
+        size_type pos = _make_room(position.base() - _data, 1);
+        _data[pos] = copy;
+        return (iterator(_data + pos));
+    };
+
+    template <typename T>
+    void mapped_vector<T>::insert(iterator position, size_type n, const value_type &val)
+    {
+        value_type copy(val);
+        size_type pos = _make_room(position.base() - _data, n);
+        for (size_type i = 0; i < n; i++)
+            _data[pos + i] = copy;
+    };
+
+    template <typename T>
+    template <typename InputIterator>
+    void mapped_vector<T>::insert(iterator position, InputIterator first, InputIterator last,
+                                  typename ft::enable_if<InputIterator, !ft::is_integral<InputIterator>::value>::type *)
+    {
+        size_type pos = position.base() - _data;
+        size_type old_size = _size;
+        for (; first != last; ++first)
+            push_back(*first);
+        std::rotate(_data + pos, _data + old_size, _data + _size);
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::iterator mapped_vector<T>::erase(iterator position)
+    {
+        return (erase(position, position + 1));
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::iterator mapped_vector<T>::erase(iterator first, iterator last)
+    {
+        size_type pos = first.base() - _data;
+        size_type n = last - first;
+        std::memmove(_data + pos, _data + pos + n, (_size - pos - n) * sizeof(value_type));
+        _size -= n;
+        return (iterator(_data + pos));
+    };
+
+    template <typename T>
+    void mapped_vector<T>::swap(mapped_vector &x)
+    {
+        pointer tmp_data = _data;
+        size_type tmp_size = _size;
+        size_type tmp_capacity = _capacity;
+
+        _file.swap(x._file);
+        _data = x._data;
+        _size = x._size;
+        _capacity = x._capacity;
+
+        x._data = tmp_data;
+        x._size = tmp_size;
+        x._capacity = tmp_capacity;
+    };
+
+    // CAPACITY ===============================================================
+
+    template <typename T>
+    typename mapped_vector<T>::size_type mapped_vector<T>::size() const
+    {
+        return (_size);
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::size_type mapped_vector<T>::max_size() const
+    {
+        return ((static_cast<size_type>(-1) - header_size) / sizeof(value_type) / 2);
+    };
+
+    template <typename T>
+    void mapped_vector<T>::resize(size_type n, value_type val)
+    {
+        reserve(n);
+        for (; _size < n; _size++)
+            _data[_size] = val;
+        _size = n;
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::size_type mapped_vector<T>::capacity() const
+    {
+        return (_capacity);
+    };
+
+    template <typename T>
+    bool mapped_vector<T>::empty(void) const
+    {
+        return (_size == 0);
+    };
+
+    template <typename T>
+    void mapped_vector<T>::reserve(size_type n)
+    {
+        if (n <= _capacity)
+            return;
+        if (!_file.is_open())
+            throw std::runtime_error("mapped_vector: no file open");
+        if (n > max_size())
+            throw std::length_error("mapped_vector::reserve");
+        size_type page = mapped_file::page_size();
+        size_type bytes = (header_size + n * sizeof(value_type) + page - 1) / page * page;
+        _file.resize(bytes);
+        _attach();
+    };
+
+    // ACCESSORS ====================================================================
+
+    template <typename T>
+    typename mapped_vector<T>::reference mapped_vector<T>::operator[](size_type n)
+    {
+        return (_data[n]);
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::const_reference mapped_vector<T>::operator[](size_type n) const
+    {
+        return (_data[n]);
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::reference mapped_vector<T>::at(size_type n)
+    {
+        if (n >= _size)
+            throw std::out_of_range("mapped_vector::at");
+        return (_data[n]);
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::const_reference mapped_vector<T>::at(size_type n) const
+    {
+        if (n >= _size)
+            throw std::out_of_range("mapped_vector::at");
+        return (_data[n]);
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::reference mapped_vector<T>::front()
+    {
+        return (_data[0]);
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::const_reference mapped_vector<T>::front() const
+    {
+        return (_data[0]);
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::reference mapped_vector<T>::back()
+    {
+        return (_data[_size - 1]);
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::const_reference mapped_vector<T>::back() const
+    {
+        return (_data[_size - 1]);
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::pointer mapped_vector<T>::data()
+    {
+        return (_data);
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::const_pointer mapped_vector<T>::data() const
+    {
+        return (_data);
+    };
+
+    // ITERATORS ====================================================================
+
+    template <typename T>
+    typename mapped_vector<T>::iterator mapped_vector<T>::begin()
+    {
+        return (iterator(_data));
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::const_iterator mapped_vector<T>::begin() const
+    {
+        return (const_iterator(_data));
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::iterator mapped_vector<T>::end()
+    {
+        return (iterator(_data + _size));
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::const_iterator mapped_vector<T>::end() const
+    {
+        return (const_iterator(_data + _size));
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::reverse_iterator mapped_vector<T>::rbegin()
+    {
+        return (reverse_iterator(end()));
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::const_reverse_iterator mapped_vector<T>::rbegin() const
+    {
+        return (const_reverse_iterator(end()));
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::reverse_iterator mapped_vector<T>::rend()
+    {
+        return (reverse_iterator(begin()));
+    };
+
+    template <typename T>
+    typename mapped_vector<T>::const_reverse_iterator mapped_vector<T>::rend() const
+    {
+        return (const_reverse_iterator(begin()));
+    };
+
+    // PRIVATE ======================================================================
+
+    template <typename T>
+    mapped_vector_header *mapped_vector<T>::_header() const
+    {
+        return (static_cast<mapped_vector_header *>(_file.data()));
+    };
+
+    template <typename T>
+    void mapped_vector<T>::_attach()
+    {
+        _data = reinterpret_cast<pointer>(static_cast<char *>(_file.data()) + header_size);
+        _capacity = (_file.size() - header_size) / sizeof(value_type);
+    };
+
+    /**
+     * @brief Opens a gap of n elements at pos, growing the file if needed.
+     *
+     */
+    template <typename T>
+    typename mapped_vector<T>::size_type mapped_vector<T>::_make_room(size_type pos, size_type n)
+    {
+        if (_size + n > _capacity)
+            reserve(_size + n > _capacity * 2 ? _size + n : _capacity * 2);
+        std::memmove(_data + pos + n, _data + pos, (_size - pos) * sizeof(value_type));
+        _size += n;
+        return (pos);
+    };
+}
+
+#endif // ********************************************** MAPPED_VECTOR_TPP end //
@@ -0,0 +1,144 @@
+#ifndef NODE_HANDLE_HPP
+#define NODE_HANDLE_HPP
+
+#include <cstddef>
+
+namespace ft
+{
+    /**
+     * @brief Owner of a node extracted from an ft::map, until it is inserted into
+     * another map of the same type or the handle is destroyed.
+     *
+     * The node keeps its value where it was built: moving it between maps only
+     * rewires pointers, it never allocates nor copies the value. Without move
+     * semantics, copying or assigning a handle transfers the node like
+     * std::auto_ptr does, and leaves the source empty.
+     *
+     * @tparam Node The tree node type
+     * @tparam Node_Alloc The allocator the node came from, used to free it, and
+     * rebound to free a value its layout keeps apart
+     */
+    template <class Node, class Node_Alloc, class Key, class Mapped>
+    class map_node_handle
+    {
+    public:
+        typedef Key key_type;
+        typedef Mapped mapped_type;
+        typedef typename Node::value_type value_type;
+        typedef Node_Alloc allocator_type;
+
+        map_node_handle() : _node(NULL), _alloc() {}
+
+        map_node_handle(Node *node, const allocator_type &alloc) : _node(node), _alloc(alloc) {}
+
+        /**
+         * @brief Takes the node of other, which becomes empty
+         *
+         */
+        map_node_handle(const map_node_handle &other) : _node(other.release()), _alloc(other._alloc) {}
+
+        /**
+         * @brief Frees the node held, then takes the node of other
+         *
+         */
+        map_node_handle &operator=(const map_node_handle &other)
+        {
+            if (this != &other)
+            {
+                reset();
+                _alloc = other._alloc;
+                _node = other.release();
+            }
+            return *this;
+        }
+
+        ~map_node_handle()
+        {
+            reset();
+        }
+
+        bool empty() const
+        {
+            return _node == NULL;
+        }
+
+        const key_type &key() const
+        {
+            return _node->value().first;
+        }
+
+        mapped_type &mapped() const
+        {
+            return _node->value().second;
+        }
+
+        value_type &value() const
+        {
+            return _node->value();
+        }
+
+        allocator_type get_allocator() const
+        {
+            return _alloc;
+        }
+
+        void swap(map_node_handle &other)
+        {
+            Node *tmp_node = _node;
+            allocator_type tmp_alloc = _alloc;
+            _node = other._node;
+            _alloc = other._alloc;
+            other._node = tmp_node;
+            other._alloc = tmp_alloc;
+        }
+
+        /**
+         * @brief Gives up ownership of the node, the handle becomes empty
+         *
+         */
+        Node *release() const
+        {
+            Node *node = _node;
+            _node = NULL;
+            return node;
+        }
+
+        /**
+         * @brief Destroys and frees the node held, if any
+         *
+         */
+        void reset()
+        {
+            if (_node == NULL)
+                return;
+            typename allocator_type::template rebind<value_type>::other value_alloc(_alloc);
+            Node::destroy(_node, value_alloc);
+            _alloc.deallocate(_node, 1);
+            _node = NULL;
+        }
+
+    private:
+        mutable Node *_node;
+        allocator_type _alloc;
+    };
+
+    /**
+     * @brief Result of inserting a node handle: where the key is, whether the node was
+     * linked, and the node given back when the key was already there.
+     *
+     */
+    template <class Iterator, class NodeHandle>
+    struct node_insert_return
+    {
+        Iterator position;
+        bool inserted;
+        NodeHandle node;
+
+        node_insert_return() : position(), inserted(false), node() {}
+
+        node_insert_return(Iterator position, bool inserted, NodeHandle node)
+            : position(position), inserted(inserted), node(node) {}
+    };
+} // namespace ft
+
+#endif // ********************************************** NODE_HANDLE_HPP end //
@@ -0,0 +1,301 @@
+#ifndef PERSISTENT_MAP_HPP
+#define PERSISTENT_MAP_HPP
+
+// LIBS ========================================================================
+#include <memory>
+#include <functional>
+#include <cstddef>
+#include <new>
+#include "./pair.hpp"
+#include "./atomic.hpp"
+#include "./iterator_traits.hpp"
+
+namespace ft
+{
+    // NODE ========================================================================
+
+    /**
+     * @brief Node of ft::persistent_map. Immutable once linked: it may be shared by any
+     * number of maps, which each hold one reference to their root.
+     *
+     */
+    template <typename T>
+    struct persistent_node
+    {
+        typedef T value_type;
+
+        value_type value;
+        persistent_node *left;
+        persistent_node *right;
+        ft::atomic<size_t> refs;
+        int height;
+
+        persistent_node(const value_type &val, persistent_node *left, persistent_node *right, int height)
+            : value(val), left(left), right(right), refs(1), height(height) {}
+
+    private:
+        persistent_node(const persistent_node &);
+        persistent_node &operator=(const persistent_node &);
+    };
+
+    // ITERATORS ===================================================================
+
+    /**
+     * @brief Forward iterator over an ft::persistent_map. Nodes have no parent pointer,
+     * since a shared node has one parent per tree, so the iterator keeps the ancestors
+     * still to visit. An AVL tree of n nodes is at most 1.44 log2(n) high: 64 entries
+     * hold any tree that fits in memory.
+     *
+     */
+    template <typename Node>
+    class persistent_map_iterator : public ft::iterator<ft::forward_iterator_tag, typename Node::value_type>
+    {
+    public:
+        typedef typename Node::value_type value_type;
+        typedef const value_type &reference;
+        typedef const value_type *pointer;
+        typedef ptrdiff_t difference_type;
+        typedef ft::forward_iterator_tag iterator_category;
+
+        static const size_t max_height = 64;
+
+        persistent_map_iterator() : _depth(0) {}
+
+        persistent_map_iterator(const persistent_map_iterator &other) : _depth(other._depth)
+        {
+            for (size_t i = 0; i < _depth; i++)
+                _stack[i] = other._stack[i];
+        }
+
+        persistent_map_iterator &operator=(const persistent_map_iterator &other)
+        {
+            _depth = other._depth;
+            for (size_t i = 0; i < _depth; i++)
+                _stack[i] = other._stack[i];
+            return *this;
+        }
+
+        reference operator*() const { return _stack[_depth - 1]->value; }
+
+        pointer operator->() const { return &_stack[_depth - 1]->value; }
+
+        persistent_map_iterator &operator++()
+        {
+            const Node *node = _stack[--_depth]->right;
+            push_left(node);
+            return *this;
+        }
+
+        persistent_map_iterator operator++(int)
+        {
+            persistent_map_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const persistent_map_iterator &other) const { return _top() == other._top(); }
+
+        bool operator!=(const persistent_map_iterator &other) const { return _top() != other._top(); }
+
+        /**
+         * @brief Pushes node and its chain of left children: the next element is the last one.
+         *
+         */
+        void push_left(const Node *node)
+        {
+            for (; node; node = node->left)
+                _stack[_depth++] = node;
+        }
+
+        /**
+         * @brief Pushes one node, the next element when the walk went left of it.
+         *
+         */
+        void push(const Node *node)
+        {
+            _stack[_depth++] = node;
+        }
+
+        void clear()
+        {
+            _depth = 0;
+        }
+
+    private:
+        const Node *_stack[max_height];
+        size_t _depth;
+
+        const Node *_top() const
+        {
+            return (_depth ? _stack[_depth - 1] : NULL);
+        }
+    };
+
+    // CLASS =======================================================================
+
+    /**
+     * @brief Ordered map with structural sharing, for cheap snapshots.
+     *
+     * The tree is an AVL tree whose nodes are never modified once linked. Copying a map
+     * only takes a reference on the root, so copies and assignments are O(1). An update
+     * builds new copies of the O(log n) nodes on the path it touches and keeps sharing
+     * every other subtree with the previous versions; a node is freed when the last
+     * version referencing it goes away. Reference counts are atomic, so versions of the
+     * same map can be read and destroyed from different threads, as long as each map
+     * object is used by one thread at a time.
+     *
+     * Elements are read-only: there is no operator[] or non-const iterator, values are
+     * changed with insert_or_assign.
+     *
+     * @tparam Key Key type.
+     * @tparam T Mapped type.
+     * @tparam Compare Strict weak ordering of keys.
+     * @tparam Alloc Allocator, rebound to nodes.
+     */
+    template <class Key, class T, class Compare = std::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > >
+    class persistent_map
+    {
+    public:
+        // MEMBER TYPES ========================================================
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef ft::pair<const key_type, mapped_type> value_type;
+        typedef Compare key_compare;
+        typedef Alloc allocator_type;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef typename allocator_type::size_type size_type;
+        typedef typename allocator_type::difference_type difference_type;
+
+    private:
+        typedef persistent_node<value_type> node_type;
+        typedef typename allocator_type::template rebind<node_type>::other node_allocator_type;
+
+    public:
+        // ITERATORS ===========================================================
+        typedef persistent_map_iterator<node_type> const_iterator;
+        typedef const_iterator iterator;
+
+    private:
+        // ATTRIBUTES ==========================================================
+        node_type *_root;
+        size_type _size;
+        key_compare _comp;
+        node_allocator_type _node_alloc;
+
+        /**
+         * @brief Releases the reference it holds when it goes out of scope.
+         *
+         */
+        struct hold
+        {
+            persistent_map *map;
+            node_type *node;
+
+            hold(persistent_map *map, node_type *node) : map(map), node(node) {}
+            ~hold() { map->_release(node); }
+        };
+
+    public:
+        // CONSTRUCTORS ========================================================
+
+        explicit persistent_map(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+
+        /**
+         * @brief Constructs a map sharing every node of x. O(1).
+         *
+         */
+        persistent_map(const persistent_map &x);
+
+        /**
+         * @brief Drops this version; nodes no other version references are freed.
+         *
+         */
+        ~persistent_map();
+
+        /**
+         * @brief Makes this map share every node of x. O(1).
+         *
+         */
+        persistent_map &operator=(const persistent_map &x);
+
+        // ITERATORS ===========================================================
+
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        // CAPACITY ============================================================
+
+        bool empty() const;
+        size_type size() const;
+
+        // LOOKUP ==============================================================
+
+        const_iterator find(const key_type &k) const;
+        size_type count(const key_type &k) const;
+
+        /**
+         * @brief Returns the value mapped to k, throws std::out_of_range if k is missing.
+         *
+         */
+        const mapped_type &at(const key_type &k) const;
+
+        // MODIFIERS ===========================================================
+
+        /**
+         * @brief Inserts val if its key is missing, copying the path to the new leaf.
+         * Nothing is copied when the key is already there.
+         *
+         * @return true if val was inserted.
+         */
+        bool insert(const value_type &val);
+
+        /**
+         * @brief Inserts val, or replaces the value mapped to its key.
+         *
+         * @return true if val was inserted, false if it replaced a value.
+         */
+        bool insert_or_assign(const value_type &val);
+
+        /**
+         * @brief Removes the element with key k, copying the path to it.
+         *
+         * @return The number of elements removed (0 or 1).
+         */
+        size_type erase(const key_type &k);
+
+        void clear();
+        void swap(persistent_map &x);
+
+        // OBSERVERS ===========================================================
+
+        key_compare key_comp() const;
+        allocator_type get_allocator() const;
+
+    private:
+        static int _height(const node_type *node);
+        const node_type *_find(const key_type &k) const;
+        node_type *_make(const value_type &val, node_type *left, node_type *right);
+        node_type *_retain(node_type *node);
+        void _release(node_type *node);
+        node_type *_balance(const value_type &val, node_type *left, node_type *right);
+        node_type *_insert(node_type *node, const value_type &val, bool assign, bool &inserted);
+        node_type *_erase(node_type *node, const key_type &k, bool &erased);
+        node_type *_erase_min(node_type *node);
+    };
+
+    // NON MEMBER OVERLOADS ======================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator==(const persistent_map<Key, T, Compare, Alloc> &lhs, const persistent_map<Key, T, Compare, Alloc> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator!=(const persistent_map<Key, T, Compare, Alloc> &lhs, const persistent_map<Key, T, Compare, Alloc> &rhs);
+
+    template <class Key, class T, class Compare, class Alloc>
+    void swap(persistent_map<Key, T, Compare, Alloc> &x, persistent_map<Key, T, Compare, Alloc> &y);
+} // namespace ft
+
+#include "persistent_map.tpp"
+
+#endif // ********************************************** PERSISTENT_MAP_HPP end //
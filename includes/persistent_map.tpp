@@ -0,0 +1,420 @@
+#ifndef PERSISTENT_MAP_TPP
+#define PERSISTENT_MAP_TPP
+
+#include <stdexcept>
+#include "persistent_map.hpp"
+
+namespace ft
+{
+    // CONSTRUCTORS =================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    persistent_map<Key, T, Compare, Alloc>::persistent_map(const key_compare &comp, const allocator_type &alloc)
+        : _root(NULL), _size(0), _comp(comp), _node_alloc(alloc)
+    {
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    persistent_map<Key, T, Compare, Alloc>::persistent_map(const persistent_map &x)
+        : _root(NULL), _size(x._size), _comp(x._comp), _node_alloc(x._node_alloc)
+    {
+        _root = _retain(x._root);
+    };
+
+    // DESTRUCTOR ==================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    persistent_map<Key, T, Compare, Alloc>::~persistent_map()
+    {
+        _release(_root);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    persistent_map<Key, T, Compare, Alloc> &persistent_map<Key, T, Compare, Alloc>::operator=(const persistent_map &x)
+    {
+        node_type *old = _root;
+        _root = _retain(x._root);
+        _size = x._size;
+        _comp = x._comp;
+        _release(old);
+        return (*this);
+    };
+
+    // ITERATORS ====================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::const_iterator persistent_map<Key, T, Compare, Alloc>::begin() const
+    {
+        const_iterator it;
+        it.push_left(_root);
+        return (it);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::const_iterator persistent_map<Key, T, Compare, Alloc>::end() const
+    {
+        return (const_iterator());
+    };
+
+    // CAPACITY ===============================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool persistent_map<Key, T, Compare, Alloc>::empty() const
+    {
+        return (_size == 0);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::size_type persistent_map<Key, T, Compare, Alloc>::size() const
+    {
+        return (_size);
+    };
+
+    // LOOKUP =======================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::const_iterator persistent_map<Key, T, Compare, Alloc>::find(const key_type &k) const
+    {
+        const_iterator it;
+        const node_type *node = _root;
+        while (node)
+        {
+            if (_comp(k, node->value.first))
+            {
+                it.push(node);
+                node = node->left;
+            }
+            else if (_comp(node->value.first, k))
+                node = node->right;
+            else
+            {
+                it.push(node);
+                return (it);
+            }
+        }
+        return (end());
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::size_type persistent_map<Key, T, Compare, Alloc>::count(const key_type &k) const
+    {
+        return (_find(k) ? 1 : 0);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    const typename persistent_map<Key, T, Compare, Alloc>::mapped_type &persistent_map<Key, T, Compare, Alloc>::at(const key_type &k) const
+    {
+        const node_type *node = _find(k);
+        if (!node)
+            throw std::out_of_range("persistent_map::at");
+        return (node->value.second);
+    };
+
+    // MODIFIERS ====================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool persistent_map<Key, T, Compare, Alloc>::insert(const value_type &val)
+    {
+        bool inserted = false;
+        node_type *root = _insert(_root, val, false, inserted);
+        if (!root)
+            return (false);
+        _release(_root);
+        _root = root;
+        _size++;
+        return (true);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool persistent_map<Key, T, Compare, Alloc>::insert_or_assign(const value_type &val)
+    {
+        bool inserted = false;
+        node_type *root = _insert(_root, val, true, inserted);
+        _release(_root);
+        _root = root;
+        if (inserted)
+            _size++;
+        return (inserted);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::size_type persistent_map<Key, T, Compare, Alloc>::erase(const key_type &k)
+    {
+        bool erased = false;
+        node_type *root = _erase(_root, k, erased);
+        if (!erased)
+            return (0);
+        _release(_root);
+        _root = root;
+        _size--;
+        return (1);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    void persistent_map<Key, T, Compare, Alloc>::clear()
+    {
+        _release(_root);
+        _root = NULL;
+        _size = 0;
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    void persistent_map<Key, T, Compare, Alloc>::swap(persistent_map &x)
+    {
+        node_type *tmp_root = _root;
+        size_type tmp_size = _size;
+        key_compare tmp_comp = _comp;
+        node_allocator_type tmp_node_alloc = _node_alloc;
+
+        _root = x._root;
+        _size = x._size;
+        _comp = x._comp;
+        _node_alloc = x._node_alloc;
+
+        x._root = tmp_root;
+        x._size = tmp_size;
+        x._comp = tmp_comp;
+        x._node_alloc = tmp_node_alloc;
+    };
+
+    // OBSERVERS ====================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::key_compare persistent_map<Key, T, Compare, Alloc>::key_comp() const
+    {
+        return (_comp);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::allocator_type persistent_map<Key, T, Compare, Alloc>::get_allocator() const
+    {
+        return (allocator_type(_node_alloc));
+    };
+
+    // PRIVATE ======================================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    int persistent_map<Key, T, Compare, Alloc>::_height(const node_type *node)
+    {
+        return (node ? node->height : 0);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    const typename persistent_map<Key, T, Compare, Alloc>::node_type *persistent_map<Key, T, Compare, Alloc>::_find(const key_type &k) const
+    {
+        const node_type *node = _root;
+        while (node)
+        {
+            if (_comp(k, node->value.first))
+                node = node->left;
+            else if (_comp(node->value.first, k))
+                node = node->right;
+            else
+                return (node);
+        }
+        return (NULL);
+    };
+
+    /**
+     * @brief New node holding a copy of val, with one reference owned by the caller.
+     * Takes its own reference on left and right, the caller keeps theirs.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::node_type *
+    persistent_map<Key, T, Compare, Alloc>::_make(const value_type &val, node_type *left, node_type *right)
+    {
+        node_type *node = _node_alloc.allocate(1);
+        int hl = _height(left);
+        int hr = _height(right);
+        try
+        {
+            new (node) node_type(val, left, right, 1 + (hl > hr ? hl : hr));
+        }
+        catch (...)
+        {
+            _node_alloc.deallocate(node, 1);
+            throw;
+        }
+        _retain(left);
+        _retain(right);
+        return (node);
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::node_type *persistent_map<Key, T, Compare, Alloc>::_retain(node_type *node)
+    {
+        if (node)
+            node->refs.fetch_add(1, memory_order_relaxed);
+        return (node);
+    };
+
+    /**
+     * @brief Drops one reference on node, freeing it and releasing its children when
+     * it was the last one. Recursion is bounded by the height of the tree.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc>
+    void persistent_map<Key, T, Compare, Alloc>::_release(node_type *node)
+    {
+        if (!node || node->refs.fetch_sub(1, memory_order_acq_rel) != 1)
+            return;
+        _release(node->left);
+        _release(node->right);
+        node->~node_type();
+        _node_alloc.deallocate(node, 1);
+    };
+
+    /**
+     * @brief New node holding val over left and right, rotated when their heights differ
+     * by two. Rotations copy the nodes they move, since those may be shared.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::node_type *
+    persistent_map<Key, T, Compare, Alloc>::_balance(const value_type &val, node_type *left, node_type *right)
+    {
+        int hl = _height(left);
+        int hr = _height(right);
+        if (hl > hr + 1)
+        {
+            if (_height(left->left) >= _height(left->right))
+            {
+                hold down(this, _make(val, left->right, right));
+                return (_make(left->value, left->left, down.node));
+            }
+            node_type *pivot = left->right;
+            hold lower_left(this, _make(left->value, left->left, pivot->left));
+            hold lower_right(this, _make(val, pivot->right, right));
+            return (_make(pivot->value, lower_left.node, lower_right.node));
+        }
+        if (hr > hl + 1)
+        {
+            if (_height(right->right) >= _height(right->left))
+            {
+                hold down(this, _make(val, left, right->left));
+                return (_make(right->value, down.node, right->right));
+            }
+            node_type *pivot = right->left;
+            hold lower_left(this, _make(val, left, pivot->left));
+            hold lower_right(this, _make(right->value, pivot->right, right->right));
+            return (_make(pivot->value, lower_left.node, lower_right.node));
+        }
+        return (_make(val, left, right));
+    };
+
+    /**
+     * @brief New version of the subtree at node with val inserted, or NULL when nothing
+     * changed (key present and assign false).
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::node_type *
+    persistent_map<Key, T, Compare, Alloc>::_insert(node_type *node, const value_type &val, bool assign, bool &inserted)
+    {
+        if (!node)
+        {
+            inserted = true;
+            return (_make(val, NULL, NULL));
+        }
+        if (_comp(val.first, node->value.first))
+        {
+            node_type *left = _insert(node->left, val, assign, inserted);
+            if (!left)
+                return (NULL);
+            hold h(this, left);
+            return (_balance(node->value, left, node->right));
+        }
+        if (_comp(node->value.first, val.first))
+        {
+            node_type *right = _insert(node->right, val, assign, inserted);
+            if (!right)
+                return (NULL);
+            hold h(this, right);
+            return (_balance(node->value, node->left, right));
+        }
+        if (!assign)
+            return (NULL);
+        return (_make(val, node->left, node->right));
+    };
+
+    /**
+     * @brief New version of the subtree at node without k. erased tells whether k was
+     * found; when it was not, the result is NULL and nothing was copied.
+     *
+     */
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::node_type *
+    persistent_map<Key, T, Compare, Alloc>::_erase(node_type *node, const key_type &k, bool &erased)
+    {
+        if (!node)
+        {
+            erased = false;
+            return (NULL);
+        }
+        if (_comp(k, node->value.first))
+        {
+            node_type *left = _erase(node->left, k, erased);
+            if (!erased)
+                return (NULL);
+            hold h(this, left);
+            return (_balance(node->value, left, node->right));
+        }
+        if (_comp(node->value.first, k))
+        {
+            node_type *right = _erase(node->right, k, erased);
+            if (!erased)
+                return (NULL);
+            hold h(this, right);
+            return (_balance(node->value, node->left, right));
+        }
+        erased = true;
+        if (!node->left)
+            return (_retain(node->right));
+        if (!node->right)
+            return (_retain(node->left));
+        const node_type *successor = node->right;
+        while (successor->left)
+            successor = successor->left;
+        hold right(this, _erase_min(node->right));
+        return (_balance(successor->value, node->left, right.node));
+    };
+
+    template <class Key, class T, class Compare, class Alloc>
+    typename persistent_map<Key, T, Compare, Alloc>::node_type *persistent_map<Key, T, Compare, Alloc>::_erase_min(node_type *node)
+    {
+        if (!node->left)
+            return (_retain(node->right));
+        hold left(this, _erase_min(node->left));
+        return (_balance(node->value, left.node, node->right));
+    };
+
+    // NON MEMBER OVERLOADS =======================================================
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator==(const persistent_map<Key, T, Compare, Alloc> &lhs, const persistent_map<Key, T, Compare, Alloc> &rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return (false);
+        typename persistent_map<Key, T, Compare, Alloc>::const_iterator it = lhs.begin();
+        typename persistent_map<Key, T, Compare, Alloc>::const_iterator other = rhs.begin();
+        for (; it != lhs.end(); ++it, ++other)
+            if (!(*it == *other))
+                return (false);
+        return (true);
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    bool operator!=(const persistent_map<Key, T, Compare, Alloc> &lhs, const persistent_map<Key, T, Compare, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class Key, class T, class Compare, class Alloc>
+    void swap(persistent_map<Key, T, Compare, Alloc> &x, persistent_map<Key, T, Compare, Alloc> &y)
+    {
+        x.swap(y);
+    }
+}
+
+#endif // ********************************************** PERSISTENT_MAP_TPP end //
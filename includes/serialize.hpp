@@ -0,0 +1,518 @@
+#ifndef SERIALIZE_HPP
+#define SERIALIZE_HPP
+
+// LIBS ========================================================================
+#include <cstddef>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "./utils.hpp"
+#include "./pair.hpp"
+#include "./vector.hpp"
+#include "./map.hpp"
+
+namespace ft
+{
+    // BUFFERED FILE DESCRIPTORS ===================================================
+
+    /**
+     * @brief Buffered writer over a file descriptor it does not own. Writes larger than
+     * the buffer go straight to write(2) once the buffer is flushed.
+     *
+     */
+    class fd_writer
+    {
+    public:
+        explicit fd_writer(int fd, size_t buffer_size = 1 << 16)
+            : _fd(fd), _buffer(new char[buffer_size]), _capacity(buffer_size), _used(0) {}
+
+        /**
+         * @brief Flushes what is left. Errors are lost here, call flush() to see them.
+         *
+         */
+        ~fd_writer()
+        {
+            try
+            {
+                flush();
+            }
+            catch (...)
+            {
+            }
+            delete[] _buffer;
+        }
+
+        void write(const void *data, size_t n)
+        {
+            if (_used + n <= _capacity)
+            {
+                std::memcpy(_buffer + _used, data, n);
+                _used += n;
+                return;
+            }
+            flush();
+            if (n >= _capacity)
+                _write_all(static_cast<const char *>(data), n);
+            else
+            {
+                std::memcpy(_buffer, data, n);
+                _used = n;
+            }
+        }
+
+        void flush()
+        {
+            size_t used = _used;
+            _used = 0;
+            _write_all(_buffer, used);
+        }
+
+        /**
+         * @brief Flushes the buffer and waits for the data to reach the disk.
+         *
+         */
+        void sync()
+        {
+            flush();
+            if (fsync(_fd) != 0)
+                throw std::runtime_error(std::string("fd_writer: fsync: ") + std::strerror(errno));
+        }
+
+    private:
+        int _fd;
+        char *_buffer;
+        size_t _capacity;
+        size_t _used;
+
+        fd_writer(const fd_writer &);
+        fd_writer &operator=(const fd_writer &);
+
+        void _write_all(const char *data, size_t n)
+        {
+            while (n > 0)
+            {
+                ssize_t written = ::write(_fd, data, n);
+                if (written < 0 && errno == EINTR)
+                    continue;
+                if (written <= 0)
+                    throw std::runtime_error(std::string("fd_writer: write: ") + std::strerror(errno));
+                data += written;
+                n -= static_cast<size_t>(written);
+            }
+        }
+    };
+
+    /**
+     * @brief Buffered reader over a file descriptor it does not own. read() fills
+     * exactly n bytes or throws std::runtime_error. remaining() is what is left of a
+     * regular file, so that a corrupt length can be rejected before it is allocated;
+     * it stays at the largest size_t on pipes and other streams.
+     *
+     */
+    class fd_reader
+    {
+    public:
+        explicit fd_reader(int fd, size_t buffer_size = 1 << 16)
+            : _fd(fd), _buffer(new char[buffer_size]), _capacity(buffer_size), _begin(0), _end(0),
+              _remaining(static_cast<size_t>(-1))
+        {
+            struct stat st;
+            off_t offset = ::lseek(fd, 0, SEEK_CUR);
+            if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && offset >= 0 && st.st_size >= offset)
+                _remaining = static_cast<size_t>(st.st_size - offset);
+        }
+
+        ~fd_reader()
+        {
+            delete[] _buffer;
+        }
+
+        void read(void *data, size_t n)
+        {
+            if (n > _remaining)
+                throw std::runtime_error("fd_reader: unexpected end of file");
+            if (_remaining != static_cast<size_t>(-1))
+                _remaining -= n;
+            char *out = static_cast<char *>(data);
+            size_t buffered = _end - _begin;
+            if (n <= buffered)
+            {
+                std::memcpy(out, _buffer + _begin, n);
+                _begin += n;
+                return;
+            }
+            std::memcpy(out, _buffer + _begin, buffered);
+            out += buffered;
+            n -= buffered;
+            _begin = _end = 0;
+            if (n >= _capacity)
+            {
+                _read_some(out, n, n);
+                return;
+            }
+            _end = _read_some(_buffer, n, _capacity);
+            std::memcpy(out, _buffer, n);
+            _begin = n;
+        }
+
+        size_t remaining() const
+        {
+            return _remaining;
+        }
+
+    private:
+        int _fd;
+        char *_buffer;
+        size_t _capacity;
+        size_t _begin;
+        size_t _end;
+        size_t _remaining;
+
+        fd_reader(const fd_reader &);
+        fd_reader &operator=(const fd_reader &);
+
+        /**
+         * @brief Reads at least min and at most max bytes, returns how many.
+         *
+         */
+        size_t _read_some(char *data, size_t min, size_t max)
+        {
+            size_t total = 0;
+            while (total < min)
+            {
+                ssize_t got = ::read(_fd, data + total, max - total);
+                if (got < 0 && errno == EINTR)
+                    continue;
+                if (got < 0)
+                    throw std::runtime_error(std::string("fd_reader: read: ") + std::strerror(errno));
+                if (got == 0)
+                    throw std::runtime_error("fd_reader: unexpected end of file");
+                total += static_cast<size_t>(got);
+            }
+            return total;
+        }
+    };
+
+    // TRAITS ======================================================================
+
+    /**
+     * @brief Whether values of T can be written as their raw bytes, and read back in a
+     * process of the same architecture. Specialize it for plain structs without
+     * pointers or padding to get bulk vector writes.
+     *
+     */
+    template <typename T>
+    struct bitwise_serializable
+    {
+        static const bool value = ft::is_integral<T>::value;
+    };
+
+    template <typename T>
+    struct bitwise_serializable<const T> : bitwise_serializable<T>
+    {
+    };
+
+    template <>
+    struct bitwise_serializable<float>
+    {
+        static const bool value = true;
+    };
+
+    template <>
+    struct bitwise_serializable<double>
+    {
+        static const bool value = true;
+    };
+
+    template <typename T1, typename T2>
+    struct bitwise_serializable<ft::pair<T1, T2> >
+    {
+        static const bool value = bitwise_serializable<T1>::value && bitwise_serializable<T2>::value &&
+                                  sizeof(ft::pair<T1, T2>) == sizeof(T1) + sizeof(T2);
+    };
+
+    /**
+     * @brief How one value of T is written and read. Types without a specialization
+     * do not compile.
+     *
+     */
+    template <typename T, typename Enable = void>
+    struct serializer;
+
+    template <typename T>
+    struct serializer<T, typename ft::enable_if<void, bitwise_serializable<T>::value>::type>
+    {
+        static void write(fd_writer &out, const T &val)
+        {
+            out.write(&val, sizeof(T));
+        }
+
+        static void read(fd_reader &in, T &val)
+        {
+            in.read(&val, sizeof(T));
+        }
+    };
+
+    /**
+     * @brief Lengths and element counts, always 64 bits. Reading rejects a count of
+     * elements of at least element_size bytes that would not fit in what is left of
+     * the file, which only a corrupt file holds.
+     *
+     */
+    inline void write_length(fd_writer &out, size_t n)
+    {
+        unsigned long long length = n;
+        out.write(&length, sizeof(length));
+    }
+
+    inline size_t read_length(fd_reader &in, size_t element_size = 1)
+    {
+        unsigned long long length;
+        in.read(&length, sizeof(length));
+        if (length > static_cast<size_t>(-1) / 2 || length > in.remaining() / element_size)
+            throw std::runtime_error("deserialize: corrupt length");
+        return static_cast<size_t>(length);
+    }
+
+    template <>
+    struct serializer<std::string>
+    {
+        static void write(fd_writer &out, const std::string &val)
+        {
+            write_length(out, val.size());
+            out.write(val.data(), val.size());
+        }
+
+        static void read(fd_reader &in, std::string &val)
+        {
+            val.resize(read_length(in));
+            if (!val.empty())
+                in.read(&val[0], val.size());
+        }
+    };
+
+    template <typename T1, typename T2>
+    struct serializer<ft::pair<T1, T2>, typename ft::enable_if<void, !bitwise_serializable<ft::pair<T1, T2> >::value>::type>
+    {
+        static void write(fd_writer &out, const ft::pair<T1, T2> &val)
+        {
+            serializer<T1>::write(out, val.first);
+            serializer<T2>::write(out, val.second);
+        }
+
+        static void read(fd_reader &in, ft::pair<T1, T2> &val)
+        {
+            serializer<T1>::read(in, val.first);
+            serializer<T2>::read(in, val.second);
+        }
+    };
+
+    /**
+     * @brief Element count, then the elements: one bulk write when they are bitwise
+     * serializable, one at a time otherwise.
+     *
+     */
+    template <typename T, typename Alloc, typename Stats>
+    struct serializer<ft::vector<T, Alloc, Stats> >
+    {
+        static void write(fd_writer &out, const ft::vector<T, Alloc, Stats> &val)
+        {
+            write_length(out, val.size());
+            if (val.empty())
+                return;
+            if (bitwise_serializable<T>::value)
+                out.write(&val[0], val.size() * sizeof(T));
+            else
+                for (size_t i = 0; i < val.size(); i++)
+                    serializer<T>::write(out, val[i]);
+        }
+
+        static void read(fd_reader &in, ft::vector<T, Alloc, Stats> &val)
+        {
+            size_t n = read_length(in, bitwise_serializable<T>::value ? sizeof(T) : 1);
+            val.clear();
+            val.reserve(n);
+            if (bitwise_serializable<T>::value)
+            {
+                val.resize(n);
+                if (n)
+                    in.read(&val[0], n * sizeof(T));
+                return;
+            }
+            T element;
+            for (size_t i = 0; i < n; i++)
+            {
+                serializer<T>::read(in, element);
+                val.push_back(element);
+            }
+        }
+    };
+
+    /**
+     * @brief Element count, then key and value of each element in key order. Reading
+     * collects the elements and builds the tree in one pass with assign_sorted.
+     *
+     */
+    template <typename Key, typename T, typename Compare, typename Alloc, typename Layout, typename Stats>
+    struct serializer<ft::map<Key, T, Compare, Alloc, Layout, Stats> >
+    {
+        static void write(fd_writer &out, const ft::map<Key, T, Compare, Alloc, Layout, Stats> &val)
+        {
+            write_length(out, val.size());
+            typename ft::map<Key, T, Compare, Alloc, Layout, Stats>::const_iterator it = val.begin();
+            for (; it != val.end(); ++it)
+            {
+                serializer<Key>::write(out, it->first);
+                serializer<T>::write(out, it->second);
+            }
+        }
+
+        static void read(fd_reader &in, ft::map<Key, T, Compare, Alloc, Layout, Stats> &val)
+        {
+            ft::vector<ft::pair<Key, T> > elements;
+            serializer<ft::vector<ft::pair<Key, T> > >::read(in, elements);
+            try
+            {
+                val.assign_sorted(elements.begin(), elements.end());
+            }
+            catch (std::invalid_argument &)
+            {
+                throw std::runtime_error("deserialize: map keys are not sorted");
+            }
+        }
+    };
+
+    // FORMAT ======================================================================
+
+    /**
+     * @brief Starts every serialized stream. byte_order reads back as 0x01020304 only
+     * on a machine of the writer's endianness.
+     *
+     */
+    struct serial_header
+    {
+        char magic[8];
+        unsigned int version;
+        unsigned int byte_order;
+    };
+
+    static const unsigned int serial_version = 1;
+
+    /**
+     * @brief Writes the header then val. The caller flushes out.
+     *
+     */
+    template <typename T>
+    void serialize(fd_writer &out, const T &val)
+    {
+        serial_header header;
+        std::memcpy(header.magic, "ftserial", sizeof(header.magic));
+        header.version = serial_version;
+        header.byte_order = 0x01020304;
+        out.write(&header, sizeof(header));
+        serializer<T>::write(out, val);
+    }
+
+    /**
+     * @brief Checks the header then reads into val. Throws std::runtime_error on a
+     * foreign or truncated stream.
+     *
+     */
+    template <typename T>
+    void deserialize(fd_reader &in, T &val)
+    {
+        serial_header header;
+        in.read(&header, sizeof(header));
+        if (std::memcmp(header.magic, "ftserial", sizeof(header.magic)) != 0)
+            throw std::runtime_error("deserialize: not a serialized stream");
+        if (header.version != serial_version)
+            throw std::runtime_error("deserialize: unsupported version");
+        if (header.byte_order != 0x01020304)
+            throw std::runtime_error("deserialize: written with another byte order");
+        serializer<T>::read(in, val);
+    }
+
+    /**
+     * @brief Calls write(out) with out writing path + ".tmp", waits for the file to reach
+     * the disk, then renames it over path: a reader sees the old file or the new one,
+     * never a partial write. On failure the temporary file is removed and the error,
+     * named after who, propagates.
+     *
+     */
+    template <typename Writer>
+    void write_file_atomically(const std::string &path, const char *who, Writer &write)
+    {
+        std::string tmp = path + ".tmp";
+        int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0)
+            throw std::runtime_error(std::string(who) + ": " + tmp + ": " + std::strerror(errno));
+        try
+        {
+            fd_writer out(fd, 1 << 20);
+            write(out);
+            out.sync();
+        }
+        catch (...)
+        {
+            ::close(fd);
+            std::remove(tmp.c_str());
+            throw;
+        }
+        ::close(fd);
+        if (std::rename(tmp.c_str(), path.c_str()) != 0)
+        {
+            std::remove(tmp.c_str());
+            throw std::runtime_error(std::string(who) + ": rename " + path + ": " + std::strerror(errno));
+        }
+    }
+
+    template <typename T>
+    struct _serialize_writer
+    {
+        const T &val;
+
+        explicit _serialize_writer(const T &v) : val(v) {}
+
+        void operator()(fd_writer &out) const
+        {
+            serialize(out, val);
+        }
+    };
+
+    /**
+     * @brief Writes val to the file at path with write_file_atomically.
+     *
+     */
+    template <typename T>
+    void serialize(const std::string &path, const T &val)
+    {
+        _serialize_writer<T> writer(val);
+        write_file_atomically(path, "serialize", writer);
+    }
+
+    template <typename T>
+    void deserialize(const std::string &path, T &val)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::runtime_error("deserialize: " + path + ": " + std::strerror(errno));
+        try
+        {
+            fd_reader in(fd, 1 << 20);
+            deserialize(in, val);
+        }
+        catch (...)
+        {
+            ::close(fd);
+            throw;
+        }
+        ::close(fd);
+    }
+} // namespace ft
+
+#endif // ********************************************** SERIALIZE_HPP end //
@@ -0,0 +1,191 @@
+#ifndef SHARDED_MAP_HPP
+#define SHARDED_MAP_HPP
+
+// LIBS ========================================================================
+#include <memory>
+#include <functional>
+#include <cstddef>
+#include <pthread.h>
+#include "./map.hpp"
+#include "./hash.hpp"
+#include "./atomic.hpp"
+
+namespace ft
+{
+    // CLASS =======================================================================
+
+    /**
+     * @brief Thread-safe map split into Shards independent ft::map, each behind its own
+     * reader-writer lock. A key always lives in shard hash(key) % Shards, so threads
+     * working on different shards never contend, and readers of the same shard share it.
+     *
+     * Lookups return copies: an iterator into a shard would outlive the shard's lock.
+     *
+     * @tparam Key Key type.
+     * @tparam T Mapped type.
+     * @tparam Shards Number of shards, a power of two keeps the shard index a mask.
+     * @tparam Hash Function object hashing a Key.
+     * @tparam Compare Key ordering inside a shard.
+     * @tparam Alloc Allocator of every shard.
+     */
+    template <class Key, class T, size_t Shards = 16, class Hash = ft::hash<Key>, class Compare = std::less<Key>,
+              class Alloc = std::allocator<ft::pair<const Key, T> > >
+    class sharded_map
+    {
+    public:
+        // MEMBER TYPES ========================================================
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef ft::pair<const key_type, mapped_type> value_type;
+        typedef Hash hasher;
+        typedef Compare key_compare;
+        typedef Alloc allocator_type;
+        typedef ft::map<Key, T, Compare, Alloc> shard_type;
+        typedef typename shard_type::size_type size_type;
+
+    private:
+        /**
+         * @brief One shard. The leading padding keeps the lock of a shard off the cache
+         * line holding the previous shard's map.
+         */
+        struct shard
+        {
+            char lead[FT_CACHE_LINE_SIZE];
+            pthread_rwlock_t lock;
+            shard_type map;
+
+            shard() : map() { pthread_rwlock_init(&lock, NULL); }
+            ~shard() { pthread_rwlock_destroy(&lock); }
+        };
+
+        /**
+         * @brief Holds a shard's read lock for the lifetime of the object.
+         */
+        class read_guard
+        {
+        public:
+            explicit read_guard(pthread_rwlock_t &lock) : _lock(&lock) { pthread_rwlock_rdlock(_lock); }
+            ~read_guard() { pthread_rwlock_unlock(_lock); }
+
+        private:
+            pthread_rwlock_t *_lock;
+        };
+
+        /**
+         * @brief Holds a shard's write lock for the lifetime of the object.
+         */
+        class write_guard
+        {
+        public:
+            explicit write_guard(pthread_rwlock_t &lock) : _lock(&lock) { pthread_rwlock_wrlock(_lock); }
+            ~write_guard() { pthread_rwlock_unlock(_lock); }
+
+        private:
+            pthread_rwlock_t *_lock;
+        };
+
+        // ATTRIBUTES ==========================================================
+        mutable shard _shards[Shards];
+        hasher _hash;
+
+    public:
+        // CONSTRUCTORS ========================================================
+
+        /**
+         * @brief Constructs an empty sharded map. Every shard gets a copy of comp and alloc.
+         *
+         */
+        explicit sharded_map(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type(),
+                             const hasher &hash = hasher());
+
+        /**
+         * @brief Destroys every shard. No thread may be using the map anymore.
+         *
+         */
+        ~sharded_map();
+
+        // LOOKUP ==============================================================
+
+        /**
+         * @brief Copies the value mapped to k into out, under the shard's read lock.
+         *
+         * @return true if k was found, false otherwise (out is left untouched).
+         */
+        bool find(const key_type &k, mapped_type &out) const;
+
+        /**
+         * @brief Returns 1 if an element with key k exists, 0 otherwise.
+         *
+         */
+        size_type count(const key_type &k) const;
+
+        // MODIFIERS ===========================================================
+
+        /**
+         * @brief Inserts val if its key is not present yet, under the shard's write lock.
+         *
+         * @return true if val was inserted.
+         */
+        bool insert(const value_type &val);
+
+        /**
+         * @brief Removes the element with key k, under the shard's write lock.
+         *
+         * @return The number of elements removed (0 or 1).
+         */
+        size_type erase(const key_type &k);
+
+        /**
+         * @brief Removes every element, locking one shard at a time.
+         *
+         */
+        void clear();
+
+        // SHARDS ==============================================================
+
+        /**
+         * @brief Calls visitor(const shard_type &) on every shard in turn, each under its
+         * read lock. Shards are locked one at a time, so the visit is not a snapshot of the
+         * whole map.
+         *
+         * @return The visitor, so it can carry results out like std::for_each.
+         */
+        template <class Visitor>
+        Visitor for_each_shard(Visitor visitor) const;
+
+        /**
+         * @brief Index of the shard owning k.
+         *
+         */
+        size_type shard_index(const key_type &k) const;
+
+        /**
+         * @brief Number of shards.
+         *
+         */
+        size_type shard_count() const;
+
+        // CAPACITY ============================================================
+
+        /**
+         * @brief Sum of the shard sizes. Shards are read one at a time, so the result is
+         * only exact when no writer is running.
+         *
+         */
+        size_type size() const;
+
+        /**
+         * @brief Whether every shard is empty.
+         *
+         */
+        bool empty() const;
+
+    private:
+        sharded_map(const sharded_map &);
+        sharded_map &operator=(const sharded_map &);
+    };
+} // namespace ft
+
+#include "sharded_map.tpp"
+
+#endif // ********************************************** SHARDED_MAP_HPP end //
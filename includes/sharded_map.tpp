@@ -0,0 +1,128 @@
+#ifndef SHARDED_MAP_TPP
+#define SHARDED_MAP_TPP
+
+#include "sharded_map.hpp"
+
+namespace ft
+{
+    // CONSTRUCTORS =================================================================
+
+    template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+    sharded_map<Key, T, Shards, Hash, Compare, Alloc>::sharded_map(const key_compare &comp, const allocator_type &alloc, const hasher &hash)
+        : _hash(hash)
+    {
+        for (size_type i = 0; i < Shards; i++)
+        {
+            shard_type empty(comp, alloc);
+            _shards[i].map.swap(empty);
+        }
+    };
+
+    // DESTRUCTOR ==================================================================
+
+    template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+    sharded_map<Key, T, Shards, Hash, Compare, Alloc>::~sharded_map(){};
+
+    // LOOKUP ======================================================================
+
+    template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+    bool sharded_map<Key, T, Shards, Hash, Compare, Alloc>::find(const key_type &k, mapped_type &out) const
+    {
+        shard &s = _shards[shard_index(k)];
+        read_guard guard(s.lock);
+        typename shard_type::const_iterator it = s.map.find(k);
+        if (it == s.map.end())
+            return (false);
+        out = it->second;
+        return (true);
+    };
+
+    template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+    typename sharded_map<Key, T, Shards, Hash, Compare, Alloc>::size_type
+    sharded_map<Key, T, Shards, Hash, Compare, Alloc>::count(const key_type &k) const
+    {
+        shard &s = _shards[shard_index(k)];
+        read_guard guard(s.lock);
+        return (s.map.count(k));
+    };
+
+    // MODIFIERS ===================================================================
+
+    template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+    bool sharded_map<Key, T, Shards, Hash, Compare, Alloc>::insert(const value_type &val)
+    {
+        shard &s = _shards[shard_index(val.first)];
+        write_guard guard(s.lock);
+        return (s.map.insert(val).second);
+    };
+
+    template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+    typename sharded_map<Key, T, Shards, Hash, Compare, Alloc>::size_type
+    sharded_map<Key, T, Shards, Hash, Compare, Alloc>::erase(const key_type &k)
+    {
+        shard &s = _shards[shard_index(k)];
+        write_guard guard(s.lock);
+        return (s.map.erase(k));
+    };
+
+    template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+    void sharded_map<Key, T, Shards, Hash, Compare, Alloc>::clear()
+    {
+        for (size_type i = 0; i < Shards; i++)
+        {
+            write_guard guard(_shards[i].lock);
+            _shards[i].map.clear();
+        }
+    };
+
+    // SHARDS ======================================================================
+
+    template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+    template <class Visitor>
+    Visitor sharded_map<Key, T, Shards, Hash, Compare, Alloc>::for_each_shard(Visitor visitor) const
+    {
+        for (size_type i = 0; i < Shards; i++)
+        {
+            read_guard guard(_shards[i].lock);
+            visitor(static_cast<const shard_type &>(_shards[i].map));
+        }
+        return (visitor);
+    };
+
+    template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+    typename sharded_map<Key, T, Shards, Hash, Compare, Alloc>::size_type
+    sharded_map<Key, T, Shards, Hash, Compare, Alloc>::shard_index(const key_type &k) const
+    {
+        return (_hash(k) % Shards);
+    };
+
+    template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+    typename sharded_map<Key, T, Shards, Hash, Compare, Alloc>::size_type
+    sharded_map<Key, T, Shards, Hash, Compare, Alloc>::shard_count() const
+    {
+        return (Shards);
+    };
+
+    // CAPACITY ====================================================================
+
+    template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+    typename sharded_map<Key, T, Shards, Hash, Compare, Alloc>::size_type
+    sharded_map<Key, T, Shards, Hash, Compare, Alloc>::size() const
+    {
+        size_type total = 0;
+        for (size_type i = 0; i < Shards; i++)
+        {
+            read_guard guard(_shards[i].lock);
+            total += _shards[i].map.size();
+        }
+        return (total);
+    };
+
+    template <class Key, class T, size_t Shards, class Hash, class Compare, class Alloc>
+    bool sharded_map<Key, T, Shards, Hash, Compare, Alloc>::empty() const
+    {
+        return (size() == 0);
+    };
+}
+
+#endif // ********************************************** SHARDED_MAP_TPP end //
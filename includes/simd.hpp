@@ -0,0 +1,560 @@
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+// LIBS ========================================================================
+#include <cstddef>
+#if defined(__x86_64__) && defined(__SSE2__)
+#include <immintrin.h>
+#define FT_SIMD_X86 1
+#else
+#define FT_SIMD_X86 0
+#endif
+
+namespace ft
+{
+    /*
+     * Scan kernels over contiguous arrays of int, 64-bit unsigned and float, used by
+     * ft::find, ft::count, ft::min_element, ft::max_element and ft::accumulate.
+     *
+     * SSE2 is part of x86-64, so the SSE2 kernels are always built. The AVX2 kernels
+     * are compiled with a target attribute and only called when cpuid reports AVX2,
+     * so the binary still runs on older cores. Elsewhere, every kernel is the plain loop.
+     */
+    namespace simd
+    {
+        // SCALAR =================================================================
+
+        template <typename T>
+        size_t scalar_find(const T *p, size_t n, T val)
+        {
+            size_t i = 0;
+            while (i < n && !(p[i] == val))
+                i++;
+            return (i);
+        }
+
+        template <typename T>
+        size_t scalar_count(const T *p, size_t n, T val)
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < n; i++)
+                count += (p[i] == val);
+            return (count);
+        }
+
+        /**
+         * @brief Index of the first smallest (or largest when Max) element, with the
+         * comparisons of min_element and max_element. 0 for an empty array.
+         */
+        template <bool Max, typename T>
+        size_t scalar_extreme(const T *p, size_t n)
+        {
+            size_t best = 0;
+            for (size_t i = 1; i < n; i++)
+                if (Max ? p[best] < p[i] : p[i] < p[best])
+                    best = i;
+            return (best);
+        }
+
+        template <typename T>
+        T scalar_sum(const T *p, size_t n)
+        {
+            T sum = T();
+            for (size_t i = 0; i < n; i++)
+                sum += p[i];
+            return (sum);
+        }
+
+        template <typename T>
+        bool _is_nan(T)
+        {
+            return (false);
+        }
+
+        inline bool _is_nan(float x)
+        {
+            return (__builtin_isnan(x));
+        }
+
+        /**
+         * @brief Elements per block of extreme(). Multiple of every vector width.
+         */
+        static const size_t extreme_block = 1024;
+
+        /**
+         * @brief Single pass min/max: block computes the extreme value of each block of
+         * extreme_block elements with vector instructions, remembering the first block
+         * that improved the result; only that block is scanned again for the index. A
+         * block reporting NaN sends the whole array to the scalar loop, whose answer
+         * then depends on where the NaN is.
+         */
+        template <bool Max, typename T>
+        size_t extreme(const T *p, size_t n, T (*block)(const T *, size_t))
+        {
+            size_t full = n / extreme_block * extreme_block;
+            if (full == 0)
+                return (scalar_extreme<Max>(p, n));
+            T best = block(p, extreme_block);
+            size_t best_block = 0;
+            if (_is_nan(best))
+                return (scalar_extreme<Max>(p, n));
+            for (size_t b = extreme_block; b < full; b += extreme_block)
+            {
+                T m = block(p + b, extreme_block);
+                if (_is_nan(m))
+                    return (scalar_extreme<Max>(p, n));
+                if (Max ? best < m : m < best)
+                {
+                    best = m;
+                    best_block = b;
+                }
+            }
+            if (full < n)
+            {
+                size_t tail = full + scalar_extreme<Max>(p + full, n - full);
+                if (_is_nan(p[tail]))
+                    return (scalar_extreme<Max>(p, n));
+                if (Max ? best < p[tail] : p[tail] < best)
+                    return (tail);
+            }
+            return (best_block + scalar_find(p + best_block, extreme_block, best));
+        }
+
+#if FT_SIMD_X86
+        inline bool has_avx2()
+        {
+            return (__builtin_cpu_supports("avx2"));
+        }
+
+        // SSE2 ===================================================================
+
+        inline size_t find_i32_sse2(const int *p, size_t n, int val)
+        {
+            __m128i v = _mm_set1_epi32(val);
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+            {
+                int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)), v)));
+                if (mask)
+                    return (i + __builtin_ctz(mask));
+            }
+            return (i + scalar_find(p + i, n - i, val));
+        }
+
+        inline size_t count_i32_sse2(const int *p, size_t n, int val)
+        {
+            __m128i v = _mm_set1_epi32(val);
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+                count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)), v))));
+            return (count + scalar_count(p + i, n - i, val));
+        }
+
+        template <bool Max>
+        int extreme_block_i32_sse2(const int *p, size_t n)
+        {
+            __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            for (size_t i = 4; i < n; i += 4)
+            {
+                __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+                __m128i take = Max ? _mm_cmpgt_epi32(x, acc) : _mm_cmplt_epi32(x, acc);
+                acc = _mm_or_si128(_mm_and_si128(take, x), _mm_andnot_si128(take, acc));
+            }
+            int lanes[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), acc);
+            return (lanes[scalar_extreme<Max>(lanes, 4)]);
+        }
+
+        inline int sum_i32_sse2(const int *p, size_t n)
+        {
+            __m128i acc0 = _mm_setzero_si128();
+            __m128i acc1 = _mm_setzero_si128();
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                acc0 = _mm_add_epi32(acc0, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)));
+                acc1 = _mm_add_epi32(acc1, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i + 4)));
+            }
+            unsigned int lanes[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), _mm_add_epi32(acc0, acc1));
+            unsigned int sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+            for (; i < n; i++)
+                sum += static_cast<unsigned int>(p[i]);
+            return (static_cast<int>(sum));
+        }
+
+        /**
+         * @brief 64-bit equality from SSE2's 32-bit one: both halves must match.
+         */
+        inline __m128i _cmpeq_epi64_sse2(__m128i a, __m128i b)
+        {
+            __m128i eq = _mm_cmpeq_epi32(a, b);
+            return (_mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1))));
+        }
+
+        inline size_t find_u64_sse2(const unsigned long long *p, size_t n, unsigned long long val)
+        {
+            __m128i v = _mm_set1_epi64x(val);
+            size_t i = 0;
+            for (; i + 2 <= n; i += 2)
+            {
+                int mask = _mm_movemask_pd(_mm_castsi128_pd(_cmpeq_epi64_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)), v)));
+                if (mask)
+                    return (i + __builtin_ctz(mask));
+            }
+            return (i + scalar_find(p + i, n - i, val));
+        }
+
+        inline size_t count_u64_sse2(const unsigned long long *p, size_t n, unsigned long long val)
+        {
+            __m128i v = _mm_set1_epi64x(val);
+            __m128i acc = _mm_setzero_si128();
+            size_t i = 0;
+            for (; i + 2 <= n; i += 2)
+                acc = _mm_sub_epi64(acc, _cmpeq_epi64_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)), v));
+            unsigned long long lanes[2];
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), acc);
+            return (lanes[0] + lanes[1] + scalar_count(p + i, n - i, val));
+        }
+
+        inline unsigned long long sum_u64_sse2(const unsigned long long *p, size_t n)
+        {
+            __m128i acc0 = _mm_setzero_si128();
+            __m128i acc1 = _mm_setzero_si128();
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+            {
+                acc0 = _mm_add_epi64(acc0, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)));
+                acc1 = _mm_add_epi64(acc1, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i + 2)));
+            }
+            unsigned long long lanes[2];
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), _mm_add_epi64(acc0, acc1));
+            return (lanes[0] + lanes[1] + scalar_sum(p + i, n - i));
+        }
+
+        inline size_t find_f32_sse2(const float *p, size_t n, float val)
+        {
+            __m128 v = _mm_set1_ps(val);
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+            {
+                int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), v));
+                if (mask)
+                    return (i + __builtin_ctz(mask));
+            }
+            return (i + scalar_find(p + i, n - i, val));
+        }
+
+        inline size_t count_f32_sse2(const float *p, size_t n, float val)
+        {
+            __m128 v = _mm_set1_ps(val);
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+                count += __builtin_popcount(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), v)));
+            return (count + scalar_count(p + i, n - i, val));
+        }
+
+        template <bool Max>
+        float extreme_block_f32_sse2(const float *p, size_t n)
+        {
+            __m128 acc = _mm_loadu_ps(p);
+            __m128 nan = _mm_cmpunord_ps(acc, acc);
+            for (size_t i = 4; i < n; i += 4)
+            {
+                __m128 x = _mm_loadu_ps(p + i);
+                nan = _mm_or_ps(nan, _mm_cmpunord_ps(x, x));
+                acc = Max ? _mm_max_ps(acc, x) : _mm_min_ps(acc, x);
+            }
+            if (_mm_movemask_ps(nan))
+                return (__builtin_nanf(""));
+            float lanes[4];
+            _mm_storeu_ps(lanes, acc);
+            return (lanes[scalar_extreme<Max>(lanes, 4)]);
+        }
+
+        // AVX2 ===================================================================
+
+        __attribute__((target("avx2"))) inline size_t find_i32_avx2(const int *p, size_t n, int val)
+        {
+            __m256i v = _mm256_set1_epi32(val);
+            size_t i = 0;
+            for (; i + 32 <= n; i += 32)
+            {
+                __m256i eq0 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)), v);
+                __m256i eq1 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i + 8)), v);
+                __m256i eq2 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i + 16)), v);
+                __m256i eq3 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i + 24)), v);
+                __m256i any = _mm256_or_si256(_mm256_or_si256(eq0, eq1), _mm256_or_si256(eq2, eq3));
+                if (!_mm256_testz_si256(any, any))
+                {
+                    __m256i eq[4] = {eq0, eq1, eq2, eq3};
+                    for (size_t k = 0;; k++)
+                    {
+                        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq[k]));
+                        if (mask)
+                            return (i + 8 * k + __builtin_ctz(mask));
+                    }
+                }
+            }
+            return (i + find_i32_sse2(p + i, n - i, val));
+        }
+
+        __attribute__((target("avx2"))) inline size_t count_i32_avx2(const int *p, size_t n, int val)
+        {
+            __m256i v = _mm256_set1_epi32(val);
+            size_t count = 0;
+            size_t i = 0;
+            while (i + 8 <= n)
+            {
+                // Lane counters are 32 bits: flush them before they can overflow.
+                size_t end = n - (n - i) % 8;
+                if (end - i > (size_t(1) << 30))
+                    end = i + (size_t(1) << 30);
+                __m256i acc = _mm256_setzero_si256();
+                for (; i < end; i += 8)
+                    acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)), v));
+                unsigned int lanes[8];
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), acc);
+                for (size_t k = 0; k < 8; k++)
+                    count += lanes[k];
+            }
+            return (count + scalar_count(p + i, n - i, val));
+        }
+
+        template <bool Max>
+        __attribute__((target("avx2"))) int extreme_block_i32_avx2(const int *p, size_t n)
+        {
+            __m256i acc0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+            __m256i acc1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 8));
+            for (size_t i = 16; i < n; i += 16)
+            {
+                __m256i x0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+                __m256i x1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i + 8));
+                acc0 = Max ? _mm256_max_epi32(acc0, x0) : _mm256_min_epi32(acc0, x0);
+                acc1 = Max ? _mm256_max_epi32(acc1, x1) : _mm256_min_epi32(acc1, x1);
+            }
+            int lanes[8];
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), Max ? _mm256_max_epi32(acc0, acc1) : _mm256_min_epi32(acc0, acc1));
+            return (lanes[scalar_extreme<Max>(lanes, 8)]);
+        }
+
+        __attribute__((target("avx2"))) inline int sum_i32_avx2(const int *p, size_t n)
+        {
+            __m256i acc0 = _mm256_setzero_si256();
+            __m256i acc1 = _mm256_setzero_si256();
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16)
+            {
+                acc0 = _mm256_add_epi32(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)));
+                acc1 = _mm256_add_epi32(acc1, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i + 8)));
+            }
+            unsigned int lanes[8];
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), _mm256_add_epi32(acc0, acc1));
+            unsigned int sum = 0;
+            for (size_t k = 0; k < 8; k++)
+                sum += lanes[k];
+            return (static_cast<int>(sum + static_cast<unsigned int>(sum_i32_sse2(p + i, n - i))));
+        }
+
+        __attribute__((target("avx2"))) inline size_t find_u64_avx2(const unsigned long long *p, size_t n, unsigned long long val)
+        {
+            __m256i v = _mm256_set1_epi64x(val);
+            size_t i = 0;
+            for (; i + 16 <= n; i += 16)
+            {
+                __m256i eq0 = _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)), v);
+                __m256i eq1 = _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i + 4)), v);
+                __m256i eq2 = _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i + 8)), v);
+                __m256i eq3 = _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i + 12)), v);
+                __m256i any = _mm256_or_si256(_mm256_or_si256(eq0, eq1), _mm256_or_si256(eq2, eq3));
+                if (!_mm256_testz_si256(any, any))
+                {
+                    __m256i eq[4] = {eq0, eq1, eq2, eq3};
+                    for (size_t k = 0;; k++)
+                    {
+                        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(eq[k]));
+                        if (mask)
+                            return (i + 4 * k + __builtin_ctz(mask));
+                    }
+                }
+            }
+            return (i + find_u64_sse2(p + i, n - i, val));
+        }
+
+        __attribute__((target("avx2"))) inline size_t count_u64_avx2(const unsigned long long *p, size_t n, unsigned long long val)
+        {
+            __m256i v = _mm256_set1_epi64x(val);
+            __m256i acc = _mm256_setzero_si256();
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+                acc = _mm256_sub_epi64(acc, _mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)), v));
+            unsigned long long lanes[4];
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), acc);
+            return (lanes[0] + lanes[1] + lanes[2] + lanes[3] + scalar_count(p + i, n - i, val));
+        }
+
+        /**
+         * @brief AVX2 only compares signed 64-bit lanes: flipping the sign bit of both
+         * sides turns it into the unsigned comparison.
+         */
+        template <bool Max>
+        __attribute__((target("avx2"))) unsigned long long extreme_block_u64_avx2(const unsigned long long *p, size_t n)
+        {
+            __m256i sign = _mm256_set1_epi64x(static_cast<long long>(1ULL << 63));
+            __m256i acc = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)), sign);
+            for (size_t i = 4; i < n; i += 4)
+            {
+                __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)), sign);
+                __m256i take = Max ? _mm256_cmpgt_epi64(x, acc) : _mm256_cmpgt_epi64(acc, x);
+                acc = _mm256_blendv_epi8(acc, x, take);
+            }
+            unsigned long long lanes[4];
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), _mm256_xor_si256(acc, sign));
+            return (lanes[scalar_extreme<Max>(lanes, 4)]);
+        }
+
+        __attribute__((target("avx2"))) inline unsigned long long sum_u64_avx2(const unsigned long long *p, size_t n)
+        {
+            __m256i acc0 = _mm256_setzero_si256();
+            __m256i acc1 = _mm256_setzero_si256();
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                acc0 = _mm256_add_epi64(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)));
+                acc1 = _mm256_add_epi64(acc1, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i + 4)));
+            }
+            unsigned long long lanes[4];
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), _mm256_add_epi64(acc0, acc1));
+            return (lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_u64_sse2(p + i, n - i));
+        }
+
+        __attribute__((target("avx2"))) inline size_t find_f32_avx2(const float *p, size_t n, float val)
+        {
+            __m256 v = _mm256_set1_ps(val);
+            size_t i = 0;
+            for (; i + 32 <= n; i += 32)
+            {
+                __m256 eq0 = _mm256_cmp_ps(_mm256_loadu_ps(p + i), v, _CMP_EQ_OQ);
+                __m256 eq1 = _mm256_cmp_ps(_mm256_loadu_ps(p + i + 8), v, _CMP_EQ_OQ);
+                __m256 eq2 = _mm256_cmp_ps(_mm256_loadu_ps(p + i + 16), v, _CMP_EQ_OQ);
+                __m256 eq3 = _mm256_cmp_ps(_mm256_loadu_ps(p + i + 24), v, _CMP_EQ_OQ);
+                if (_mm256_movemask_ps(_mm256_or_ps(_mm256_or_ps(eq0, eq1), _mm256_or_ps(eq2, eq3))))
+                {
+                    __m256 eq[4] = {eq0, eq1, eq2, eq3};
+                    for (size_t k = 0;; k++)
+                    {
+                        int mask = _mm256_movemask_ps(eq[k]);
+                        if (mask)
+                            return (i + 8 * k + __builtin_ctz(mask));
+                    }
+                }
+            }
+            return (i + find_f32_sse2(p + i, n - i, val));
+        }
+
+        __attribute__((target("avx2"))) inline size_t count_f32_avx2(const float *p, size_t n, float val)
+        {
+            __m256 v = _mm256_set1_ps(val);
+            size_t count = 0;
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+                count += __builtin_popcount(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(p + i), v, _CMP_EQ_OQ)));
+            return (count + scalar_count(p + i, n - i, val));
+        }
+
+        template <bool Max>
+        __attribute__((target("avx2"))) float extreme_block_f32_avx2(const float *p, size_t n)
+        {
+            __m256 acc0 = _mm256_loadu_ps(p);
+            __m256 acc1 = _mm256_loadu_ps(p + 8);
+            __m256 nan = _mm256_or_ps(_mm256_cmp_ps(acc0, acc0, _CMP_UNORD_Q), _mm256_cmp_ps(acc1, acc1, _CMP_UNORD_Q));
+            for (size_t i = 16; i < n; i += 16)
+            {
+                __m256 x0 = _mm256_loadu_ps(p + i);
+                __m256 x1 = _mm256_loadu_ps(p + i + 8);
+                nan = _mm256_or_ps(nan, _mm256_or_ps(_mm256_cmp_ps(x0, x0, _CMP_UNORD_Q), _mm256_cmp_ps(x1, x1, _CMP_UNORD_Q)));
+                acc0 = Max ? _mm256_max_ps(acc0, x0) : _mm256_min_ps(acc0, x0);
+                acc1 = Max ? _mm256_max_ps(acc1, x1) : _mm256_min_ps(acc1, x1);
+            }
+            if (_mm256_movemask_ps(nan))
+                return (__builtin_nanf(""));
+            float lanes[8];
+            _mm256_storeu_ps(lanes, Max ? _mm256_max_ps(acc0, acc1) : _mm256_min_ps(acc0, acc1));
+            return (lanes[scalar_extreme<Max>(lanes, 8)]);
+        }
+
+        // DISPATCH ===============================================================
+
+        inline size_t find(const int *p, size_t n, int val)
+        {
+            return (has_avx2() ? find_i32_avx2(p, n, val) : find_i32_sse2(p, n, val));
+        }
+
+        inline size_t find(const unsigned long long *p, size_t n, unsigned long long val)
+        {
+            return (has_avx2() ? find_u64_avx2(p, n, val) : find_u64_sse2(p, n, val));
+        }
+
+        inline size_t find(const float *p, size_t n, float val)
+        {
+            return (has_avx2() ? find_f32_avx2(p, n, val) : find_f32_sse2(p, n, val));
+        }
+
+        inline size_t count(const int *p, size_t n, int val)
+        {
+            return (has_avx2() ? count_i32_avx2(p, n, val) : count_i32_sse2(p, n, val));
+        }
+
+        inline size_t count(const unsigned long long *p, size_t n, unsigned long long val)
+        {
+            return (has_avx2() ? count_u64_avx2(p, n, val) : count_u64_sse2(p, n, val));
+        }
+
+        inline size_t count(const float *p, size_t n, float val)
+        {
+            return (has_avx2() ? count_f32_avx2(p, n, val) : count_f32_sse2(p, n, val));
+        }
+
+        template <bool Max>
+        size_t extreme(const int *p, size_t n)
+        {
+            if (has_avx2())
+                return (extreme<Max>(p, n, extreme_block_i32_avx2<Max>));
+            return (extreme<Max>(p, n, extreme_block_i32_sse2<Max>));
+        }
+
+        /**
+         * @brief No unsigned 64-bit comparison before AVX2: the SSE2 path is the plain loop.
+         */
+        template <bool Max>
+        size_t extreme(const unsigned long long *p, size_t n)
+        {
+            if (!has_avx2())
+                return (scalar_extreme<Max>(p, n));
+            return (extreme<Max>(p, n, extreme_block_u64_avx2<Max>));
+        }
+
+        template <bool Max>
+        size_t extreme(const float *p, size_t n)
+        {
+            if (has_avx2())
+                return (extreme<Max>(p, n, extreme_block_f32_avx2<Max>));
+            return (extreme<Max>(p, n, extreme_block_f32_sse2<Max>));
+        }
+
+        inline int sum(const int *p, size_t n)
+        {
+            return (has_avx2() ? sum_i32_avx2(p, n) : sum_i32_sse2(p, n));
+        }
+
+        inline unsigned long long sum(const unsigned long long *p, size_t n)
+        {
+            return (has_avx2() ? sum_u64_avx2(p, n) : sum_u64_sse2(p, n));
+        }
+#endif
+    } // namespace simd
+} // namespace ft
+
+#endif // ********************************************** SIMD_HPP end //
@@ -0,0 +1,149 @@
+#ifndef SPSC_RING_HPP
+#define SPSC_RING_HPP
+
+// LIBS ========================================================================
+#include <memory>
+#include <cstddef>
+#include "./atomic.hpp"
+
+namespace ft
+{
+    // CLASS =======================================================================
+
+    /**
+     * @brief Bounded single-producer/single-consumer queue. Exactly one thread may
+     * push and exactly one (other) thread may pop; no locks are taken on either side.
+     *
+     * The capacity is rounded up to a power of two so that slot lookup is a mask.
+     * head and tail grow monotonically and live on their own cache lines; each side
+     * also keeps a private copy of the other side's index so that the shared line is
+     * only read when the cached value says the ring looks full (or empty).
+     *
+     * @tparam T Element type.
+     * @tparam Alloc Allocator used for the slot buffer, same interface as ft::vector.
+     */
+    template <typename T, typename Alloc = std::allocator<T> >
+    class spsc_ring
+    {
+    public:
+        // TYPEDEFS ==================================================================
+        typedef T value_type;
+        typedef Alloc allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef typename allocator_type::size_type size_type;
+
+    private:
+        /**
+         * @brief One side's index, padded so it owns a full cache line.
+         * cached is the last value seen of the opposite index and is only touched
+         * by the thread owning this cursor.
+         */
+        struct cursor
+        {
+            char lead[FT_CACHE_LINE_SIZE];
+            ft::atomic<size_type> index;
+            size_type cached;
+            char trail[FT_CACHE_LINE_SIZE - sizeof(ft::atomic<size_type>) - sizeof(size_type)];
+
+            cursor() : index(0), cached(0) {}
+        };
+
+        // ATTRIBUTES =================================================================
+        pointer _data;
+        size_type _capacity;
+        size_type _mask;
+        allocator_type _alloc;
+        cursor _head;
+        cursor _tail;
+
+    public:
+        // CONSTRUCTORS ==========================================================
+
+        /**
+         * @brief Constructs an empty ring able to hold at least capacity elements.
+         * The real capacity is the next power of two.
+         *
+         * @param capacity Minimum number of slots.
+         * @param alloc Allocator object.
+         */
+        explicit spsc_ring(size_type capacity, const allocator_type &alloc = allocator_type());
+
+        // DESTRUCTOR =============================================================
+
+        /**
+         * @brief Destroys the elements still queued and releases the slot buffer.
+         * No thread may be using the ring anymore.
+         *
+         */
+        ~spsc_ring();
+
+        // PRODUCER ===============================================================
+
+        /**
+         * @brief Copies val into the ring. Returns false if the ring is full.
+         *
+         */
+        bool try_push(const value_type &val);
+
+        /**
+         * @brief Copies up to n elements from the span [first, first + n) into the ring
+         * and publishes them all at once. The copy is done in at most two contiguous runs.
+         * If a copy throws, the elements already copied are destroyed, nothing is
+         * published and the exception propagates.
+         *
+         * @return The number of elements pushed, which is less than n if the ring filled up.
+         */
+        size_type try_push_n(const value_type *first, size_type n);
+
+        // CONSUMER ===============================================================
+
+        /**
+         * @brief Moves the oldest element into val. Returns false if the ring is empty.
+         *
+         */
+        bool try_pop(value_type &val);
+
+        /**
+         * @brief Assigns up to n of the oldest elements to the span [out, out + n) and
+         * releases their slots at once. The copy is done in at most two contiguous runs.
+         *
+         * @return The number of elements popped.
+         */
+        size_type try_pop_n(value_type *out, size_type n);
+
+        // CAPACITY ===============================================================
+
+        /**
+         * @brief Number of slots of the ring, always a power of two.
+         *
+         */
+        size_type capacity() const;
+
+        /**
+         * @brief Number of queued elements. Only a snapshot when the other side is running.
+         *
+         */
+        size_type size() const;
+
+        /**
+         * @brief Whether the ring holds no element. Only a snapshot when the other side is running.
+         *
+         */
+        bool empty() const;
+
+        // ALLOCATOR =============================================================
+
+        allocator_type get_allocator() const;
+
+    private:
+        spsc_ring(const spsc_ring &);
+        spsc_ring &operator=(const spsc_ring &);
+    };
+} // namespace ft
+
+#include "spsc_ring.tpp"
+
+#endif // ********************************************** SPSC_RING_HPP end //
@@ -0,0 +1,168 @@
+#ifndef SPSC_RING_TPP
+#define SPSC_RING_TPP
+
+#include <memory>
+#include <stdexcept>
+#include "spsc_ring.hpp"
+
+namespace ft
+{
+    // CONSTRUCTORS =================================================================
+
+    template <typename T, typename Alloc>
+    spsc_ring<T, Alloc>::spsc_ring(size_type capacity, const allocator_type &alloc)
+        : _data(NULL), _capacity(1), _mask(0), _alloc(alloc), _head(), _tail()
+    {
+        while (_capacity < capacity)
+        {
+            if (_capacity > _alloc.max_size() / 2)
+                throw std::length_error("spsc_ring");
+            _capacity <<= 1;
+        }
+        _mask = _capacity - 1;
+        _data = _alloc.allocate(_capacity);
+    };
+
+    // DESTRUCTOR ==================================================================
+
+    template <typename T, typename Alloc>
+    spsc_ring<T, Alloc>::~spsc_ring()
+    {
+        size_type tail = _tail.index.load(memory_order_acquire);
+        for (size_type head = _head.index.load(memory_order_relaxed); head != tail; head++)
+            _alloc.destroy(_data + (head & _mask));
+        _alloc.deallocate(_data, _capacity);
+    };
+
+    // PRODUCER ====================================================================
+
+    template <typename T, typename Alloc>
+    bool spsc_ring<T, Alloc>::try_push(const value_type &val)
+    {
+        size_type tail = _tail.index.load(memory_order_relaxed);
+        if (tail - _tail.cached == _capacity)
+        {
+            _tail.cached = _head.index.load(memory_order_acquire);
+            if (tail - _tail.cached == _capacity)
+                return false;
+        }
+        _alloc.construct(_data + (tail & _mask), val);
+        _tail.index.store(tail + 1, memory_order_release);
+        return true;
+    };
+
+    template <typename T, typename Alloc>
+    typename spsc_ring<T, Alloc>::size_type spsc_ring<T, Alloc>::try_push_n(const value_type *first, size_type n)
+    {
+        size_type tail = _tail.index.load(memory_order_relaxed);
+        size_type free_slots = _capacity - (tail - _tail.cached);
+        if (free_slots < n)
+        {
+            _tail.cached = _head.index.load(memory_order_acquire);
+            free_slots = _capacity - (tail - _tail.cached);
+        }
+        if (n > free_slots)
+            n = free_slots;
+        if (n == 0)
+            return 0;
+        size_type start = tail & _mask;
+        size_type run = _capacity - start < n ? _capacity - start : n;
+        size_type i = 0;
+        try
+        {
+            for (; i < run; i++)
+                _alloc.construct(_data + start + i, first[i]);
+            for (; i < n; i++)
+                _alloc.construct(_data + (i - run), first[i]);
+        }
+        catch (...)
+        {
+            while (i-- > 0)
+                _alloc.destroy(_data + ((start + i) & _mask));
+            throw;
+        }
+        _tail.index.store(tail + n, memory_order_release);
+        return n;
+    };
+
+    // CONSUMER ====================================================================
+
+    template <typename T, typename Alloc>
+    bool spsc_ring<T, Alloc>::try_pop(value_type &val)
+    {
+        size_type head = _head.index.load(memory_order_relaxed);
+        if (head == _head.cached)
+        {
+            _head.cached = _tail.index.load(memory_order_acquire);
+            if (head == _head.cached)
+                return false;
+        }
+        pointer slot = _data + (head & _mask);
+        val = *slot;
+        _alloc.destroy(slot);
+        _head.index.store(head + 1, memory_order_release);
+        return true;
+    };
+
+    template <typename T, typename Alloc>
+    typename spsc_ring<T, Alloc>::size_type spsc_ring<T, Alloc>::try_pop_n(value_type *out, size_type n)
+    {
+        size_type head = _head.index.load(memory_order_relaxed);
+        size_type queued = _head.cached - head;
+        if (queued < n)
+        {
+            _head.cached = _tail.index.load(memory_order_acquire);
+            queued = _head.cached - head;
+        }
+        if (n > queued)
+            n = queued;
+        if (n == 0)
+            return 0;
+        size_type start = head & _mask;
+        size_type run = _capacity - start < n ? _capacity - start : n;
+        pointer src = _data + start;
+        for (size_type i = 0; i < run; i++)
+        {
+            out[i] = src[i];
+            _alloc.destroy(src + i);
+        }
+        for (size_type i = run; i < n; i++)
+        {
+            out[i] = _data[i - run];
+            _alloc.destroy(_data + (i - run));
+        }
+        _head.index.store(head + n, memory_order_release);
+        return n;
+    };
+
+    // CAPACITY ===============================================================
+
+    template <typename T, typename Alloc>
+    typename spsc_ring<T, Alloc>::size_type spsc_ring<T, Alloc>::capacity() const
+    {
+        return (_capacity);
+    };
+
+    template <typename T, typename Alloc>
+    typename spsc_ring<T, Alloc>::size_type spsc_ring<T, Alloc>::size() const
+    {
+        size_type head = _head.index.load(memory_order_acquire);
+        return (_tail.index.load(memory_order_acquire) - head);
+    };
+
+    template <typename T, typename Alloc>
+    bool spsc_ring<T, Alloc>::empty() const
+    {
+        return (size() == 0);
+    };
+
+    // ALLOCATOR ====================================================================
+
+    template <typename T, typename Alloc>
+    typename spsc_ring<T, Alloc>::allocator_type spsc_ring<T, Alloc>::get_allocator() const
+    {
+        return (_alloc);
+    };
+}
+
+#endif // ********************************************** SPSC_RING_TPP end //
@@ -0,0 +1,164 @@
+#ifndef STATS_POLICY_HPP
+#define STATS_POLICY_HPP
+
+#include <cstddef>
+#include "atomic.hpp"
+
+namespace ft
+{
+    /**
+     * @brief Totals read back from a stats policy with counts().
+     *
+     * A reallocation is a vector buffer replaced by a larger one. Element copies are
+     * elements already held by a vector that reserve(), insert() or erase() copy to
+     * another slot, and bytes_moved is their size in bytes. Node visits are the tree
+     * nodes passed on the way down in search, insert and erase.
+     *
+     */
+    struct stats_counts
+    {
+        size_t reallocations;
+        size_t element_copies;
+        size_t bytes_moved;
+        size_t node_visits;
+
+        stats_counts() : reallocations(0), element_copies(0), bytes_moved(0), node_visits(0) {}
+    };
+
+    // NULL STATS ==================================================================
+
+    /**
+     * @brief Default stats policy of ft::vector, ft::tree and ft::map. Every hook is an
+     * empty static function, so containers built with it compile to the same code as
+     * they would without hooks and carry no extra state.
+     *
+     */
+    struct null_stats
+    {
+        static void add_reallocation() {}
+        static void add_copies(size_t, size_t) {}
+        static void add_node_visits(size_t) {}
+
+        static stats_counts counts() { return stats_counts(); }
+        static void reset() {}
+    };
+
+    // ATOMIC STATS ================================================================
+
+    /**
+     * @brief Process-wide counters bumped with relaxed atomic adds, readable from any
+     * thread. Each Tag gets its own set, so two subsystems can be counted apart.
+     *
+     * Every hook is an atomic add on a line all threads share; on paths hot in several
+     * threads at once, thread_local_stats is cheaper.
+     *
+     */
+    template <typename Tag = void>
+    struct atomic_stats
+    {
+        static void add_reallocation()
+        {
+            _counters.reallocations.fetch_add(1, memory_order_relaxed);
+        }
+
+        static void add_copies(size_t elements, size_t bytes)
+        {
+            _counters.element_copies.fetch_add(elements, memory_order_relaxed);
+            _counters.bytes_moved.fetch_add(bytes, memory_order_relaxed);
+        }
+
+        static void add_node_visits(size_t nodes)
+        {
+            _counters.node_visits.fetch_add(nodes, memory_order_relaxed);
+        }
+
+        static stats_counts counts()
+        {
+            stats_counts totals;
+            totals.reallocations = _counters.reallocations.load(memory_order_relaxed);
+            totals.element_copies = _counters.element_copies.load(memory_order_relaxed);
+            totals.bytes_moved = _counters.bytes_moved.load(memory_order_relaxed);
+            totals.node_visits = _counters.node_visits.load(memory_order_relaxed);
+            return totals;
+        }
+
+        static void reset()
+        {
+            _counters.reallocations.store(0, memory_order_relaxed);
+            _counters.element_copies.store(0, memory_order_relaxed);
+            _counters.bytes_moved.store(0, memory_order_relaxed);
+            _counters.node_visits.store(0, memory_order_relaxed);
+        }
+
+    private:
+        struct counters
+        {
+            ft::atomic<size_t> reallocations;
+            ft::atomic<size_t> element_copies;
+            ft::atomic<size_t> bytes_moved;
+            ft::atomic<size_t> node_visits;
+        };
+
+        static counters _counters;
+    };
+
+    template <typename Tag>
+    typename atomic_stats<Tag>::counters atomic_stats<Tag>::_counters;
+
+    // THREAD LOCAL STATS ==========================================================
+
+    /**
+     * @brief Counters kept per thread, bumped with plain adds. counts() and reset() see
+     * only the calling thread's counters; a thread that wants its totals reported reads
+     * them before it exits. Each Tag gets its own set.
+     *
+     */
+    template <typename Tag = void>
+    struct thread_local_stats
+    {
+        static void add_reallocation() { _reallocations++; }
+
+        static void add_copies(size_t elements, size_t bytes)
+        {
+            _element_copies += elements;
+            _bytes_moved += bytes;
+        }
+
+        static void add_node_visits(size_t nodes) { _node_visits += nodes; }
+
+        static stats_counts counts()
+        {
+            stats_counts totals;
+            totals.reallocations = _reallocations;
+            totals.element_copies = _element_copies;
+            totals.bytes_moved = _bytes_moved;
+            totals.node_visits = _node_visits;
+            return totals;
+        }
+
+        static void reset()
+        {
+            _reallocations = 0;
+            _element_copies = 0;
+            _bytes_moved = 0;
+            _node_visits = 0;
+        }
+
+    private:
+        static __thread size_t _reallocations;
+        static __thread size_t _element_copies;
+        static __thread size_t _bytes_moved;
+        static __thread size_t _node_visits;
+    };
+
+    template <typename Tag>
+    __thread size_t thread_local_stats<Tag>::_reallocations = 0;
+    template <typename Tag>
+    __thread size_t thread_local_stats<Tag>::_element_copies = 0;
+    template <typename Tag>
+    __thread size_t thread_local_stats<Tag>::_bytes_moved = 0;
+    template <typename Tag>
+    __thread size_t thread_local_stats<Tag>::_node_visits = 0;
+} // namespace ft
+
+#endif // ********************************************** STATS_POLICY_HPP end //
@@ -0,0 +1,250 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+// LIBS ========================================================================
+#include <cstddef>
+#include <new>
+#include <string>
+#include <stdexcept>
+#include <pthread.h>
+#include <unistd.h>
+
+namespace ft
+{
+    // CLASS =======================================================================
+
+    /**
+     * @brief Fixed set of pthreads running submitted tasks in FIFO order.
+     *
+     * A task is a plain function pointer and an argument, the caller owns the argument
+     * and must keep it alive until wait() returns. Tasks must not throw: there is no
+     * way to hand an exception back to the submitting thread in C++98. A task that can
+     * fail catches into a task_failure, which the submitter rethrows after wait().
+     */
+    class thread_pool
+    {
+    public:
+        typedef void (*task_function)(void *);
+
+        /**
+         * @brief Starts the given number of threads, or one per online core when 0.
+         *
+         */
+        explicit thread_pool(size_t threads = 0) : _head(NULL), _tail(NULL), _pending(0), _stop(false), _threads(NULL), _count(0)
+        {
+            if (threads == 0)
+                threads = hardware_concurrency();
+            pthread_mutex_init(&_lock, NULL);
+            pthread_cond_init(&_work, NULL);
+            pthread_cond_init(&_idle, NULL);
+            _threads = new pthread_t[threads];
+            for (; _count < threads; _count++)
+            {
+                if (pthread_create(&_threads[_count], NULL, _run, this) != 0)
+                {
+                    _shutdown();
+                    throw std::runtime_error("thread_pool: pthread_create failed");
+                }
+            }
+        }
+
+        /**
+         * @brief Runs every task still queued, then joins the threads.
+         *
+         */
+        ~thread_pool()
+        {
+            _shutdown();
+        }
+
+        /**
+         * @brief Queues fn(arg) to run on one of the threads.
+         *
+         */
+        void submit(task_function fn, void *arg)
+        {
+            task *t = new task;
+            t->fn = fn;
+            t->arg = arg;
+            t->next = NULL;
+            pthread_mutex_lock(&_lock);
+            if (_tail)
+                _tail->next = t;
+            else
+                _head = t;
+            _tail = t;
+            _pending++;
+            pthread_cond_signal(&_work);
+            pthread_mutex_unlock(&_lock);
+        }
+
+        /**
+         * @brief Blocks until every task submitted so far has finished.
+         *
+         */
+        void wait()
+        {
+            pthread_mutex_lock(&_lock);
+            while (_pending)
+                pthread_cond_wait(&_idle, &_lock);
+            pthread_mutex_unlock(&_lock);
+        }
+
+        /**
+         * @brief Number of threads of the pool.
+         *
+         */
+        size_t size() const
+        {
+            return (_count);
+        }
+
+        /**
+         * @brief Number of online cores, at least 1.
+         *
+         */
+        static size_t hardware_concurrency()
+        {
+            long cores = sysconf(_SC_NPROCESSORS_ONLN);
+            return (cores > 0 ? static_cast<size_t>(cores) : 1);
+        }
+
+    private:
+        struct task
+        {
+            task_function fn;
+            void *arg;
+            task *next;
+        };
+
+        // ATTRIBUTES ==========================================================
+        pthread_mutex_t _lock;
+        pthread_cond_t _work;
+        pthread_cond_t _idle;
+        task *_head;
+        task *_tail;
+        size_t _pending;
+        bool _stop;
+        pthread_t *_threads;
+        size_t _count;
+
+        thread_pool(const thread_pool &);
+        thread_pool &operator=(const thread_pool &);
+
+        static void *_run(void *arg)
+        {
+            thread_pool *pool = static_cast<thread_pool *>(arg);
+            pthread_mutex_lock(&pool->_lock);
+            for (;;)
+            {
+                while (!pool->_head && !pool->_stop)
+                    pthread_cond_wait(&pool->_work, &pool->_lock);
+                if (!pool->_head)
+                    break;
+                task *t = pool->_head;
+                pool->_head = t->next;
+                if (!pool->_head)
+                    pool->_tail = NULL;
+                pthread_mutex_unlock(&pool->_lock);
+                t->fn(t->arg);
+                delete t;
+                pthread_mutex_lock(&pool->_lock);
+                if (--pool->_pending == 0)
+                    pthread_cond_broadcast(&pool->_idle);
+            }
+            pthread_mutex_unlock(&pool->_lock);
+            return (NULL);
+        }
+
+        void _shutdown()
+        {
+            pthread_mutex_lock(&_lock);
+            _stop = true;
+            pthread_cond_broadcast(&_work);
+            pthread_mutex_unlock(&_lock);
+            for (size_t i = 0; i < _count; i++)
+                pthread_join(_threads[i], NULL);
+            delete[] _threads;
+            pthread_cond_destroy(&_idle);
+            pthread_cond_destroy(&_work);
+            pthread_mutex_destroy(&_lock);
+        }
+    };
+
+    /**
+     * @brief What a task threw, kept until the submitting thread rethrows it. C++98 has
+     * no exception_ptr, so only what can be copied is kept: std::bad_alloc is thrown
+     * again as std::bad_alloc, another std::exception as a std::runtime_error with the
+     * same what(), anything else as a std::runtime_error saying so.
+     */
+    class task_failure
+    {
+    public:
+        task_failure() : _kind(none) {}
+
+        /**
+         * @brief Records the exception being handled. Call it from a catch block.
+         *
+         */
+        void capture()
+        {
+            try
+            {
+                throw;
+            }
+            catch (std::bad_alloc &)
+            {
+                _kind = out_of_memory;
+            }
+            catch (std::exception &e)
+            {
+                _kind = exception;
+                try
+                {
+                    _what = e.what();
+                }
+                catch (...)
+                {
+                    _kind = out_of_memory;
+                }
+            }
+            catch (...)
+            {
+                _kind = unknown;
+            }
+        }
+
+        bool failed() const
+        {
+            return (_kind != none);
+        }
+
+        /**
+         * @brief Throws what capture() recorded, if anything.
+         *
+         */
+        void rethrow() const
+        {
+            if (_kind == out_of_memory)
+                throw std::bad_alloc();
+            if (_kind == exception)
+                throw std::runtime_error(_what);
+            if (_kind == unknown)
+                throw std::runtime_error("thread_pool: task threw an unknown exception");
+        }
+
+    private:
+        enum kind
+        {
+            none,
+            out_of_memory,
+            exception,
+            unknown
+        };
+
+        kind _kind;
+        std::string _what;
+    };
+} // namespace ft
+
+#endif // ********************************************** THREAD_POOL_HPP end //
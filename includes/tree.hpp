@@ -4,49 +4,97 @@
 #include <functional>
 #include <memory>
 #include <cstddef>
+#include <new>
+#include <stdexcept>
 #include "tree_iterator.hpp"
 #include "pair.hpp"
 #include "tree_node.hpp"
+#include "tree_stats.hpp"
+#include "stats_policy.hpp"
 
 namespace ft
 {
+    /**
+     * @brief Red-black tree backing ft::map.
+     *
+     * Missing children are NULL. The sentinel, a node's links without a value kept in
+     * the tree rather than on the heap, is the root's parent and its left child is the
+     * root, so end() is reached by climbing past the root and an empty tree neither
+     * allocates nor builds a value_type. Every node
+     * keeps the size of its subtree, which lets split() and join() hand whole
+     * subtrees between trees in O(log n) and still know how many nodes each got.
+     *
+     * Stats is a compile-time policy told how many nodes each descent visits; the
+     * default ft::null_stats compiles the hook away. The runtime tree_counters from
+     * set_counters() are separate and cost a null test when detached.
+     */
     template <class T, class Compare = std::less<T>, class Node = TREE_Node<T>,
-              class Alloc = std::allocator<T>, class Node_Alloc = std::allocator<Node> >
+              class Alloc = std::allocator<T>, class Node_Alloc = std::allocator<Node>,
+              class Stats = ft::null_stats>
     class tree
     {
     public:
         typedef tree self;
         typedef self &self_ref;
         typedef T value_type;
+        typedef Compare value_compare;
         typedef Node node_type;
         typedef Node *node_pointer;
         typedef Node &node_ref;
         typedef Alloc allocator_type;
         typedef Node_Alloc node_allocator_type;
-        typedef ft::tree_iterator<Node, node_type> iterator;
-        typedef ft::tree_const_iterator<Node, node_type> const_iterator;
+        typedef Stats stats_policy;
+        typedef ft::tree_iterator<Node> iterator;
+        typedef ft::tree_const_iterator<Node> const_iterator;
         typedef size_t size_type;
 
+        /**
+         * @brief Below this many nodes, a range is removed node by node rather than with
+         * two splits and a join
+         *
+         */
+        static const size_type range_remove_threshold = 16;
+
+        /**
+         * @brief Bound on the height of a red-black tree, at most 2 log2(n + 1)
+         *
+         */
+        static const size_type visit_stack_depth = 2 * sizeof(size_type) * 8;
+
     private:
-        node_pointer _root;
-        node_pointer _end;
-        size_type _size;
+        typename node_type::base_type _header;
         Compare _comp;
         allocator_type _alloc;
         node_allocator_type _node_alloc;
+        tree_counters *_counters;
 
     public:
         /**
          * @brief Construct a new empty tree object
          *
          */
-        tree() : _root(NULL), _end(NULL), _size(0), _comp(), _alloc(), _node_alloc()
+        tree(const Compare &comp = Compare(), const allocator_type &alloc = allocator_type(),
+             const node_allocator_type &node_alloc = node_allocator_type())
+            : _header(), _comp(comp), _alloc(alloc), _node_alloc(node_alloc), _counters(NULL)
         {
-            _end = _node_alloc.allocate(1);
-            _node_alloc.construct(_end, node_type());
-            _end->parent = _end;
-            _end->left = _end;
-            _end->right = _end;
+        }
+
+        /**
+         * @brief Construct a tree with the same shape and values as other
+         *
+         */
+        tree(const tree &other)
+            : _header(), _comp(other._comp), _alloc(other._alloc), _node_alloc(other._node_alloc), _counters(NULL)
+        {
+            try
+            {
+                _clone(other);
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
         }
 
         /**
@@ -55,8 +103,60 @@ namespace ft
          */
         ~tree()
         {
-            _node_alloc.destroy(_end);
-            _node_alloc.deallocate(_end, 1);
+            clear();
+        }
+
+        /**
+         * @brief Replace the content with a copy of other
+         *
+         */
+        tree &operator=(const tree &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                _comp = other._comp;
+                _clone(other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Get the root node, NULL when the tree is empty
+         *
+         */
+        node_pointer root() const
+        {
+            return _end()->left;
+        }
+
+        /**
+         * @brief Get the sentinel node
+         *
+         */
+        node_pointer end_node() const
+        {
+            return _end();
+        }
+
+        iterator begin()
+        {
+            return iterator(lowest(root()), _end());
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(lowest(root()), _end());
+        }
+
+        iterator end()
+        {
+            return iterator(_end(), _end());
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(_end(), _end());
         }
 
         /**
@@ -67,113 +167,341 @@ namespace ft
          */
         ft::pair<iterator, bool> insert(const value_type &val)
         {
-            node_pointer new_node = _node_alloc.allocate(1);
-            _node_alloc.construct(new_node, node_type(val));
-            new_node->parent = _end;
-            new_node->left = _end;
-            new_node->right = _end;
-            if (_root == NULL)
+            node_pointer parent;
+            bool left;
+            size_type comparisons;
+            node_pointer found = _descend(val, parent, left, comparisons);
+            _count_insert(comparisons);
+            if (found != _end())
+                return ft::make_pair(iterator(found, _end()), false);
+            return ft::make_pair(_link(_new_node(val), parent, left), true);
+        }
+
+        /**
+         * @brief Link a node unlinked from a tree of the same type, unless its value is
+         * already there. Nothing is allocated nor copied
+         *
+         * @param node_ptr
+         * @return ft::pair<iterator, bool> The node with an equal value and false when
+         * node_ptr was not linked
+         */
+        ft::pair<iterator, bool> insert_node(node_pointer node_ptr)
+        {
+            node_pointer parent;
+            bool left;
+            size_type comparisons;
+            node_pointer found = _descend(node_ptr->value(), parent, left, comparisons);
+            _count_insert(comparisons);
+            if (found != _end())
+                return ft::make_pair(iterator(found, _end()), false);
+            return ft::make_pair(_link(node_ptr, parent, left), true);
+        }
+
+        /**
+         * @brief Move every node of other whose value is not here into this tree,
+         * rewiring pointers only. Nodes with a value already here stay in other. An
+         * empty tree takes the whole of other at once
+         *
+         */
+        void merge(tree &other)
+        {
+            if (&other == this)
+                return;
+            if (root() == NULL)
             {
-                _root = new_node;
-                _size++;
-                return ft::make_pair<iterator, bool>(iterator(new_node), true);
+                _adopt_root(other.root());
+                other._end()->left = NULL;
+                return;
             }
-            node_pointer tmp = _root;
-            while (tmp != _end)
+            node_pointer node_ptr = other.lowest(other.root());
+            while (node_ptr != other._end())
             {
-                if (_comp(val, tmp->data))
-                {
-                    if (tmp->left == _end)
-                    {
-                        tmp->left = new_node;
-                        new_node->parent = tmp;
-                        _size++;
-                        return ft::make_pair<iterator, bool>(iterator(new_node), true);
-                    }
-                    tmp = tmp->left;
-                }
-                else if (_comp(tmp->data, val))
-                {
-                    if (tmp->right == _end)
-                    {
-                        tmp->right = new_node;
-                        new_node->parent = tmp;
-                        _size++;
-                        return ft::make_pair<iterator, bool>(iterator(new_node), true);
-                    }
-                    tmp = tmp->right;
-                }
-                else
-                {
-                    _node_alloc.destroy(new_node);
-                    _node_alloc.deallocate(new_node, 1);
-                    return ft::make_pair<iterator, bool>(iterator(tmp), false);
-                }
+                node_pointer next = other._successor(node_ptr);
+                node_pointer parent;
+                bool left;
+                size_type comparisons;
+                node_pointer found = _descend(node_ptr->value(), parent, left, comparisons);
+                _count_insert(comparisons);
+                if (found == _end())
+                    _link(other.unlink(node_ptr), parent, left);
+                node_ptr = next;
             }
-            return ft::make_pair<iterator, bool>(iterator(new_node), true);
         }
 
         /**
          * @brief Remove a node by key
          *
+         * @param key A value, or a key the comparator orders against node keys
+         * @return size_type The number of removed nodes (0 or 1)
+         */
+        template <class K>
+        size_type remove(const K &key)
+        {
+            size_type comparisons;
+            node_pointer node_ptr = _search(key, comparisons);
+            if (_counters != NULL)
+            {
+                _counters->erases++;
+                _counters->erase_comparisons += comparisons;
+            }
+            if (node_ptr == _end())
+                return 0;
+            remove(node_ptr);
+            return 1;
+        }
+
+        /**
+         * @brief Unlink and free a node of the tree
+         *
          * @param node_ptr
-         * @param key
+         */
+        void remove(node_pointer node_ptr)
+        {
+            _delete_node(unlink(node_ptr));
+        }
+
+        /**
+         * @brief Unlink and free the nodes from first up to last excluded, in
+         * O(k + log n): the range is split off, cleared, and the rest joined back.
+         * Ranges shorter than range_remove_threshold are removed node by node
          *
          */
-        void remove(node_pointer node_ptr, const value_type &key)
+        void remove(node_pointer first, node_pointer last)
         {
-            if (node_ptr == _end)
+            if (first == last)
                 return;
-            if (_comp(key, node_ptr->data))
-                remove(node_ptr->left, key);
-            else if (_comp(node_ptr->data, key))
-                remove(node_ptr->right, key);
-            else
+            if (first == lowest(root()) && last == _end())
             {
-                if (node_ptr->left == _end)
+                clear();
+                return;
+            }
+            node_pointer node_ptr = first;
+            for (size_type i = 0; i < range_remove_threshold && node_ptr != last; i++)
+                node_ptr = _successor(node_ptr);
+            if (node_ptr == last)
+            {
+                while (first != last)
                 {
-                    if (node_ptr->parent->left == node_ptr)
-                        node_ptr->parent->left = node_ptr->right;
-                    else
-                        node_ptr->parent->right = node_ptr->right;
-                    node_ptr->right->parent = node_ptr->parent;
-                    _node_alloc.destroy(node_ptr);
-                    _node_alloc.deallocate(node_ptr, 1);
-                    _size--;
+                    node_pointer next = _successor(first);
+                    remove(first);
+                    first = next;
                 }
-                else if (node_ptr->right == _end)
+                return;
+            }
+            tree range(_comp, _alloc, _node_alloc);
+            tree right(_comp, _alloc, _node_alloc);
+            range._counters = _counters;
+            if (last != _end())
+                split(last->value(), right);
+            split(first->value(), range);
+            join(right);
+        }
+
+        /**
+         * @brief Take a node out of the tree without freeing it. Its links are cleared,
+         * the caller owns it until insert_node() links it again
+         *
+         * @param node_ptr
+         * @return node_pointer
+         */
+        node_pointer unlink(node_pointer node_ptr)
+        {
+            node_pointer moved = node_ptr;
+            bool removed_red = node_ptr->red();
+            node_pointer child;
+            node_pointer child_parent;
+            if (node_ptr->left == NULL)
+            {
+                child = node_ptr->right;
+                child_parent = node_ptr->parent();
+                _transplant(node_ptr, child);
+            }
+            else if (node_ptr->right == NULL)
+            {
+                child = node_ptr->left;
+                child_parent = node_ptr->parent();
+                _transplant(node_ptr, child);
+            }
+            else
+            {
+                moved = lowest(node_ptr->right);
+                removed_red = moved->red();
+                child = moved->right;
+                if (moved->parent() == node_ptr)
+                    child_parent = moved;
+                else
                 {
-                    if (node_ptr->parent->left == node_ptr)
-                        node_ptr->parent->left = node_ptr->left;
-                    else
-                        node_ptr->parent->right = node_ptr->left;
-                    node_ptr->left->parent = node_ptr->parent;
-                    _node_alloc.destroy(node_ptr);
-                    _node_alloc.deallocate(node_ptr, 1);
-                    _size--;
+                    child_parent = moved->parent();
+                    _transplant(moved, child);
+                    moved->right = node_ptr->right;
+                    moved->right->set_parent(moved);
                 }
+                _transplant(node_ptr, moved);
+                moved->left = node_ptr->left;
+                moved->left->set_parent(moved);
+                moved->set_red(node_ptr->red());
+            }
+            for (node_pointer tmp = child_parent; tmp != _end(); tmp = tmp->parent())
+                _update_size(tmp);
+            if (!removed_red)
+                _erase_fixup(child, child_parent);
+            node_ptr->left = NULL;
+            node_ptr->right = NULL;
+            node_ptr->set_parent(NULL);
+            node_ptr->size = 1;
+            node_ptr->set_red(true);
+            return node_ptr;
+        }
+
+        /**
+         * @brief Free every node, walking the tree once in post-order
+         *
+         */
+        void clear()
+        {
+            node_pointer node_ptr = root();
+            while (node_ptr != NULL && node_ptr != _end())
+            {
+                if (node_ptr->left != NULL)
+                    node_ptr = node_ptr->left;
+                else if (node_ptr->right != NULL)
+                    node_ptr = node_ptr->right;
                 else
                 {
-                    node_pointer tmp = node_ptr->right;
-                    while (tmp->left != _end)
-                        tmp = tmp->left;
-                    node_ptr->data = tmp->data;
-                    remove(tmp, tmp->data);
+                    node_pointer parent = node_ptr->parent();
+                    if (parent->left == node_ptr)
+                        parent->left = NULL;
+                    else
+                        parent->right = NULL;
+                    _delete_node(node_ptr);
+                    node_ptr = parent;
                 }
             }
         }
 
+        /**
+         * @brief Replace the content with the n values starting at first, which must be
+         * sorted and unique. Builds a balanced tree in O(n), without comparing values:
+         * only the nodes on its deepest level are red
+         *
+         */
+        template <class RandomIt>
+        void assign_sorted(RandomIt first, size_type n)
+        {
+            clear();
+            size_type red_depth = 0;
+            while ((n >> red_depth) > 1)
+                red_depth++;
+            try
+            {
+                _build_sorted(first, n, _end(), _end()->left, 0, red_depth);
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+            if (root() != NULL)
+                root()->set_red(false);
+        }
+
+        /**
+         * @brief Move the values not less than key into right, replacing its content,
+         * in O(log n). Nodes are relinked, never copied: iterators to the nodes moved
+         * are invalidated. key is a value, or a key the comparator orders against node
+         * keys
+         *
+         */
+        template <class K>
+        void split(const K &key, tree &right)
+        {
+            if (&right == this)
+                return;
+            right.clear();
+            node_pointer node_ptr = root();
+            if (node_ptr == NULL)
+                return;
+            size_type height = _black_height(node_ptr);
+            _end()->left = NULL;
+            node_pointer low;
+            node_pointer high;
+            size_type low_height;
+            size_type high_height;
+            _split(node_ptr, height, key, low, low_height, high, high_height);
+            _adopt_root(low);
+            right._adopt_root(high);
+        }
+
+        /**
+         * @brief Move every node of other into this tree in O(log n), other becoming
+         * empty. All values of other must go after all values here, or all before:
+         * throws std::invalid_argument otherwise
+         *
+         */
+        void join(tree &other)
+        {
+            if (&other == this || other.root() == NULL)
+                return;
+            if (root() == NULL)
+            {
+                _adopt_root(other.root());
+                other._end()->left = NULL;
+                return;
+            }
+            bool after = _comp(highest(root())->key(), other.lowest(other.root())->key());
+            if (!after && !_comp(other.highest(other.root())->key(), lowest(root())->key()))
+                throw std::invalid_argument("tree::join: ranges overlap");
+            node_pointer middle = after ? other.lowest(other.root()) : lowest(root());
+            if (after)
+                other.unlink(middle);
+            else
+                unlink(middle);
+            node_pointer mine = root();
+            node_pointer theirs = other.root();
+            _end()->left = NULL;
+            other._end()->left = NULL;
+            size_type height;
+            node_pointer joined;
+            if (after)
+                joined = _join(mine, _black_height(mine), middle, theirs, _black_height(theirs), height);
+            else
+                joined = _join(theirs, _black_height(theirs), middle, mine, _black_height(mine), height);
+            _adopt_root(joined);
+        }
+
+        /**
+         * @brief Exchange the content of two trees without copying nodes
+         *
+         */
+        void swap(tree &other)
+        {
+            node_pointer tmp_root = root();
+            Compare tmp_comp = _comp;
+            allocator_type tmp_alloc = _alloc;
+            node_allocator_type tmp_node_alloc = _node_alloc;
+
+            _adopt_root(other.root());
+            _comp = other._comp;
+            _alloc = other._alloc;
+            _node_alloc = other._node_alloc;
+
+            other._adopt_root(tmp_root);
+            other._comp = tmp_comp;
+            other._alloc = tmp_alloc;
+            other._node_alloc = tmp_node_alloc;
+        }
+
         /**
          * @brief Get highest node
          *
          * @param node_ptr
          * @return node_pointer
          */
-        node_pointer highest(node_pointer node_ptr)
+        node_pointer highest(node_pointer node_ptr) const
         {
-            if (node_ptr == _end)
-                return _end;
-            while (node_ptr->right != _end)
+            if (node_ptr == NULL || node_ptr == _end())
+                return _end();
+            while (node_ptr->right != NULL)
                 node_ptr = node_ptr->right;
             return node_ptr;
         }
@@ -184,11 +512,11 @@ namespace ft
          * @param node_ptr
          * @return node_pointer
          */
-        node_pointer lowest(node_pointer node_ptr)
+        node_pointer lowest(node_pointer node_ptr) const
         {
-            if (node_ptr == _end)
-                return _end;
-            while (node_ptr->left != _end)
+            if (node_ptr == NULL || node_ptr == _end())
+                return _end();
+            while (node_ptr->left != NULL)
                 node_ptr = node_ptr->left;
             return node_ptr;
         }
@@ -196,22 +524,142 @@ namespace ft
         /**
          * @brief Search for a node by key
          *
-         * @param key
+         * @param key A value, or a key the comparator orders against node keys
+         * @return node_pointer
+         */
+        template <class K>
+        node_pointer search(const K &key) const
+        {
+            size_type comparisons;
+            node_pointer found = _search(key, comparisons);
+            if (_counters != NULL)
+            {
+                _counters->finds++;
+                _counters->find_comparisons += comparisons;
+            }
+            return found;
+        }
+
+        /**
+         * @brief First node whose value does not go before key
+         *
+         * @param key A value, or a key the comparator orders against node keys
          * @return node_pointer
          */
-        node_pointer search(const value_type &key)
+        template <class K>
+        node_pointer lower_bound(const K &key) const
         {
-            node_pointer tmp = _root;
-            while (tmp != _end)
+            node_pointer result = _end();
+            node_pointer tmp = root();
+            while (tmp != NULL)
             {
-                if (_comp(key, tmp->data))
+                if (!_comp(tmp->key(), key))
+                {
+                    result = tmp;
                     tmp = tmp->left;
-                else if (_comp(tmp->data, key))
+                }
+                else
                     tmp = tmp->right;
+            }
+            return result;
+        }
+
+        /**
+         * @brief First node whose value goes after key
+         *
+         * @param key A value, or a key the comparator orders against node keys
+         * @return node_pointer
+         */
+        template <class K>
+        node_pointer upper_bound(const K &key) const
+        {
+            node_pointer result = _end();
+            node_pointer tmp = root();
+            while (tmp != NULL)
+            {
+                if (_comp(key, tmp->key()))
+                {
+                    result = tmp;
+                    tmp = tmp->left;
+                }
                 else
+                    tmp = tmp->right;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Call visitor(value) on the values not less than low and less than high,
+         * in order, until it returns false. The walk keeps the pending ancestors on a
+         * stack instead of climbing parent pointers, and prefetches the right child of
+         * each node it stacks, which is needed once the left subtree is done
+         *
+         * @return false when the visitor stopped the walk
+         */
+        template <class K, class Visitor>
+        bool visit(const K &low, const K &high, Visitor &visitor) const
+        {
+            node_pointer stack[visit_stack_depth];
+            size_type top = 0;
+            node_pointer node_ptr = root();
+            while (node_ptr != NULL)
+            {
+                if (_comp(node_ptr->key(), low))
+                    node_ptr = node_ptr->right;
+                else
+                {
+                    __builtin_prefetch(node_ptr->right);
+                    stack[top++] = node_ptr;
+                    node_ptr = node_ptr->left;
+                }
+            }
+            while (top != 0)
+            {
+                node_ptr = stack[--top];
+                if (!_comp(node_ptr->key(), high))
+                    return true;
+                if (!visitor(node_ptr->value()))
+                    return false;
+                for (node_ptr = node_ptr->right; node_ptr != NULL; node_ptr = node_ptr->left)
+                {
+                    __builtin_prefetch(node_ptr->right);
+                    stack[top++] = node_ptr;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Node of the given rank in order, in O(log n) through the subtree
+         * sizes; the sentinel when rank is not less than size()
+         *
+         */
+        node_pointer select(size_type rank) const
+        {
+            node_pointer tmp = root();
+            while (tmp != NULL)
+            {
+                size_type left = _subtree_size(tmp->left);
+                if (rank == left)
                     return tmp;
+                if (rank < left)
+                    tmp = tmp->left;
+                else
+                {
+                    rank -= left + 1;
+                    tmp = tmp->right;
+                }
             }
-            return _end;
+            return _end();
+        }
+
+        /**
+         * @brief Number of nodes in the tree
+         *
+         */
+        size_type size() const
+        {
+            return _subtree_size(root());
         }
 
         /**
@@ -222,6 +670,667 @@ namespace ft
         {
             return _node_alloc.max_size();
         }
+
+        value_compare value_comp() const
+        {
+            return _comp;
+        }
+
+        allocator_type get_allocator() const
+        {
+            return _alloc;
+        }
+
+        node_allocator_type get_node_allocator() const
+        {
+            return _node_alloc;
+        }
+
+        /**
+         * @brief Measure the depth of every node, walking the tree once
+         *
+         */
+        tree_shape shape() const
+        {
+            tree_shape result;
+            node_pointer node_ptr = root();
+            if (node_ptr == NULL)
+                return result;
+            result.size = node_ptr->size;
+            result.black_height = _black_height(node_ptr);
+            ft::vector<ft::pair<node_pointer, size_type> > pending;
+            pending.push_back(ft::make_pair(node_ptr, static_cast<size_type>(0)));
+            while (!pending.empty())
+            {
+                node_ptr = pending.back().first;
+                size_type depth = pending.back().second;
+                pending.pop_back();
+                if (result.depth_histogram.size() <= depth)
+                    result.depth_histogram.push_back(0);
+                result.depth_histogram[depth]++;
+                result.depth_sum += depth;
+                if (depth > result.max_depth)
+                    result.max_depth = depth;
+                if (node_ptr->left != NULL)
+                    pending.push_back(ft::make_pair(node_ptr->left, depth + 1));
+                if (node_ptr->right != NULL)
+                    pending.push_back(ft::make_pair(node_ptr->right, depth + 1));
+            }
+            result.height = result.max_depth + 1;
+            return result;
+        }
+
+        /**
+         * @brief Check the links, the order of the values, the subtree sizes and the
+         * red-black rules
+         *
+         * @return NULL when the tree is sound, otherwise what is wrong with it
+         */
+        const char *validate() const
+        {
+            node_pointer node_ptr = root();
+            if (node_ptr == NULL)
+                return NULL;
+            if (node_ptr->parent() != _end())
+                return "root is not the child of the sentinel";
+            if (node_ptr->red())
+                return "red root";
+            size_type black_height;
+            return _validate(node_ptr, NULL, NULL, 0, black_height);
+        }
+
+        /**
+         * @brief Count the costs of the following operations into counters, which must
+         * outlive the tree or be detached with NULL. Copies of the tree do not count
+         *
+         */
+        void set_counters(tree_counters *counters)
+        {
+            _counters = counters;
+        }
+
+        tree_counters *counters() const
+        {
+            return _counters;
+        }
+
+    private:
+        /**
+         * @brief The sentinel, kept inside the tree so that an empty tree owns no memory.
+         * Only its links are ever used through the returned pointer, never its value.
+         * Swapping trees relinks the roots rather than exchanging sentinels.
+         *
+         */
+        node_pointer _end() const
+        {
+            return static_cast<node_pointer>(const_cast<typename node_type::base_type *>(&_header));
+        }
+
+        /**
+         * @brief Allocate a node and let its layout build it in place, handing over
+         * _alloc for a value kept apart from the node
+         *
+         */
+        node_pointer _new_node(const value_type &val)
+        {
+            node_pointer new_node = _node_alloc.allocate(1);
+            try
+            {
+                node_type::construct(new_node, val, _alloc);
+            }
+            catch (...)
+            {
+                _node_alloc.deallocate(new_node, 1);
+                throw;
+            }
+            if (_counters != NULL)
+                _counters->allocations += node_type::allocations;
+            return new_node;
+        }
+
+        void _delete_node(node_pointer node_ptr)
+        {
+            node_type::destroy(node_ptr, _alloc);
+            _node_alloc.deallocate(node_ptr, 1);
+            if (_counters != NULL)
+                _counters->deallocations += node_type::allocations;
+        }
+
+        static size_type _subtree_size(node_pointer node_ptr)
+        {
+            return node_ptr == NULL ? 0 : node_ptr->size;
+        }
+
+        static bool _is_red(node_pointer node_ptr)
+        {
+            return node_ptr != NULL && node_ptr->red();
+        }
+
+        static void _update_size(node_pointer node_ptr)
+        {
+            node_ptr->size = 1 + _subtree_size(node_ptr->left) + _subtree_size(node_ptr->right);
+        }
+
+        /**
+         * @brief Number of black nodes on any path from node_ptr down to a leaf
+         *
+         */
+        static size_type _black_height(node_pointer node_ptr)
+        {
+            size_type height = 0;
+            for (; node_ptr != NULL; node_ptr = node_ptr->left)
+                if (!node_ptr->red())
+                    height++;
+            return height;
+        }
+
+        /**
+         * @brief Hang a detached subtree as the whole content of this tree
+         *
+         */
+        void _adopt_root(node_pointer node_ptr)
+        {
+            _end()->left = node_ptr;
+            if (node_ptr != NULL)
+            {
+                node_ptr->set_parent(_end());
+                node_ptr->set_red(false);
+            }
+        }
+
+        /**
+         * @brief Walk down to val. Returns the node holding it, or _end() with the parent
+         * and side where it belongs
+         *
+         */
+        node_pointer _descend(const value_type &val, node_pointer &parent, bool &left, size_type &comparisons) const
+        {
+            parent = _end();
+            left = true;
+            comparisons = 0;
+            size_type visits = 0;
+            node_pointer tmp = root();
+            while (tmp != NULL)
+            {
+                parent = tmp;
+                visits++;
+                comparisons++;
+                if (_comp(val, tmp->key()))
+                {
+                    left = true;
+                    tmp = tmp->left;
+                    continue;
+                }
+                comparisons++;
+                if (_comp(tmp->key(), val))
+                {
+                    left = false;
+                    tmp = tmp->right;
+                }
+                else
+                    break;
+            }
+            Stats::add_node_visits(visits);
+            return tmp != NULL ? tmp : _end();
+        }
+
+        /**
+         * @brief Walk down to key, counting the comparisons made. Returns the node
+         * holding it or _end()
+         *
+         */
+        template <class K>
+        node_pointer _search(const K &key, size_type &comparisons) const
+        {
+            comparisons = 0;
+            size_type visits = 0;
+            node_pointer tmp = root();
+            while (tmp != NULL)
+            {
+                visits++;
+                comparisons++;
+                if (_comp(key, tmp->key()))
+                {
+                    tmp = tmp->left;
+                    continue;
+                }
+                comparisons++;
+                if (_comp(tmp->key(), key))
+                    tmp = tmp->right;
+                else
+                    break;
+            }
+            Stats::add_node_visits(visits);
+            return tmp != NULL ? tmp : _end();
+        }
+
+        /**
+         * @brief Check the subtree node_ptr, whose values must all go after low and
+         * before high when these are not NULL, and give its black height
+         *
+         */
+        const char *_validate(node_pointer node_ptr, node_pointer low, node_pointer high, size_type depth,
+                              size_type &black_height) const
+        {
+            black_height = 0;
+            if (node_ptr == NULL)
+                return NULL;
+            if (depth > visit_stack_depth)
+                return "deeper than a red-black tree can be";
+            if ((low != NULL && !_comp(low->key(), node_ptr->key())) ||
+                (high != NULL && !_comp(node_ptr->key(), high->key())))
+                return "values out of order";
+            if ((node_ptr->left != NULL && node_ptr->left->parent() != node_ptr) ||
+                (node_ptr->right != NULL && node_ptr->right->parent() != node_ptr))
+                return "child with a wrong parent link";
+            if (node_ptr->red() && (_is_red(node_ptr->left) || _is_red(node_ptr->right)))
+                return "red node with a red child";
+            if (node_ptr->size != 1 + _subtree_size(node_ptr->left) + _subtree_size(node_ptr->right))
+                return "wrong subtree size";
+            size_type left_height;
+            size_type right_height;
+            const char *problem = _validate(node_ptr->left, low, node_ptr, depth + 1, left_height);
+            if (problem == NULL)
+                problem = _validate(node_ptr->right, node_ptr, high, depth + 1, right_height);
+            if (problem != NULL)
+                return problem;
+            if (left_height != right_height)
+                return "unequal black heights";
+            black_height = left_height + (node_ptr->red() ? 0 : 1);
+            return NULL;
+        }
+
+        void _count_insert(size_type comparisons)
+        {
+            if (_counters == NULL)
+                return;
+            _counters->inserts++;
+            _counters->insert_comparisons += comparisons;
+        }
+
+        /**
+         * @brief Hang a free node as a red leaf on the side of parent found by
+         * _descend(), then restore the red-black rules
+         *
+         */
+        iterator _link(node_pointer node_ptr, node_pointer parent, bool left)
+        {
+            node_ptr->left = NULL;
+            node_ptr->right = NULL;
+            node_ptr->set_parent(parent);
+            node_ptr->size = 1;
+            node_ptr->set_red(true);
+            if (left)
+                parent->left = node_ptr;
+            else
+                parent->right = node_ptr;
+            for (node_pointer tmp = parent; tmp != _end(); tmp = tmp->parent())
+                tmp->size++;
+            _insert_fixup(node_ptr);
+            return iterator(node_ptr, _end());
+        }
+
+        /**
+         * @brief Next node in order, _end() after the highest
+         *
+         */
+        node_pointer _successor(node_pointer node_ptr) const
+        {
+            if (node_ptr->right != NULL)
+                return lowest(node_ptr->right);
+            node_pointer parent = node_ptr->parent();
+            while (parent != _end() && node_ptr == parent->right)
+            {
+                node_ptr = parent;
+                parent = parent->parent();
+            }
+            return parent;
+        }
+
+        /**
+         * @brief Put replacement, which may be NULL, where node_ptr hangs from its parent
+         *
+         */
+        void _transplant(node_pointer node_ptr, node_pointer replacement)
+        {
+            if (node_ptr->parent()->left == node_ptr)
+                node_ptr->parent()->left = replacement;
+            else
+                node_ptr->parent()->right = replacement;
+            if (replacement != NULL)
+                replacement->set_parent(node_ptr->parent());
+        }
+
+        void _rotate_left(node_pointer node_ptr)
+        {
+            if (_counters != NULL)
+                _counters->rotations++;
+            node_pointer child = node_ptr->right;
+            node_ptr->right = child->left;
+            if (child->left != NULL)
+                child->left->set_parent(node_ptr);
+            _transplant(node_ptr, child);
+            child->left = node_ptr;
+            node_ptr->set_parent(child);
+            child->size = node_ptr->size;
+            _update_size(node_ptr);
+        }
+
+        void _rotate_right(node_pointer node_ptr)
+        {
+            if (_counters != NULL)
+                _counters->rotations++;
+            node_pointer child = node_ptr->left;
+            node_ptr->left = child->right;
+            if (child->right != NULL)
+                child->right->set_parent(node_ptr);
+            _transplant(node_ptr, child);
+            child->right = node_ptr;
+            node_ptr->set_parent(child);
+            child->size = node_ptr->size;
+            _update_size(node_ptr);
+        }
+
+        /**
+         * @brief Fix a red node_ptr under a red parent, recoloring up the tree and
+         * rotating at most twice. Returns true when the root had to be turned black,
+         * which adds one to the black height of the tree
+         *
+         */
+        bool _insert_fixup(node_pointer node_ptr)
+        {
+            while (node_ptr->parent() != _end() && node_ptr->parent()->red())
+            {
+                node_pointer parent = node_ptr->parent();
+                node_pointer grandparent = parent->parent();
+                if (parent == grandparent->left)
+                {
+                    node_pointer uncle = grandparent->right;
+                    if (_is_red(uncle))
+                    {
+                        parent->set_red(false);
+                        uncle->set_red(false);
+                        grandparent->set_red(true);
+                        node_ptr = grandparent;
+                        continue;
+                    }
+                    if (node_ptr == parent->right)
+                    {
+                        _rotate_left(parent);
+                        parent = node_ptr;
+                    }
+                    parent->set_red(false);
+                    grandparent->set_red(true);
+                    _rotate_right(grandparent);
+                    break;
+                }
+                else
+                {
+                    node_pointer uncle = grandparent->left;
+                    if (_is_red(uncle))
+                    {
+                        parent->set_red(false);
+                        uncle->set_red(false);
+                        grandparent->set_red(true);
+                        node_ptr = grandparent;
+                        continue;
+                    }
+                    if (node_ptr == parent->left)
+                    {
+                        _rotate_right(parent);
+                        parent = node_ptr;
+                    }
+                    parent->set_red(false);
+                    grandparent->set_red(true);
+                    _rotate_left(grandparent);
+                    break;
+                }
+            }
+            bool grown = root()->red();
+            root()->set_red(false);
+            return grown;
+        }
+
+        /**
+         * @brief Give back the black node removed above node_ptr, which may be NULL and
+         * so is given with its parent
+         *
+         */
+        void _erase_fixup(node_pointer node_ptr, node_pointer parent)
+        {
+            while (node_ptr != root() && !_is_red(node_ptr))
+            {
+                if (node_ptr == parent->left)
+                {
+                    node_pointer sibling = parent->right;
+                    if (sibling->red())
+                    {
+                        sibling->set_red(false);
+                        parent->set_red(true);
+                        _rotate_left(parent);
+                        sibling = parent->right;
+                    }
+                    if (!_is_red(sibling->left) && !_is_red(sibling->right))
+                    {
+                        sibling->set_red(true);
+                        node_ptr = parent;
+                        parent = node_ptr->parent();
+                        continue;
+                    }
+                    if (!_is_red(sibling->right))
+                    {
+                        sibling->left->set_red(false);
+                        sibling->set_red(true);
+                        _rotate_right(sibling);
+                        sibling = parent->right;
+                    }
+                    sibling->set_red(parent->red());
+                    parent->set_red(false);
+                    sibling->right->set_red(false);
+                    _rotate_left(parent);
+                }
+                else
+                {
+                    node_pointer sibling = parent->left;
+                    if (sibling->red())
+                    {
+                        sibling->set_red(false);
+                        parent->set_red(true);
+                        _rotate_right(parent);
+                        sibling = parent->left;
+                    }
+                    if (!_is_red(sibling->left) && !_is_red(sibling->right))
+                    {
+                        sibling->set_red(true);
+                        node_ptr = parent;
+                        parent = node_ptr->parent();
+                        continue;
+                    }
+                    if (!_is_red(sibling->left))
+                    {
+                        sibling->right->set_red(false);
+                        sibling->set_red(true);
+                        _rotate_left(sibling);
+                        sibling = parent->left;
+                    }
+                    sibling->set_red(parent->red());
+                    parent->set_red(false);
+                    sibling->left->set_red(false);
+                    _rotate_right(parent);
+                }
+                node_ptr = root();
+            }
+            if (node_ptr != NULL)
+                node_ptr->set_red(false);
+        }
+
+        /**
+         * @brief Join the detached subtrees low and high, of black heights low_height
+         * and high_height, with middle between them. Every value of low goes before
+         * middle, which goes before every value of high. The shorter tree hangs from the
+         * spine of the taller one where the black heights meet, so the cost is their
+         * difference. Returns the detached root and its black height. Uses _end() as a
+         * scratch header: the tree must be empty
+         *
+         */
+        node_pointer _join(node_pointer low, size_type low_height, node_pointer middle, node_pointer high,
+                           size_type high_height, size_type &height)
+        {
+            if (_is_red(low))
+            {
+                low->set_red(false);
+                low_height++;
+            }
+            if (_is_red(high))
+            {
+                high->set_red(false);
+                high_height++;
+            }
+            if (low_height == high_height)
+            {
+                middle->left = low;
+                middle->right = high;
+                if (low != NULL)
+                    low->set_parent(middle);
+                if (high != NULL)
+                    high->set_parent(middle);
+                middle->set_red(false);
+                _update_size(middle);
+                height = low_height + 1;
+                return middle;
+            }
+            bool high_taller = high_height > low_height;
+            node_pointer tall = high_taller ? high : low;
+            size_type tall_height = high_taller ? high_height : low_height;
+            size_type short_height = high_taller ? low_height : high_height;
+            _end()->left = tall;
+            tall->set_parent(_end());
+            node_pointer parent = _end();
+            node_pointer spine = tall;
+            size_type spine_height = tall_height;
+            while (spine != NULL && (spine->red() || spine_height > short_height))
+            {
+                if (!spine->red())
+                    spine_height--;
+                parent = spine;
+                spine = high_taller ? spine->left : spine->right;
+            }
+            middle->left = high_taller ? low : spine;
+            middle->right = high_taller ? spine : high;
+            if (middle->left != NULL)
+                middle->left->set_parent(middle);
+            if (middle->right != NULL)
+                middle->right->set_parent(middle);
+            middle->set_parent(parent);
+            middle->set_red(true);
+            _update_size(middle);
+            if (high_taller)
+                parent->left = middle;
+            else
+                parent->right = middle;
+            for (node_pointer tmp = parent; tmp != _end(); tmp = tmp->parent())
+                _update_size(tmp);
+            height = tall_height + (_insert_fixup(middle) ? 1 : 0);
+            node_pointer joined = root();
+            _end()->left = NULL;
+            return joined;
+        }
+
+        /**
+         * @brief Split the detached subtree node_ptr, of black height node_height, into
+         * the values before key and the others. Each level of the descent joins the
+         * half it keeps with the result from below
+         *
+         */
+        template <class K>
+        void _split(node_pointer node_ptr, size_type node_height, const K &key, node_pointer &low,
+                    size_type &low_height, node_pointer &high, size_type &high_height)
+        {
+            if (node_ptr == NULL)
+            {
+                low = NULL;
+                high = NULL;
+                low_height = 0;
+                high_height = 0;
+                return;
+            }
+            size_type child_height = node_height - (node_ptr->red() ? 0 : 1);
+            node_pointer left = node_ptr->left;
+            node_pointer right = node_ptr->right;
+            if (_comp(node_ptr->key(), key))
+            {
+                _split(right, child_height, key, low, low_height, high, high_height);
+                low = _join(left, child_height, node_ptr, low, low_height, low_height);
+            }
+            else
+            {
+                _split(left, child_height, key, low, low_height, high, high_height);
+                high = _join(high, high_height, node_ptr, right, child_height, high_height);
+            }
+        }
+
+        /**
+         * @brief Hang the middle value from slot and recurse on both halves. Nodes are
+         * linked as soon as they exist, so a throw leaves a tree clear() can free
+         *
+         */
+        template <class RandomIt>
+        void _build_sorted(RandomIt first, size_type n, node_pointer parent, node_pointer &slot, size_type depth,
+                           size_type red_depth)
+        {
+            if (n == 0)
+                return;
+            size_type mid = n / 2;
+            node_pointer node = _new_node(first[mid]);
+            node->set_parent(parent);
+            node->set_red(depth == red_depth);
+            node->size = n;
+            slot = node;
+            _build_sorted(first, mid, node, node->left, depth + 1, red_depth);
+            _build_sorted(first + mid + 1, n - mid - 1, node, node->right, depth + 1, red_depth);
+        }
+
+        /**
+         * @brief Copy the shape and colors of other into this empty tree, without
+         * recursion
+         *
+         */
+        void _clone(const tree &other)
+        {
+            node_pointer src = other.root();
+            if (src == NULL)
+                return;
+            node_pointer dst = _new_node(src->value());
+            dst->set_parent(_end());
+            dst->set_red(src->red());
+            dst->size = src->size;
+            _end()->left = dst;
+            while (src != other._end())
+            {
+                if (src->left != NULL && dst->left == NULL)
+                {
+                    dst->left = _new_node(src->left->value());
+                    dst->left->set_parent(dst);
+                    src = src->left;
+                    dst = dst->left;
+                }
+                else if (src->right != NULL && dst->right == NULL)
+                {
+                    dst->right = _new_node(src->right->value());
+                    dst->right->set_parent(dst);
+                    src = src->right;
+                    dst = dst->right;
+                }
+                else
+                {
+                    src = src->parent();
+                    dst = dst->parent();
+                    continue;
+                }
+                dst->set_red(src->red());
+                dst->size = src->size;
+            }
+        }
     };
 } // namespace ft
-#endif // ********************************************** TREE_HPP end //
\ No newline at end of file
+#endif // ********************************************** TREE_HPP end //
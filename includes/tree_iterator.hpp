@@ -5,8 +5,17 @@
 
 namespace ft
 {
-    template <typename T, class Compare>
-    class tree_iterator : public ft::iterator<ft::bidirectional_iterator_tag, T>
+    /**
+     * @brief Bidirectional iterator over the nodes of an ft::tree.
+     *
+     * Missing children are NULL. The tree's end sentinel is the root's parent and has
+     * the root as left child, so climbing past the root reaches end() and decrementing
+     * end() lands on the highest node.
+     *
+     * @tparam T Node type of the tree.
+     */
+    template <typename T>
+    class tree_iterator : public ft::iterator<ft::bidirectional_iterator_tag, typename T::value_type>
     {
     public:
         typedef typename T::value_type value_type;
@@ -16,22 +25,20 @@ namespace ft
         typedef typename ft::iterator<ft::bidirectional_iterator_tag, value_type>::iterator_category iterator_category;
 
         T *_node;
-        T *_root;
-        Compare _compare;
+        T *_end;
 
-        tree_iterator() : _node(NULL), _root(NULL), _compare() {}
+        tree_iterator() : _node(NULL), _end(NULL) {}
 
-        tree_iterator(T *node, T *root, Compare compare) : _node(node), _root(root), _compare(compare) {}
+        tree_iterator(T *node, T *end) : _node(node), _end(end) {}
 
-        tree_iterator(const tree_iterator &other) : _node(other._node), _root(other._root), _compare(other._compare) {}
+        tree_iterator(const tree_iterator &other) : _node(other._node), _end(other._end) {}
 
         tree_iterator &operator=(const tree_iterator &other)
         {
             if (this != &other)
             {
                 _node = other._node;
-                _root = other._root;
-                _compare = other._compare;
+                _end = other._end;
             }
             return *this;
         }
@@ -40,39 +47,39 @@ namespace ft
 
         bool operator==(const tree_iterator &other) const
         {
-            return (_node == other._node && _root == other._root && _compare == other._compare);
+            return (_node == other._node);
         }
 
         bool operator!=(const tree_iterator &other) const
         {
-            return (_node != other._node || _root != other._root || _compare != other._compare);
+            return (_node != other._node);
         }
 
         reference operator*() const
         {
-            return _node->value;
+            return _node->value();
         }
 
         pointer operator->() const
         {
-            return &(_node->value);
+            return &(_node->value());
         }
 
         tree_iterator &operator++()
         {
-            if (_node->right)
+            if (_node->right != NULL)
             {
                 _node = _node->right;
-                while (_node->left)
+                while (_node->left != NULL)
                     _node = _node->left;
             }
             else
             {
-                T *parent = _node->parent;
-                while (parent && _node == parent->right)
+                T *parent = _node->parent();
+                while (parent != _end && _node == parent->right)
                 {
                     _node = parent;
-                    parent = parent->parent;
+                    parent = parent->parent();
                 }
                 _node = parent;
             }
@@ -88,25 +95,25 @@ namespace ft
 
         tree_iterator &operator--()
         {
-            if (_node == NULL)
+            if (_node == _end)
             {
-                _node = _root;
-                while (_node->right)
+                _node = _end->left;
+                while (_node->right != NULL)
                     _node = _node->right;
             }
-            else if (_node->left)
+            else if (_node->left != NULL)
             {
                 _node = _node->left;
-                while (_node->right)
+                while (_node->right != NULL)
                     _node = _node->right;
             }
             else
             {
-                T *parent = _node->parent;
-                while (parent && _node == parent->left)
+                T *parent = _node->parent();
+                while (parent != _end && _node == parent->left)
                 {
                     _node = parent;
-                    parent = parent->parent;
+                    parent = parent->parent();
                 }
                 _node = parent;
             }
@@ -121,35 +128,33 @@ namespace ft
         }
     };
 
-    template <typename T, class Compare>
-    class tree_const_iterator : public ft::iterator<ft::bidirectional_iterator_tag, T>
+    template <typename T>
+    class tree_const_iterator : public ft::iterator<ft::bidirectional_iterator_tag, typename T::value_type, ptrdiff_t, const typename T::value_type *, const typename T::value_type &>
     {
     public:
         typedef typename T::value_type value_type;
-        typedef typename ft::iterator<ft::bidirectional_iterator_tag, value_type>::pointer pointer;
-        typedef typename ft::iterator<ft::bidirectional_iterator_tag, value_type>::reference reference;
+        typedef const value_type *pointer;
+        typedef const value_type &reference;
         typedef typename ft::iterator<ft::bidirectional_iterator_tag, value_type>::difference_type difference_type;
         typedef typename ft::iterator<ft::bidirectional_iterator_tag, value_type>::iterator_category iterator_category;
 
         T *_node;
-        T *_root;
-        Compare _compare;
+        T *_end;
 
-        tree_const_iterator() : _node(NULL), _root(NULL), _compare() {}
+        tree_const_iterator() : _node(NULL), _end(NULL) {}
 
-        tree_const_iterator(T *node, T *root, Compare compare) : _node(node), _root(root), _compare(compare) {}
+        tree_const_iterator(T *node, T *end) : _node(node), _end(end) {}
 
-        tree_const_iterator(const tree_const_iterator &other) : _node(other._node), _root(other._root), _compare(other._compare) {}
+        tree_const_iterator(const tree_const_iterator &other) : _node(other._node), _end(other._end) {}
 
-        tree_const_iterator(const tree_iterator<T, Compare> &other) : _node(other._node), _root(other._root), _compare(other._compare) {}
+        tree_const_iterator(const tree_iterator<T> &other) : _node(other._node), _end(other._end) {}
 
         tree_const_iterator &operator=(const tree_const_iterator &other)
         {
             if (this != &other)
             {
                 _node = other._node;
-                _root = other._root;
-                _compare = other._compare;
+                _end = other._end;
             }
             return *this;
         }
@@ -158,39 +163,39 @@ namespace ft
 
         bool operator==(const tree_const_iterator &other) const
         {
-            return (_node == other._node && _root == other._root && _compare == other._compare);
+            return (_node == other._node);
         }
 
         bool operator!=(const tree_const_iterator &other) const
         {
-            return (_node != other._node || _root != other._root || _compare != other._compare);
+            return (_node != other._node);
         }
 
         reference operator*() const
         {
-            return _node->value;
+            return _node->value();
         }
 
         pointer operator->() const
         {
-            return &(_node->value);
+            return &(_node->value());
         }
 
         tree_const_iterator &operator++()
         {
-            if (_node->right)
+            if (_node->right != NULL)
             {
                 _node = _node->right;
-                while (_node->left)
+                while (_node->left != NULL)
                     _node = _node->left;
             }
             else
             {
-                T *parent = _node->parent;
-                while (parent && _node == parent->right)
+                T *parent = _node->parent();
+                while (parent != _end && _node == parent->right)
                 {
                     _node = parent;
-                    parent = parent->parent;
+                    parent = parent->parent();
                 }
                 _node = parent;
             }
@@ -206,25 +211,25 @@ namespace ft
 
         tree_const_iterator &operator--()
         {
-            if (_node == NULL)
+            if (_node == _end)
             {
-                _node = _root;
-                while (_node->right)
+                _node = _end->left;
+                while (_node->right != NULL)
                     _node = _node->right;
             }
-            else if (_node->left)
+            else if (_node->left != NULL)
             {
                 _node = _node->left;
-                while (_node->right)
+                while (_node->right != NULL)
                     _node = _node->right;
             }
             else
             {
-                T *parent = _node->parent;
-                while (parent && _node == parent->left)
+                T *parent = _node->parent();
+                while (parent != _end && _node == parent->left)
                 {
                     _node = parent;
-                    parent = parent->parent;
+                    parent = parent->parent();
                 }
                 _node = parent;
             }
@@ -238,5 +243,17 @@ namespace ft
             return tmp;
         }
     };
+
+    template <typename T>
+    bool operator==(const tree_iterator<T> &lhs, const tree_const_iterator<T> &rhs)
+    {
+        return (lhs._node == rhs._node);
+    }
+
+    template <typename T>
+    bool operator!=(const tree_iterator<T> &lhs, const tree_const_iterator<T> &rhs)
+    {
+        return (lhs._node != rhs._node);
+    }
 } // namespace ft
-#endif // ********************************************** TREE_ITERATOR_HPP end //
\ No newline at end of file
+#endif // ********************************************** TREE_ITERATOR_HPP end //
@@ -1,47 +1,316 @@
 #ifndef TREE_NODE_HPP
 #define TREE_NODE_HPP
 
+#include <cstddef>
+#include <memory>
+
+/*
+ * Node layouts of ft::tree. Every node type has public left, right and size members,
+ * and reaches the rest through accessors, so that the tree does not depend on where
+ * the parent pointer, the color and the value are stored:
+ *
+ *   value()                    the element
+ *   key()                      what the tree compares, without touching the mapped part
+ *                              when the layout keeps it elsewhere
+ *   parent(), set_parent(p)
+ *   red(), set_red(r)
+ *
+ * The links live in a base_type holding no value, which is all the tree's sentinel
+ * is: the tree embeds one without building a value_type, and never reads a value
+ * through it. The tree builds and frees elements through two static hooks, which
+ * receive its allocator of value_type so that a layout keeping the element apart
+ * allocates it there:
+ *
+ *   construct(node, val, alloc)   builds a red leaf holding val in raw memory
+ *   destroy(node, alloc)          destroys the node and frees what construct() allocated
+ *
+ * allocations is the number of allocator calls construct() stands for, the node
+ * itself included.
+ */
+
+namespace ft
+{
+    /**
+     * @brief Links of a TREE_Node, without the value: left, right and size, then the
+     * parent pointer and the color.
+     *
+     * @tparam Node the node type deriving from it
+     */
+    template <typename Node>
+    struct tree_node_base
+    {
+    public:
+        Node *left;
+        Node *right;
+        size_t size;
+
+        tree_node_base() : left(NULL), right(NULL), size(0), _parent(NULL), _red(false) {}
+
+        tree_node_base(size_t size, bool red) : left(NULL), right(NULL), size(size), _parent(NULL), _red(red) {}
+
+        Node *parent() const { return _parent; }
+        void set_parent(Node *parent) { _parent = parent; }
+
+        bool red() const { return _red; }
+        void set_red(bool red) { _red = red; }
+
+    private:
+        Node *_parent;
+        bool _red;
+    };
+
+    /**
+     * @brief Links with the color in the low bit of the parent pointer, always clear
+     * in a real address since nodes hold pointers.
+     *
+     * @tparam Node the node type deriving from it
+     */
+    template <typename Node>
+    struct packed_tree_node_base
+    {
+    public:
+        Node *left;
+        Node *right;
+        size_t size;
+
+        packed_tree_node_base() : left(NULL), right(NULL), size(0), _parent_red(0) {}
+
+        packed_tree_node_base(size_t size, bool red) : left(NULL), right(NULL), size(size), _parent_red(red) {}
+
+        Node *parent() const
+        {
+            return reinterpret_cast<Node *>(_parent_red & ~static_cast<size_t>(1));
+        }
+
+        void set_parent(Node *parent)
+        {
+            _parent_red = reinterpret_cast<size_t>(parent) | (_parent_red & 1);
+        }
+
+        bool red() const { return _parent_red & 1; }
+        void set_red(bool red) { _parent_red = (_parent_red & ~static_cast<size_t>(1)) | red; }
+
+    private:
+        size_t _parent_red;
+    };
+} // namespace ft
+
 /**
- * @brief Struct for node of tree
+ * @brief Struct for node of tree. New nodes are red leaves; size counts the nodes of
+ * the subtree rooted here, this one included
  *
  * @tparam T
  */
 template <typename T>
-struct TREE_Node
+struct TREE_Node : public ft::tree_node_base<TREE_Node<T> >
 {
 public:
     typedef T value_type;
-    value_type value;
-    TREE_Node *left;
-    TREE_Node *right;
-    TREE_Node *parent;
-
-    TREE_Node() : value(), left(NULL), right(NULL), parent(NULL) {}
+    typedef T key_view;
+    typedef ft::tree_node_base<TREE_Node> base_type;
 
-    TREE_Node(const value_type &val) : value(val), left(NULL), right(NULL), parent(NULL) {}
+    TREE_Node(const value_type &val) : base_type(1, true), _value(val) {}
 
-    TREE_Node(const value_type &val, TREE_Node *left, TREE_Node *right, TREE_Node *parent) : value(val), left(left), right(right), parent(parent) {}
-
-    TREE_Node(const TREE_Node &other) : value(other.value), left(other.left), right(other.right), parent(other.parent) {}
+    TREE_Node(const TREE_Node &other) : base_type(other), _value(other._value) {}
 
     TREE_Node &operator=(const TREE_Node &other)
     {
         if (this != &other)
         {
-            value = other.value;
-            left = other.left;
-            right = other.right;
-            parent = other.parent;
+            base_type::operator=(other);
+            _value = other._value;
         }
         return *this;
     }
 
     ~TREE_Node() {}
 
+    value_type &value() { return _value; }
+    const value_type &value() const { return _value; }
+    const key_view &key() const { return _value; }
+
+    static const size_t allocations = 1;
+
+    template <class Alloc>
+    static void construct(TREE_Node *node, const value_type &val, Alloc &)
+    {
+        ::new (static_cast<void *>(node)) TREE_Node(val);
+    }
+
+    template <class Alloc>
+    static void destroy(TREE_Node *node, Alloc &)
+    {
+        node->~TREE_Node();
+    }
+
     bool operator==(const TREE_Node &other) const
     {
-        return (value == other.value && left == other.left && right == other.right && parent == other.parent);
+        return (_value == other._value && this->left == other.left && this->right == other.right &&
+                this->parent() == other.parent());
     }
+
+private:
+    value_type _value;
 };
 
-#endif // ********************************************** TREE_NODE_HPP end //
\ No newline at end of file
+namespace ft
+{
+    /**
+     * @brief TREE_Node without its color byte: the links are a packed_tree_node_base.
+     * Saves the padding after the bool, 8 bytes on 64-bit targets.
+     *
+     * @tparam T
+     */
+    template <typename T>
+    struct packed_tree_node : public packed_tree_node_base<packed_tree_node<T> >
+    {
+    public:
+        typedef T value_type;
+        typedef T key_view;
+        typedef packed_tree_node_base<packed_tree_node> base_type;
+
+        packed_tree_node(const value_type &val) : base_type(1, true), _value(val) {}
+
+        packed_tree_node(const packed_tree_node &other) : base_type(other), _value(other._value) {}
+
+        value_type &value() { return _value; }
+        const value_type &value() const { return _value; }
+        const key_view &key() const { return _value; }
+
+        static const size_t allocations = 1;
+
+        template <class Alloc>
+        static void construct(packed_tree_node *node, const value_type &val, Alloc &)
+        {
+            ::new (static_cast<void *>(node)) packed_tree_node(val);
+        }
+
+        template <class Alloc>
+        static void destroy(packed_tree_node *node, Alloc &)
+        {
+            node->~packed_tree_node();
+        }
+
+    private:
+        value_type _value;
+
+        packed_tree_node &operator=(const packed_tree_node &);
+    };
+
+    /**
+     * @brief Node holding only the key and the links, with the color packed in the
+     * parent pointer; the element itself is allocated apart, with the allocator the
+     * tree hands to construct() and destroy(). A lookup compares keys in nodes of a
+     * few words whatever the size of the mapped type, and reaches the element only
+     * once found. Needs a pair value_type, and a comparator that accepts any type
+     * with a first member, like map::value_compare.
+     *
+     * @tparam T ft::pair<const Key, Mapped>
+     */
+    template <typename T>
+    struct split_tree_node : public packed_tree_node_base<split_tree_node<T> >
+    {
+    public:
+        typedef T value_type;
+        typedef packed_tree_node_base<split_tree_node> base_type;
+
+        /**
+         * @brief The part of the element the tree compares, kept in the node.
+         */
+        struct key_view
+        {
+            typename T::first_type first;
+
+            key_view(const typename T::first_type &k) : first(k) {}
+        };
+
+        explicit split_tree_node(value_type *val) : base_type(1, true), _key(val->first), _value(val) {}
+
+        value_type &value() { return *_value; }
+        const value_type &value() const { return *_value; }
+        const key_view &key() const { return _key; }
+
+        static const size_t allocations = 2;
+
+        template <class Alloc>
+        static void construct(split_tree_node *node, const value_type &val, Alloc &alloc)
+        {
+            value_type *p = alloc.allocate(1);
+            try
+            {
+                alloc.construct(p, val);
+                try
+                {
+                    ::new (static_cast<void *>(node)) split_tree_node(p);
+                }
+                catch (...)
+                {
+                    alloc.destroy(p);
+                    throw;
+                }
+            }
+            catch (...)
+            {
+                alloc.deallocate(p, 1);
+                throw;
+            }
+        }
+
+        template <class Alloc>
+        static void destroy(split_tree_node *node, Alloc &alloc)
+        {
+            value_type *value = node->_value;
+            node->~split_tree_node();
+            alloc.destroy(value);
+            alloc.deallocate(value, 1);
+        }
+
+    private:
+        key_view _key;
+        value_type *_value;
+
+        split_tree_node(const split_tree_node &);
+        split_tree_node &operator=(const split_tree_node &);
+    };
+
+    // LAYOUTS =====================================================================
+
+    /**
+     * @brief Element stored in the node, next to the links: TREE_Node. The default.
+     */
+    struct inline_node_layout
+    {
+        template <class T, class Alloc>
+        struct node
+        {
+            typedef TREE_Node<T> type;
+        };
+    };
+
+    /**
+     * @brief Element stored in the node, color packed in the parent pointer.
+     */
+    struct packed_node_layout
+    {
+        template <class T, class Alloc>
+        struct node
+        {
+            typedef packed_tree_node<T> type;
+        };
+    };
+
+    /**
+     * @brief Key and links in the node, element allocated apart. Pays an allocation
+     * and a pointer per element to keep the nodes small when the mapped type is large.
+     */
+    struct split_node_layout
+    {
+        template <class T, class Alloc>
+        struct node
+        {
+            typedef split_tree_node<T> type;
+        };
+    };
+} // namespace ft
+
+#endif // ********************************************** TREE_NODE_HPP end //
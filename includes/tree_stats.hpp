@@ -0,0 +1,90 @@
+#ifndef TREE_STATS_HPP
+#define TREE_STATS_HPP
+
+#include <cstddef>
+#include "vector.hpp"
+
+namespace ft
+{
+    /**
+     * @brief Shape of an ft::tree at one time, from tree::shape(). The root has depth 0;
+     * height counts the nodes on the longest path, 0 for an empty tree.
+     *
+     */
+    struct tree_shape
+    {
+        size_t size;
+        size_t height;
+        size_t black_height;
+        size_t max_depth;
+        size_t depth_sum;
+
+        /**
+         * @brief Number of nodes at each depth, indexed by depth.
+         */
+        ft::vector<size_t> depth_histogram;
+
+        tree_shape() : size(0), height(0), black_height(0), max_depth(0), depth_sum(0) {}
+
+        /**
+         * @brief Mean depth of a node: a successful find compares against this many
+         * nodes plus one.
+         *
+         */
+        double average_depth() const
+        {
+            return size == 0 ? 0.0 : static_cast<double>(depth_sum) / size;
+        }
+    };
+
+    /**
+     * @brief Costs an ft::tree adds up while attached with tree::set_counters(). Without
+     * counters, each point that would count only tests a null pointer.
+     *
+     * Comparisons are calls to the comparator made to locate a key. Finds are
+     * tree::search() calls, behind map::find and map::count; inserts include node
+     * insertion and each node merge() tries; erases are erases by key. Allocations and
+     * deallocations count allocator calls: one per node, two with split_node_layout,
+     * which allocates the element apart.
+     *
+     */
+    struct tree_counters
+    {
+        size_t finds;
+        size_t find_comparisons;
+        size_t inserts;
+        size_t insert_comparisons;
+        size_t erases;
+        size_t erase_comparisons;
+        size_t rotations;
+        size_t allocations;
+        size_t deallocations;
+
+        tree_counters() { reset(); }
+
+        void reset()
+        {
+            finds = 0;
+            find_comparisons = 0;
+            inserts = 0;
+            insert_comparisons = 0;
+            erases = 0;
+            erase_comparisons = 0;
+            rotations = 0;
+            allocations = 0;
+            deallocations = 0;
+        }
+
+        double comparisons_per_find() const { return _ratio(find_comparisons, finds); }
+        double comparisons_per_insert() const { return _ratio(insert_comparisons, inserts); }
+        double comparisons_per_erase() const { return _ratio(erase_comparisons, erases); }
+
+    private:
+        static double _ratio(size_t total, size_t count)
+        {
+            return count == 0 ? 0.0 : static_cast<double>(total) / count;
+        }
+    };
+} // namespace ft
+
+#endif // ********************************************** TREE_STATS_HPP end //
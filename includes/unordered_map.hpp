@@ -0,0 +1,399 @@
+#ifndef UNORDERED_MAP_HPP
+#define UNORDERED_MAP_HPP
+
+// LIBS ========================================================================
+#include <memory>
+#include <functional>
+#include <cstddef>
+#include "./pair.hpp"
+#include "./hash.hpp"
+#include "./iterator_traits.hpp"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace ft
+{
+    // CONTROL BYTES ===============================================================
+    /*
+     * Every slot of the table has one control byte. A full slot stores the low 7 bits
+     * of its hash (0..127), so a probe can reject almost every non-matching slot
+     * without touching the slot itself. Empty and deleted slots have the high bit set.
+     */
+    typedef signed char ctrl_t;
+
+    static const ctrl_t ctrl_empty = -128;
+    static const ctrl_t ctrl_deleted = -2;
+
+    /**
+     * @brief 16 consecutive control bytes, compared in one instruction with SSE2.
+     * Each match returns a bitmask where bit i stands for the i-th byte of the group.
+     */
+    struct ctrl_group
+    {
+        static const size_t width = 16;
+
+#if defined(__SSE2__)
+        __m128i ctrl;
+
+        explicit ctrl_group(const ctrl_t *pos) : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {}
+
+        unsigned int match(ctrl_t h2) const
+        {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl));
+        }
+
+        unsigned int match_empty() const
+        {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(ctrl_empty), ctrl));
+        }
+
+        unsigned int match_empty_or_deleted() const
+        {
+            return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl));
+        }
+#else
+        const ctrl_t *ctrl;
+
+        explicit ctrl_group(const ctrl_t *pos) : ctrl(pos) {}
+
+        unsigned int match(ctrl_t h2) const
+        {
+            unsigned int mask = 0;
+            for (size_t i = 0; i < width; i++)
+                mask |= (unsigned int)(ctrl[i] == h2) << i;
+            return mask;
+        }
+
+        unsigned int match_empty() const
+        {
+            return match(ctrl_empty);
+        }
+
+        unsigned int match_empty_or_deleted() const
+        {
+            unsigned int mask = 0;
+            for (size_t i = 0; i < width; i++)
+                mask |= (unsigned int)(ctrl[i] < -1) << i;
+            return mask;
+        }
+#endif
+    };
+
+    // ITERATORS ===================================================================
+
+    /**
+     * @brief Forward iterator over the full slots of an ft::unordered_map.
+     *
+     * @tparam Value value_type of the table.
+     * @tparam Ref reference type exposed (const or not).
+     * @tparam Ptr pointer type exposed (const or not).
+     */
+    template <typename Value, typename Ref, typename Ptr>
+    class hash_iterator : public ft::iterator<ft::forward_iterator_tag, Value, ptrdiff_t, Ptr, Ref>
+    {
+    public:
+        typedef Value value_type;
+        typedef Ref reference;
+        typedef Ptr pointer;
+        typedef ptrdiff_t difference_type;
+        typedef ft::forward_iterator_tag iterator_category;
+
+        const ctrl_t *_ctrl;
+        const ctrl_t *_ctrl_end;
+        Value *_slot;
+
+        hash_iterator() : _ctrl(NULL), _ctrl_end(NULL), _slot(NULL) {}
+
+        hash_iterator(const ctrl_t *ctrl, const ctrl_t *ctrl_end, Value *slot) : _ctrl(ctrl), _ctrl_end(ctrl_end), _slot(slot)
+        {
+            _skip_free();
+        }
+
+        hash_iterator(const hash_iterator<Value, Value &, Value *> &other) : _ctrl(other._ctrl), _ctrl_end(other._ctrl_end), _slot(other._slot) {}
+
+        reference operator*() const { return *_slot; }
+
+        pointer operator->() const { return _slot; }
+
+        hash_iterator &operator++()
+        {
+            ++_ctrl;
+            ++_slot;
+            _skip_free();
+            return *this;
+        }
+
+        hash_iterator operator++(int)
+        {
+            hash_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        template <typename R, typename P>
+        bool operator==(const hash_iterator<Value, R, P> &other) const { return _ctrl == other._ctrl; }
+
+        template <typename R, typename P>
+        bool operator!=(const hash_iterator<Value, R, P> &other) const { return _ctrl != other._ctrl; }
+
+    private:
+        void _skip_free()
+        {
+            while (_ctrl != _ctrl_end && *_ctrl < 0)
+            {
+                ++_ctrl;
+                ++_slot;
+            }
+        }
+    };
+
+    // CLASS =======================================================================
+
+    /**
+     * @brief Hash table with open addressing in the style of Swiss tables.
+     *
+     * Elements are stored flat in an array of slots, next to an array of control bytes.
+     * A lookup hashes the key once: the high bits pick the first group of 16 slots to
+     * probe, the low 7 bits are compared against the 16 control bytes of the group at
+     * once, and only slots whose control byte matches have their key compared. Groups
+     * are visited with a triangular sequence, which reaches every group of the table,
+     * and the probe stops at the first group holding an empty slot.
+     *
+     * An erased slot becomes a tombstone when a probe may have walked past it, so that
+     * probe sequences stay intact; tombstones are reclaimed by the next insert landing
+     * there or by the next rehash. Inserting may invalidate every iterator.
+     *
+     * @tparam Key Key type.
+     * @tparam T Mapped type.
+     * @tparam Hash Function object hashing a Key to a size_t.
+     * @tparam Pred Function object comparing two keys for equality.
+     * @tparam Alloc Allocator for the slots.
+     */
+    template <class Key, class T, class Hash = ft::hash<Key>, class Pred = std::equal_to<Key>,
+              class Alloc = std::allocator<ft::pair<const Key, T> > >
+    class unordered_map
+    {
+    public:
+        // MEMBER TYPES ========================================================
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef ft::pair<const key_type, mapped_type> value_type;
+        typedef Hash hasher;
+        typedef Pred key_equal;
+        typedef Alloc allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef typename allocator_type::size_type size_type;
+        typedef typename allocator_type::difference_type difference_type;
+
+        // ITERATORS ===========================================================
+        typedef ft::hash_iterator<value_type, value_type &, value_type *> iterator;
+        typedef ft::hash_iterator<value_type, const value_type &, const value_type *> const_iterator;
+
+    private:
+        typedef typename allocator_type::template rebind<ctrl_t>::other ctrl_allocator_type;
+
+        // ATTRIBUTES ==========================================================
+        ctrl_t *_ctrl;
+        pointer _slots;
+        size_type _capacity;
+        size_type _size;
+        size_type _deleted;
+        size_type _growth_left;
+        float _max_load_factor;
+        hasher _hash;
+        key_equal _eq;
+        allocator_type _alloc;
+        ctrl_allocator_type _ctrl_alloc;
+
+    public:
+        // CONSTRUCTORS ========================================================
+
+        /**
+         * @brief Constructs an empty table with room for at least n elements
+         * before the first rehash.
+         *
+         */
+        explicit unordered_map(size_type n = 0, const hasher &hf = hasher(), const key_equal &eql = key_equal(),
+                               const allocator_type &alloc = allocator_type());
+
+        /**
+         * @brief Constructs a table holding the elements of [first, last).
+         *
+         */
+        template <class InputIterator>
+        unordered_map(InputIterator first, InputIterator last, size_type n = 0, const hasher &hf = hasher(),
+                      const key_equal &eql = key_equal(), const allocator_type &alloc = allocator_type());
+
+        /**
+         * @brief Constructs a copy of x.
+         *
+         */
+        unordered_map(const unordered_map &x);
+
+        /**
+         * @brief Destroys every element and releases the table.
+         *
+         */
+        ~unordered_map();
+
+        /**
+         * @brief Replaces the content with a copy of x.
+         *
+         */
+        unordered_map &operator=(const unordered_map &x);
+
+        // ITERATORS ===========================================================
+
+        iterator begin();
+        const_iterator begin() const;
+        iterator end();
+        const_iterator end() const;
+
+        // CAPACITY ============================================================
+
+        bool empty() const;
+        size_type size() const;
+        size_type max_size() const;
+
+        // ELEMENT ACCESS ======================================================
+
+        /**
+         * @brief Returns the value mapped to k, inserting a value-initialized one if k is missing.
+         *
+         */
+        mapped_type &operator[](const key_type &k);
+
+        /**
+         * @brief Returns the value mapped to k, throws std::out_of_range if k is missing.
+         *
+         */
+        mapped_type &at(const key_type &k);
+        const mapped_type &at(const key_type &k) const;
+
+        // MODIFIERS ===========================================================
+
+        /**
+         * @brief Inserts val if its key is not present yet.
+         *
+         * @return The element with val's key, and whether val was inserted.
+         */
+        ft::pair<iterator, bool> insert(const value_type &val);
+
+        /**
+         * @brief Inserts every element of [first, last) whose key is not present yet.
+         *
+         */
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last);
+
+        /**
+         * @brief Removes the element at position.
+         *
+         */
+        void erase(iterator position);
+
+        /**
+         * @brief Removes the element with key k.
+         *
+         * @return The number of elements removed (0 or 1).
+         */
+        size_type erase(const key_type &k);
+
+        /**
+         * @brief Removes every element, keeping the allocated table.
+         *
+         */
+        void clear();
+
+        /**
+         * @brief Exchanges the content with x without copying elements.
+         *
+         */
+        void swap(unordered_map &x);
+
+        // LOOKUP ==============================================================
+
+        iterator find(const key_type &k);
+        const_iterator find(const key_type &k) const;
+        size_type count(const key_type &k) const;
+        ft::pair<iterator, iterator> equal_range(const key_type &k);
+        ft::pair<const_iterator, const_iterator> equal_range(const key_type &k) const;
+
+        // HASH POLICY =========================================================
+
+        /**
+         * @brief Number of slots of the table (a power of two, or 0 before the first insert).
+         *
+         */
+        size_type bucket_count() const;
+
+        /**
+         * @brief size() / bucket_count().
+         *
+         */
+        float load_factor() const;
+
+        /**
+         * @brief Load factor above which the table grows.
+         *
+         */
+        float max_load_factor() const;
+
+        /**
+         * @brief Sets the load factor above which the table grows. Clamped to [0.25, 0.9375]
+         * so that every probe sequence keeps meeting an empty slot. Rehashes if the
+         * current size no longer fits.
+         *
+         */
+        void max_load_factor(float ml);
+
+        /**
+         * @brief Rebuilds the table with at least n slots, and at least enough slots to hold
+         * size() elements under max_load_factor(). Drops every tombstone.
+         *
+         */
+        void rehash(size_type n);
+
+        /**
+         * @brief Makes room for n elements without a further rehash.
+         *
+         */
+        void reserve(size_type n);
+
+        // OBSERVERS ===========================================================
+
+        hasher hash_function() const;
+        key_equal key_eq() const;
+        allocator_type get_allocator() const;
+
+    private:
+        size_type _find_index(const key_type &k, size_t hash) const;
+        size_type _find_free(size_t hash) const;
+        size_type _max_elements(size_type capacity) const;
+        void _set_ctrl(size_type i, ctrl_t h);
+        void _allocate(size_type capacity);
+        void _deallocate();
+        void _resize(size_type capacity);
+        size_type _capacity_for(size_type n) const;
+        void _destroy_elements();
+    };
+
+    // NON MEMBER OVERLOADS ======================================================
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    bool operator==(const unordered_map<Key, T, Hash, Pred, Alloc> &lhs, const unordered_map<Key, T, Hash, Pred, Alloc> &rhs);
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    bool operator!=(const unordered_map<Key, T, Hash, Pred, Alloc> &lhs, const unordered_map<Key, T, Hash, Pred, Alloc> &rhs);
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void swap(unordered_map<Key, T, Hash, Pred, Alloc> &x, unordered_map<Key, T, Hash, Pred, Alloc> &y);
+} // namespace ft
+
+#include "unordered_map.tpp"
+
+#endif // ********************************************** UNORDERED_MAP_HPP end //
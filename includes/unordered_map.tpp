@@ -0,0 +1,611 @@
+#ifndef UNORDERED_MAP_TPP
+#define UNORDERED_MAP_TPP
+
+#include <stdexcept>
+#include <cstring>
+#include "unordered_map.hpp"
+
+namespace ft
+{
+    // CONSTRUCTORS =================================================================
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    unordered_map<Key, T, Hash, Pred, Alloc>::unordered_map(size_type n, const hasher &hf, const key_equal &eql, const allocator_type &alloc)
+        : _ctrl(NULL), _slots(NULL), _capacity(0), _size(0), _deleted(0), _growth_left(0), _max_load_factor(0.875f),
+          _hash(hf), _eq(eql), _alloc(alloc), _ctrl_alloc(alloc)
+    {
+        reserve(n);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    template <class InputIterator>
+    unordered_map<Key, T, Hash, Pred, Alloc>::unordered_map(InputIterator first, InputIterator last, size_type n, const hasher &hf,
+                                                            const key_equal &eql, const allocator_type &alloc)
+        : _ctrl(NULL), _slots(NULL), _capacity(0), _size(0), _deleted(0), _growth_left(0), _max_load_factor(0.875f),
+          _hash(hf), _eq(eql), _alloc(alloc), _ctrl_alloc(alloc)
+    {
+        reserve(n);
+        insert(first, last);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    unordered_map<Key, T, Hash, Pred, Alloc>::unordered_map(const unordered_map &x)
+        : _ctrl(NULL), _slots(NULL), _capacity(0), _size(0), _deleted(0), _growth_left(0), _max_load_factor(x._max_load_factor),
+          _hash(x._hash), _eq(x._eq), _alloc(x._alloc), _ctrl_alloc(x._ctrl_alloc)
+    {
+        if (x._capacity == 0)
+            return;
+        _allocate(x._capacity);
+        std::memcpy(_ctrl, x._ctrl, _capacity + ctrl_group::width);
+        size_type i = 0;
+        try
+        {
+            for (; i < _capacity; i++)
+                if (_ctrl[i] >= 0)
+                    _alloc.construct(_slots + i, x._slots[i]);
+        }
+        catch (...)
+        {
+            while (i-- > 0)
+                if (_ctrl[i] >= 0)
+                    _alloc.destroy(_slots + i);
+            _deallocate();
+            throw;
+        }
+        _size = x._size;
+        _deleted = x._deleted;
+        _growth_left = x._growth_left;
+    };
+
+    // DESTRUCTOR ==================================================================
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    unordered_map<Key, T, Hash, Pred, Alloc>::~unordered_map()
+    {
+        _destroy_elements();
+        _deallocate();
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    unordered_map<Key, T, Hash, Pred, Alloc> &unordered_map<Key, T, Hash, Pred, Alloc>::operator=(const unordered_map &x)
+    {
+        if (this != &x)
+        {
+            unordered_map tmp(x);
+            swap(tmp);
+        }
+        return (*this);
+    };
+
+    // ITERATORS ====================================================================
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::iterator unordered_map<Key, T, Hash, Pred, Alloc>::begin()
+    {
+        return (iterator(_ctrl, _ctrl + _capacity, _slots));
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator unordered_map<Key, T, Hash, Pred, Alloc>::begin() const
+    {
+        return (const_iterator(_ctrl, _ctrl + _capacity, _slots));
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::iterator unordered_map<Key, T, Hash, Pred, Alloc>::end()
+    {
+        return (iterator(_ctrl + _capacity, _ctrl + _capacity, _slots + _capacity));
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator unordered_map<Key, T, Hash, Pred, Alloc>::end() const
+    {
+        return (const_iterator(_ctrl + _capacity, _ctrl + _capacity, _slots + _capacity));
+    };
+
+    // CAPACITY ===============================================================
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    bool unordered_map<Key, T, Hash, Pred, Alloc>::empty() const
+    {
+        return (_size == 0);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::size_type unordered_map<Key, T, Hash, Pred, Alloc>::size() const
+    {
+        return (_size);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::size_type unordered_map<Key, T, Hash, Pred, Alloc>::max_size() const
+    {
+        return (_alloc.max_size());
+    };
+
+    // ELEMENT ACCESS ==============================================================
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::mapped_type &unordered_map<Key, T, Hash, Pred, Alloc>::operator[](const key_type &k)
+    {
+        size_type i = _find_index(k, _hash(k));
+        if (i != _capacity)
+            return (_slots[i].second);
+        return (insert(value_type(k, mapped_type())).first->second);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::mapped_type &unordered_map<Key, T, Hash, Pred, Alloc>::at(const key_type &k)
+    {
+        size_type i = _find_index(k, _hash(k));
+        if (i == _capacity)
+            throw std::out_of_range("unordered_map::at");
+        return (_slots[i].second);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    const typename unordered_map<Key, T, Hash, Pred, Alloc>::mapped_type &unordered_map<Key, T, Hash, Pred, Alloc>::at(const key_type &k) const
+    {
+        size_type i = _find_index(k, _hash(k));
+        if (i == _capacity)
+            throw std::out_of_range("unordered_map::at");
+        return (_slots[i].second);
+    };
+
+    // MODIFIERS ====================================================================
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    ft::pair<typename unordered_map<Key, T, Hash, Pred, Alloc>::iterator, bool>
+    unordered_map<Key, T, Hash, Pred, Alloc>::insert(const value_type &val)
+    {
+        size_t hash = _hash(val.first);
+        size_type i = _find_index(val.first, hash);
+        if (i != _capacity)
+            return (ft::make_pair(iterator(_ctrl + i, _ctrl + _capacity, _slots + i), false));
+        if (_capacity == 0)
+            _resize(_capacity_for(1));
+        i = _find_free(hash);
+        if (_growth_left == 0 && _ctrl[i] == ctrl_empty)
+        {
+            // Mostly tombstones: rebuild in place instead of growing.
+            _resize(_size < _max_elements(_capacity) / 2 ? _capacity : _capacity * 2);
+            i = _find_free(hash);
+        }
+        _alloc.construct(_slots + i, val);
+        if (_ctrl[i] == ctrl_deleted)
+            _deleted--;
+        else
+            _growth_left--;
+        _set_ctrl(i, static_cast<ctrl_t>(hash & 0x7f));
+        _size++;
+        return (ft::make_pair(iterator(_ctrl + i, _ctrl + _capacity, _slots + i), true));
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    template <class InputIterator>
+    void unordered_map<Key, T, Hash, Pred, Alloc>::insert(InputIterator first, InputIterator last)
+    {
+        for (; first != last; ++first)
+            insert(*first);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void unordered_map<Key, T, Hash, Pred, Alloc>::erase(iterator position)
+    {
+        size_type i = position._ctrl - _ctrl;
+        size_type mask = _capacity - 1;
+        _alloc.destroy(_slots + i);
+        _size--;
+        // A slot can go back to empty if every window of 16 slots covering it already
+        // holds an empty slot: no probe can have walked past it without stopping.
+        unsigned int empty_after = ctrl_group(_ctrl + i).match_empty();
+        unsigned int empty_before = ctrl_group(_ctrl + ((i - ctrl_group::width) & mask)).match_empty();
+        if (empty_after && empty_before &&
+            static_cast<size_type>(__builtin_ctz(empty_after) + __builtin_clz(empty_before) - 16) < ctrl_group::width)
+        {
+            _set_ctrl(i, ctrl_empty);
+            _growth_left++;
+        }
+        else
+        {
+            _set_ctrl(i, ctrl_deleted);
+            _deleted++;
+        }
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::size_type unordered_map<Key, T, Hash, Pred, Alloc>::erase(const key_type &k)
+    {
+        size_type i = _find_index(k, _hash(k));
+        if (i == _capacity)
+            return (0);
+        erase(iterator(_ctrl + i, _ctrl + _capacity, _slots + i));
+        return (1);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void unordered_map<Key, T, Hash, Pred, Alloc>::clear()
+    {
+        if (_capacity == 0)
+            return;
+        _destroy_elements();
+        std::memset(_ctrl, ctrl_empty, _capacity + ctrl_group::width);
+        _size = 0;
+        _deleted = 0;
+        _growth_left = _max_elements(_capacity);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void unordered_map<Key, T, Hash, Pred, Alloc>::swap(unordered_map &x)
+    {
+        ctrl_t *tmp_ctrl = _ctrl;
+        pointer tmp_slots = _slots;
+        size_type tmp_capacity = _capacity;
+        size_type tmp_size = _size;
+        size_type tmp_deleted = _deleted;
+        size_type tmp_growth_left = _growth_left;
+        float tmp_max_load_factor = _max_load_factor;
+        hasher tmp_hash = _hash;
+        key_equal tmp_eq = _eq;
+        allocator_type tmp_alloc = _alloc;
+        ctrl_allocator_type tmp_ctrl_alloc = _ctrl_alloc;
+
+        _ctrl = x._ctrl;
+        _slots = x._slots;
+        _capacity = x._capacity;
+        _size = x._size;
+        _deleted = x._deleted;
+        _growth_left = x._growth_left;
+        _max_load_factor = x._max_load_factor;
+        _hash = x._hash;
+        _eq = x._eq;
+        _alloc = x._alloc;
+        _ctrl_alloc = x._ctrl_alloc;
+
+        x._ctrl = tmp_ctrl;
+        x._slots = tmp_slots;
+        x._capacity = tmp_capacity;
+        x._size = tmp_size;
+        x._deleted = tmp_deleted;
+        x._growth_left = tmp_growth_left;
+        x._max_load_factor = tmp_max_load_factor;
+        x._hash = tmp_hash;
+        x._eq = tmp_eq;
+        x._alloc = tmp_alloc;
+        x._ctrl_alloc = tmp_ctrl_alloc;
+    };
+
+    // LOOKUP =======================================================================
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::iterator unordered_map<Key, T, Hash, Pred, Alloc>::find(const key_type &k)
+    {
+        size_type i = _find_index(k, _hash(k));
+        return (iterator(_ctrl + i, _ctrl + _capacity, _slots + i));
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator unordered_map<Key, T, Hash, Pred, Alloc>::find(const key_type &k) const
+    {
+        size_type i = _find_index(k, _hash(k));
+        return (const_iterator(_ctrl + i, _ctrl + _capacity, _slots + i));
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::size_type unordered_map<Key, T, Hash, Pred, Alloc>::count(const key_type &k) const
+    {
+        return (_find_index(k, _hash(k)) == _capacity ? 0 : 1);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    ft::pair<typename unordered_map<Key, T, Hash, Pred, Alloc>::iterator, typename unordered_map<Key, T, Hash, Pred, Alloc>::iterator>
+    unordered_map<Key, T, Hash, Pred, Alloc>::equal_range(const key_type &k)
+    {
+        iterator first = find(k);
+        iterator last = first;
+        if (first != end())
+            ++last;
+        return (ft::make_pair(first, last));
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    ft::pair<typename unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator, typename unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator>
+    unordered_map<Key, T, Hash, Pred, Alloc>::equal_range(const key_type &k) const
+    {
+        const_iterator first = find(k);
+        const_iterator last = first;
+        if (first != end())
+            ++last;
+        return (ft::make_pair(first, last));
+    };
+
+    // HASH POLICY ==================================================================
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::size_type unordered_map<Key, T, Hash, Pred, Alloc>::bucket_count() const
+    {
+        return (_capacity);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    float unordered_map<Key, T, Hash, Pred, Alloc>::load_factor() const
+    {
+        return (_capacity == 0 ? 0.0f : static_cast<float>(_size) / _capacity);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    float unordered_map<Key, T, Hash, Pred, Alloc>::max_load_factor() const
+    {
+        return (_max_load_factor);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void unordered_map<Key, T, Hash, Pred, Alloc>::max_load_factor(float ml)
+    {
+        if (ml < 0.25f)
+            ml = 0.25f;
+        if (ml > 0.9375f)
+            ml = 0.9375f;
+        _max_load_factor = ml;
+        if (_capacity == 0)
+            return;
+        if (_size + _deleted > _max_elements(_capacity))
+            _resize(_capacity_for(_size));
+        else
+            _growth_left = _max_elements(_capacity) - _size - _deleted;
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void unordered_map<Key, T, Hash, Pred, Alloc>::rehash(size_type n)
+    {
+        size_type capacity = _capacity_for(_size);
+        if (n > 0 && capacity < ctrl_group::width)
+            capacity = ctrl_group::width;
+        while (capacity < n)
+            capacity *= 2;
+        if (capacity == 0)
+        {
+            _deallocate();
+            _deleted = 0;
+            _growth_left = 0;
+        }
+        else
+            _resize(capacity);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void unordered_map<Key, T, Hash, Pred, Alloc>::reserve(size_type n)
+    {
+        size_type capacity = _capacity_for(n);
+        if (capacity > _capacity)
+            _resize(capacity);
+    };
+
+    // OBSERVERS ====================================================================
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::hasher unordered_map<Key, T, Hash, Pred, Alloc>::hash_function() const
+    {
+        return (_hash);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::key_equal unordered_map<Key, T, Hash, Pred, Alloc>::key_eq() const
+    {
+        return (_eq);
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::allocator_type unordered_map<Key, T, Hash, Pred, Alloc>::get_allocator() const
+    {
+        return (_alloc);
+    };
+
+    // PRIVATE ======================================================================
+
+    /**
+     * @brief Index of the slot holding k, or _capacity when k is missing.
+     *
+     */
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::size_type
+    unordered_map<Key, T, Hash, Pred, Alloc>::_find_index(const key_type &k, size_t hash) const
+    {
+        if (_capacity == 0)
+            return (0);
+        size_type mask = _capacity - 1;
+        size_type pos = (hash >> 7) & mask;
+        ctrl_t h2 = static_cast<ctrl_t>(hash & 0x7f);
+        for (size_type step = 0;;)
+        {
+            ctrl_group group(_ctrl + pos);
+            for (unsigned int match = group.match(h2); match; match &= match - 1)
+            {
+                size_type i = (pos + __builtin_ctz(match)) & mask;
+                if (_eq(_slots[i].first, k))
+                    return (i);
+            }
+            if (group.match_empty())
+                return (_capacity);
+            step += ctrl_group::width;
+            pos = (pos + step) & mask;
+        }
+    };
+
+    /**
+     * @brief Index of the first empty or deleted slot on the probe sequence of hash.
+     *
+     */
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::size_type
+    unordered_map<Key, T, Hash, Pred, Alloc>::_find_free(size_t hash) const
+    {
+        size_type mask = _capacity - 1;
+        size_type pos = (hash >> 7) & mask;
+        for (size_type step = 0;;)
+        {
+            unsigned int match = ctrl_group(_ctrl + pos).match_empty_or_deleted();
+            if (match)
+                return ((pos + __builtin_ctz(match)) & mask);
+            step += ctrl_group::width;
+            pos = (pos + step) & mask;
+        }
+    };
+
+    /**
+     * @brief Number of full or deleted slots a table of this capacity may hold.
+     * Always below capacity, so every probe sequence meets an empty slot.
+     *
+     */
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::size_type
+    unordered_map<Key, T, Hash, Pred, Alloc>::_max_elements(size_type capacity) const
+    {
+        return (static_cast<size_type>(capacity * _max_load_factor));
+    };
+
+    /**
+     * @brief Smallest capacity holding n elements under the max load factor, 0 for n == 0.
+     *
+     */
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    typename unordered_map<Key, T, Hash, Pred, Alloc>::size_type
+    unordered_map<Key, T, Hash, Pred, Alloc>::_capacity_for(size_type n) const
+    {
+        if (n == 0)
+            return (0);
+        size_type capacity = ctrl_group::width;
+        while (_max_elements(capacity) < n)
+            capacity *= 2;
+        return (capacity);
+    };
+
+    /**
+     * @brief Sets the control byte of slot i, and its copy past the end of the array
+     * that lets a group load starting near the end wrap around.
+     *
+     */
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void unordered_map<Key, T, Hash, Pred, Alloc>::_set_ctrl(size_type i, ctrl_t h)
+    {
+        _ctrl[i] = h;
+        if (i < ctrl_group::width)
+            _ctrl[_capacity + i] = h;
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void unordered_map<Key, T, Hash, Pred, Alloc>::_allocate(size_type capacity)
+    {
+        _ctrl = _ctrl_alloc.allocate(capacity + ctrl_group::width);
+        try
+        {
+            _slots = _alloc.allocate(capacity);
+        }
+        catch (...)
+        {
+            _ctrl_alloc.deallocate(_ctrl, capacity + ctrl_group::width);
+            _ctrl = NULL;
+            throw;
+        }
+        std::memset(_ctrl, ctrl_empty, capacity + ctrl_group::width);
+        _capacity = capacity;
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void unordered_map<Key, T, Hash, Pred, Alloc>::_deallocate()
+    {
+        if (_capacity == 0)
+            return;
+        _ctrl_alloc.deallocate(_ctrl, _capacity + ctrl_group::width);
+        _alloc.deallocate(_slots, _capacity);
+        _ctrl = NULL;
+        _slots = NULL;
+        _capacity = 0;
+    };
+
+    /**
+     * @brief Moves every element to a fresh table of the given capacity, dropping tombstones.
+     * The old table is only released once every element was copied.
+     *
+     */
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void unordered_map<Key, T, Hash, Pred, Alloc>::_resize(size_type capacity)
+    {
+        ctrl_t *old_ctrl = _ctrl;
+        pointer old_slots = _slots;
+        size_type old_capacity = _capacity;
+
+        _allocate(capacity);
+        size_type i = 0;
+        try
+        {
+            for (; i < old_capacity; i++)
+            {
+                if (old_ctrl[i] < 0)
+                    continue;
+                size_t hash = _hash(old_slots[i].first);
+                size_type j = _find_free(hash);
+                _alloc.construct(_slots + j, old_slots[i]);
+                _set_ctrl(j, static_cast<ctrl_t>(hash & 0x7f));
+            }
+        }
+        catch (...)
+        {
+            _destroy_elements();
+            _deallocate();
+            _ctrl = old_ctrl;
+            _slots = old_slots;
+            _capacity = old_capacity;
+            throw;
+        }
+        for (i = 0; i < old_capacity; i++)
+            if (old_ctrl[i] >= 0)
+                _alloc.destroy(old_slots + i);
+        if (old_capacity)
+        {
+            _ctrl_alloc.deallocate(old_ctrl, old_capacity + ctrl_group::width);
+            _alloc.deallocate(old_slots, old_capacity);
+        }
+        _deleted = 0;
+        _growth_left = _max_elements(_capacity) - _size;
+    };
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void unordered_map<Key, T, Hash, Pred, Alloc>::_destroy_elements()
+    {
+        for (size_type i = 0; i < _capacity; i++)
+            if (_ctrl[i] >= 0)
+                _alloc.destroy(_slots + i);
+    };
+
+    // NON MEMBER OVERLOADS =======================================================
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    bool operator==(const unordered_map<Key, T, Hash, Pred, Alloc> &lhs, const unordered_map<Key, T, Hash, Pred, Alloc> &rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return (false);
+        typename unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator it = lhs.begin();
+        for (; it != lhs.end(); ++it)
+        {
+            typename unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator other = rhs.find(it->first);
+            if (other == rhs.end() || !(other->second == it->second))
+                return (false);
+        }
+        return (true);
+    }
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    bool operator!=(const unordered_map<Key, T, Hash, Pred, Alloc> &lhs, const unordered_map<Key, T, Hash, Pred, Alloc> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class Key, class T, class Hash, class Pred, class Alloc>
+    void swap(unordered_map<Key, T, Hash, Pred, Alloc> &x, unordered_map<Key, T, Hash, Pred, Alloc> &y)
+    {
+        x.swap(y);
+    }
+}
+
+#endif // ********************************************** UNORDERED_MAP_TPP end //
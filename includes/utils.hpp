@@ -95,6 +95,7 @@ namespace ft
         static const bool value = true;
     };
 
+#if __cplusplus >= 201103L
     template <>
     struct is_integral<char16_t>
     {
@@ -106,6 +107,7 @@ namespace ft
     {
         static const bool value = true;
     };
+#endif
 
     template <>
     struct is_integral<short>
@@ -155,6 +157,29 @@ namespace ft
         static const bool value = true;
     };
 
+    // is_same ======================================================================
+    /*
+     * Checks whether T and U name the same type, with the same cv-qualifications.
+     */
+
+    /**
+     * @brief is_same provides the member constant value, true if T and U are the same type.
+     *
+     * @tparam T
+     * @tparam U
+     */
+    template <typename T, typename U>
+    struct is_same
+    {
+        static const bool value = false;
+    };
+
+    template <typename T>
+    struct is_same<T, T>
+    {
+        static const bool value = true;
+    };
+
 } // namespace ft
 
 #endif // ********************************************** VECTOR_HPP end //
\ No newline at end of file
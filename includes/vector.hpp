@@ -7,11 +7,30 @@
 #include "./utils.hpp"
 #include "./iterator.hpp"
 #include "./algorithm.hpp"
+#include "./stats_policy.hpp"
 
 namespace ft
 {
+    // ALLOCATOR GROWTH ============================================================
+
+    /**
+     * @brief Lets an allocator grow a vector's buffer without the vector copying its
+     * elements. grow() returns the buffer holding the same elements with room for new_n,
+     * or NULL, in which case reserve() allocates, copies and frees as usual. Allocators
+     * that can do better specialize this template.
+     */
+    template <typename Alloc>
+    struct allocator_growth
+    {
+        static typename Alloc::pointer grow(Alloc &, typename Alloc::pointer, typename Alloc::size_type,
+                                            typename Alloc::size_type)
+        {
+            return NULL;
+        }
+    };
+
     // CLASS =======================================================================
-    template <typename T, typename Alloc = std::allocator<T> >
+    template <typename T, typename Alloc = std::allocator<T>, typename Stats = ft::null_stats>
     class vector
     {
     public:
@@ -29,6 +48,13 @@ namespace ft
          */
         typedef Alloc allocator_type;
 
+        /**
+         * @brief The third template parameter (Stats) is told about reallocations and
+         * about elements copied by reserve(), insert() and erase(). The default,
+         * ft::null_stats, does nothing and costs nothing; see stats_policy.hpp.
+         */
+        typedef Stats stats_policy;
+
         /**
          * @brief The allocator_type::reference is an alias of T&.
          *
@@ -402,6 +428,41 @@ namespace ft
          * @return allocator_type
          */
         allocator_type get_allocator() const;
+
+    private:
+        // BULK KERNELS ==========================================================
+
+        /**
+         * @brief Replaces the contents with n copies of the elements from first. Reuses the
+         * buffer when it holds n: live elements are assigned over, the tail is
+         * constructed and any surplus destroyed. Otherwise builds a buffer of exactly n
+         * before releasing the old one.
+         */
+        template <class Iterator>
+        void _assign_range(Iterator first, size_type n);
+
+        /**
+         * @brief Same as _assign_range, with every element a copy of val.
+         */
+        void _assign_fill(size_type n, const value_type &val);
+
+        /**
+         * @brief Constructs n elements at dst from first onwards. If a constructor throws,
+         * the elements already built are destroyed before rethrowing.
+         */
+        template <class Iterator>
+        void _construct_range(pointer dst, Iterator first, size_type n);
+
+        /**
+         * @brief Constructs n copies of val at dst, with the same guarantee as
+         * _construct_range.
+         */
+        void _construct_fill(pointer dst, size_type n, const value_type &val);
+
+        /**
+         * @brief Destroys the elements in [first, last).
+         */
+        void _destroy(pointer first, pointer last);
     };
 
     // NON MEMBER OVERLOADS ======================================================
@@ -410,43 +471,43 @@ namespace ft
      * @brief Check if lhs is equal to rhs
      *
      */
-    template <typename T, typename Alloc>
-    bool operator==(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs);
+    template <typename T, typename Alloc, typename Stats>
+    bool operator==(const vector<T, Alloc, Stats> &lhs, const vector<T, Alloc, Stats> &rhs);
 
     /**
      * @brief Check if lhs is different from rhs
      *
      */
-    template <typename T, typename Alloc>
-    bool operator!=(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs);
+    template <typename T, typename Alloc, typename Stats>
+    bool operator!=(const vector<T, Alloc, Stats> &lhs, const vector<T, Alloc, Stats> &rhs);
 
     /**
      * @brief Check if lhs is less than rhs
      *
      */
-    template <typename T, typename Alloc>
-    bool operator<(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs);
+    template <typename T, typename Alloc, typename Stats>
+    bool operator<(const vector<T, Alloc, Stats> &lhs, const vector<T, Alloc, Stats> &rhs);
 
     /**
      * @brief Check if lhs is less than or equal to rhs
      *
      */
-    template <typename T, typename Alloc>
-    bool operator<=(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs);
+    template <typename T, typename Alloc, typename Stats>
+    bool operator<=(const vector<T, Alloc, Stats> &lhs, const vector<T, Alloc, Stats> &rhs);
 
     /**
      * @brief Check if lhs is greater than rhs
      *
      */
-    template <typename T, typename Alloc>
-    bool operator>(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs);
+    template <typename T, typename Alloc, typename Stats>
+    bool operator>(const vector<T, Alloc, Stats> &lhs, const vector<T, Alloc, Stats> &rhs);
 
     /**
      * @brief Check if lhs is greater than or equal to rhs
      *
      */
-    template <typename T, typename Alloc>
-    bool operator>=(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs);
+    template <typename T, typename Alloc, typename Stats>
+    bool operator>=(const vector<T, Alloc, Stats> &lhs, const vector<T, Alloc, Stats> &rhs);
 
     /**
      * @brief  The contents of container x are exchanged with those of y.
@@ -454,8 +515,8 @@ namespace ft
      * although sizes may differ.
      *
      */
-    template <typename T, typename Alloc>
-    void swap(vector<T, Alloc> &X, vector<T, Alloc> &Y);
+    template <typename T, typename Alloc, typename Stats>
+    void swap(vector<T, Alloc, Stats> &X, vector<T, Alloc, Stats> &Y);
 
 } // namespace ft
 
@@ -9,8 +9,8 @@ namespace ft
 {
     // CONSTRUCTORS =================================================================
 
-    template <typename T, typename Alloc>
-    vector<T, Alloc>::vector(const allocator_type &alloc)
+    template <typename T, typename Alloc, typename Stats>
+    vector<T, Alloc, Stats>::vector(const allocator_type &alloc)
     {
         _alloc = alloc;
         _size = 0;
@@ -18,8 +18,8 @@ namespace ft
         _data = NULL;
     };
 
-    template <typename T, typename Alloc>
-    vector<T, Alloc>::vector(size_type n, const value_type &val, const allocator_type &alloc)
+    template <typename T, typename Alloc, typename Stats>
+    vector<T, Alloc, Stats>::vector(size_type n, const value_type &val, const allocator_type &alloc)
     {
         _alloc = alloc;
         _size = n;
@@ -29,95 +29,90 @@ namespace ft
             _alloc.construct(_data + i, val);
     };
 
-    template <typename T, typename Alloc>
-    vector<T, Alloc>::vector(const vector &x)
+    template <typename T, typename Alloc, typename Stats>
+    vector<T, Alloc, Stats>::vector(const vector &x)
     {
         _alloc = x._alloc;
         _size = x._size;
-        _capacity = x._capacity;
+        _capacity = x._size;
         _data = _alloc.allocate(x._size);
-        for (size_type i = 0; i < x._size; i++)
-            _alloc.construct(_data + i, x._data[i]);
+        try
+        {
+            _construct_range(_data, x._data, x._size);
+        }
+        catch (...)
+        {
+            _alloc.deallocate(_data, _capacity);
+            throw;
+        }
     };
 
     // DESTRUCTOR ==================================================================
 
-    template <typename T, typename Alloc>
-    vector<T, Alloc>::~vector()
+    template <typename T, typename Alloc, typename Stats>
+    vector<T, Alloc, Stats>::~vector()
     {
         clear();
         _alloc.deallocate(_data, _capacity);
     };
 
     // NON MEMBER OVERLOADS =======================================================
-    template <typename T, class Alloc>
-    vector<T, Alloc> &vector<T, Alloc>::operator=(const vector &x)
+    template <typename T, class Alloc, class Stats>
+    vector<T, Alloc, Stats> &vector<T, Alloc, Stats>::operator=(const vector &x)
     {
         if (this != &x)
-        {
-            clear();
-            _alloc.deallocate(_data, _capacity);
-            _alloc = x._alloc;
-            _size = x._size;
-            _capacity = x._capacity;
-            _data = _alloc.allocate(x._size);
-            for (size_type i = 0; i < x._size; i++)
-                _alloc.construct(_data + i, x._data[i]);
-        }
+            _assign_range(x._data, x._size);
         return (*this);
     };
 
-    template <typename T, typename Alloc>
-    bool operator==(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template <typename T, typename Alloc, typename Stats>
+    bool operator==(const vector<T, Alloc, Stats> &lhs, const vector<T, Alloc, Stats> &rhs)
     {
         if (lhs.size() != rhs.size())
             return false;
-        for (size_t i = 0; i < lhs.size(); i++)
-            if (lhs[i] != rhs[i])
-                return false;
-        return true;
+        return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
     };
 
-    template <class T, class Alloc>
-    bool operator!=(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template <class T, class Alloc, class Stats>
+    bool operator!=(const vector<T, Alloc, Stats> &lhs, const vector<T, Alloc, Stats> &rhs)
     {
         return !(lhs == rhs);
     }
 
-    template <class T, class Alloc>
-    bool operator<(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template <class T, class Alloc, class Stats>
+    bool operator<(const vector<T, Alloc, Stats> &lhs, const vector<T, Alloc, Stats> &rhs)
     {
         return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
-    template <class T, class Alloc>
-    bool operator<=(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template <class T, class Alloc, class Stats>
+    bool operator<=(const vector<T, Alloc, Stats> &lhs, const vector<T, Alloc, Stats> &rhs)
     {
         return !(rhs < lhs);
     }
 
-    template <class T, class Alloc>
-    bool operator>(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template <class T, class Alloc, class Stats>
+    bool operator>(const vector<T, Alloc, Stats> &lhs, const vector<T, Alloc, Stats> &rhs)
     {
         return rhs < lhs;
     }
 
-    template <class T, class Alloc>
-    bool operator>=(const vector<T, Alloc> &lhs, const vector<T, Alloc> &rhs)
+    template <class T, class Alloc, class Stats>
+    bool operator>=(const vector<T, Alloc, Stats> &lhs, const vector<T, Alloc, Stats> &rhs)
     {
         return !(lhs < rhs);
     }
 
-    template <class T, class Alloc>
-    void swap(vector<T, Alloc> &x, vector<T, Alloc> &y)
+    template <class T, class Alloc, class Stats>
+    void swap(vector<T, Alloc, Stats> &x, vector<T, Alloc, Stats> &y)
     {
         x.swap(y);
     }
 
     // MODIFIERS ====================================================================
 
-    template <typename T, typename Alloc>
-    void vector<T, Alloc>::push_back(const value_type &val)
+    template <typename T, typename Alloc, typename Stats>
+    void vector<T, Alloc, Stats>::push_back(const value_type &val)
     {
         if (_size == _capacity)
             reserve(_capacity == 0 ? 1 : _capacity * 2);
@@ -125,8 +120,8 @@ namespace ft
         _size++;
     };
 
-    template <typename T, typename Alloc>
-    void vector<T, Alloc>::pop_back()
+    template <typename T, typename Alloc, typename Stats>
+    void vector<T, Alloc, Stats>::pop_back()
     {
         if (_size == 0)
             throw std::out_of_range("vector");
@@ -134,40 +129,35 @@ namespace ft
         _size--;
     };
 
-    template <typename T, typename Alloc>
-    void vector<T, Alloc>::clear()
+    template <typename T, typename Alloc, typename Stats>
+    void vector<T, Alloc, Stats>::clear()
     {
         for (size_type i = 0; i < _size; i++)
             _alloc.destroy(_data + i);
         _size = 0;
     };
 
-    template <typename T, typename Alloc>
-    void vector<T, Alloc>::assign(size_type n, const value_type &val)
+    template <typename T, typename Alloc, typename Stats>
+    void vector<T, Alloc, Stats>::assign(size_type n, const value_type &val)
     {
-        clear();
-        reserve(n);
-        for (size_type i = 0; i < n; i++)
-            push_back(val);
+        _assign_fill(n, val);
     };
 
-    template <typename T, typename Alloc>
+    template <typename T, typename Alloc, typename Stats>
     template <typename InputIterator>
-    void vector<T, Alloc>::assign(InputIterator first, InputIterator last)
+    void vector<T, Alloc, Stats>::assign(InputIterator first, InputIterator last)
     {
-        clear();
-        reserve(last - first);
-        for (InputIterator it = first; it != last; it++)
-            push_back(*it);
+        _assign_range(first, last - first);
     };
 
-    template <typename T, class Alloc>
-    typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(iterator position, const value_type &val)
+    template <typename T, class Alloc, class Stats>
+    typename vector<T, Alloc, Stats>::iterator vector<T, Alloc, Stats>::insert(iterator position, const value_type &val)
     {
         size_type pos = position - begin();
 
         if (_size == _capacity)
             reserve(_capacity + 1);
+        Stats::add_copies(_size - pos, (_size - pos) * sizeof(value_type));
         for (size_type i = _size; i > pos; i--)
             _alloc.construct(_data + i, _data[i - 1]);
         _alloc.construct(_data + pos, val);
@@ -175,11 +165,12 @@ namespace ft
         return begin() + pos;
     };
 
-    template <typename T, typename Alloc>
-    void vector<T, Alloc>::insert(iterator position, size_type n, const value_type &val)
+    template <typename T, typename Alloc, typename Stats>
+    void vector<T, Alloc, Stats>::insert(iterator position, size_type n, const value_type &val)
     {
         size_type pos = position - begin();
         reserve(_size + n);
+        Stats::add_copies(_size - pos, (_size - pos) * sizeof(value_type));
         for (size_type i = _size; i > pos; i--)
             _data[i + n - 1] = _data[i - 1];
         for (size_type i = 0; i < n; i++)
@@ -187,13 +178,14 @@ namespace ft
         _size += n;
     };
 
-    template <typename T, typename Alloc>
+    template <typename T, typename Alloc, typename Stats>
     template <typename InputIterator>
-    void vector<T, Alloc>::insert(iterator position, InputIterator first, InputIterator last)
+    void vector<T, Alloc, Stats>::insert(iterator position, InputIterator first, InputIterator last)
     {
         size_type pos = position - begin();
         size_type n = last - first;
         reserve(_size + n);
+        Stats::add_copies(_size - pos, (_size - pos) * sizeof(value_type));
         for (size_type i = _size; i > pos; i--)
             _data[i + n - 1] = _data[i - 1];
         for (size_type i = 0; i < n; i++)
@@ -201,10 +193,11 @@ namespace ft
         _size += n;
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(iterator position)
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::iterator vector<T, Alloc, Stats>::erase(iterator position)
     {
         size_type pos = position - begin();
+        Stats::add_copies(_size - pos - 1, (_size - pos - 1) * sizeof(value_type));
         for (size_type i = pos; i < _size - 1; i++)
             _data[i] = _data[i + 1];
         _alloc.destroy(_data + _size - 1);
@@ -212,11 +205,12 @@ namespace ft
         return begin() + pos;
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(iterator first, iterator last)
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::iterator vector<T, Alloc, Stats>::erase(iterator first, iterator last)
     {
         size_type pos = first - begin();
         size_type n = last - first;
+        Stats::add_copies(_size - pos - n, (_size - pos - n) * sizeof(value_type));
         for (size_type i = pos; i < _size - n; i++)
             _data[i] = _data[i + n];
         for (size_type i = 0; i < n; i++)
@@ -225,8 +219,8 @@ namespace ft
         return begin() + pos;
     };
 
-    template <typename T, typename Alloc>
-    void vector<T, Alloc>::swap(vector &x)
+    template <typename T, typename Alloc, typename Stats>
+    void vector<T, Alloc, Stats>::swap(vector &x)
     {
         pointer tmp_data = _data;
         size_type tmp_size = _size;
@@ -244,45 +238,143 @@ namespace ft
         x._alloc = tmp_alloc;
     };
 
+    // BULK KERNELS =================================================================
+
+    template <typename T, typename Alloc, typename Stats>
+    template <class Iterator>
+    void vector<T, Alloc, Stats>::_assign_range(Iterator first, size_type n)
+    {
+        if (n > _capacity)
+        {
+            Stats::add_reallocation();
+            pointer tmp = _alloc.allocate(n);
+            try
+            {
+                _construct_range(tmp, first, n);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(tmp, n);
+                throw;
+            }
+            _destroy(_data, _data + _size);
+            _alloc.deallocate(_data, _capacity);
+            _data = tmp;
+            _capacity = n;
+            _size = n;
+            return;
+        }
+        size_type live = n < _size ? n : _size;
+        for (size_type i = 0; i < live; i++, ++first)
+            _data[i] = *first;
+        if (n > _size)
+            _construct_range(_data + _size, first, n - _size);
+        else
+            _destroy(_data + n, _data + _size);
+        _size = n;
+    };
+
+    template <typename T, typename Alloc, typename Stats>
+    void vector<T, Alloc, Stats>::_assign_fill(size_type n, const value_type &val)
+    {
+        if (n > _capacity)
+        {
+            Stats::add_reallocation();
+            pointer tmp = _alloc.allocate(n);
+            try
+            {
+                _construct_fill(tmp, n, val);
+            }
+            catch (...)
+            {
+                _alloc.deallocate(tmp, n);
+                throw;
+            }
+            _destroy(_data, _data + _size);
+            _alloc.deallocate(_data, _capacity);
+            _data = tmp;
+            _capacity = n;
+            _size = n;
+            return;
+        }
+        size_type live = n < _size ? n : _size;
+        for (size_type i = 0; i < live; i++)
+            _data[i] = val;
+        if (n > _size)
+            _construct_fill(_data + _size, n - _size, val);
+        else
+            _destroy(_data + n, _data + _size);
+        _size = n;
+    };
+
+    template <typename T, typename Alloc, typename Stats>
+    template <class Iterator>
+    void vector<T, Alloc, Stats>::_construct_range(pointer dst, Iterator first, size_type n)
+    {
+        size_type i = 0;
+        try
+        {
+            for (; i < n; i++, ++first)
+                _alloc.construct(dst + i, *first);
+        }
+        catch (...)
+        {
+            _destroy(dst, dst + i);
+            throw;
+        }
+    };
+
+    template <typename T, typename Alloc, typename Stats>
+    void vector<T, Alloc, Stats>::_construct_fill(pointer dst, size_type n, const value_type &val)
+    {
+        size_type i = 0;
+        try
+        {
+            for (; i < n; i++)
+                _alloc.construct(dst + i, val);
+        }
+        catch (...)
+        {
+            _destroy(dst, dst + i);
+            throw;
+        }
+    };
+
+    template <typename T, typename Alloc, typename Stats>
+    void vector<T, Alloc, Stats>::_destroy(pointer first, pointer last)
+    {
+        for (; first != last; ++first)
+            _alloc.destroy(first);
+    };
+
     // ALLOCATOR ====================================================================
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::allocator_type vector<T, Alloc>::get_allocator() const
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::allocator_type vector<T, Alloc, Stats>::get_allocator() const
     {
         return _alloc;
     };
 
     // CAPACITY ===============================================================
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::size_type vector<T, Alloc>::size() const
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::size_type vector<T, Alloc, Stats>::size() const
     {
         return (_size);
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::size_type vector<T, Alloc>::max_size() const
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::size_type vector<T, Alloc, Stats>::max_size() const
     {
         return (_alloc.max_size());
     };
 
-    template <typename T, typename Alloc>
-    void vector<T, Alloc>::resize(size_type n, value_type val)
+    template <typename T, typename Alloc, typename Stats>
+    void vector<T, Alloc, Stats>::resize(size_type n, value_type val)
     {
         if (n > _size)
         {
-            if (n > _capacity)
-            {
-                _capacity = n;
-                pointer tmp = _alloc.allocate(_capacity);
-                for (size_type i = 0; i < _size; i++)
-                {
-                    _alloc.construct(tmp + i, _data[i]);
-                    _alloc.destroy(_data + i);
-                }
-                _alloc.deallocate(_data, _size);
-                _data = tmp;
-            }
+            reserve(n);
             for (size_type i = _size; i < n; i++)
                 _alloc.construct(_data + i, val);
         }
@@ -294,26 +386,35 @@ namespace ft
         _size = n;
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::size_type vector<T, Alloc>::capacity() const
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::size_type vector<T, Alloc, Stats>::capacity() const
     {
         return (_capacity);
     };
 
-    template <typename T, typename Alloc>
-    bool vector<T, Alloc>::empty(void) const
+    template <typename T, typename Alloc, typename Stats>
+    bool vector<T, Alloc, Stats>::empty(void) const
     {
         return (_size == 0);
     };
 
-    template <typename T, typename Alloc>
-    void vector<T, Alloc>::reserve(size_type n)
+    template <typename T, typename Alloc, typename Stats>
+    void vector<T, Alloc, Stats>::reserve(size_type n)
     {
         if (n > _capacity)
         {
+            Stats::add_reallocation();
+            pointer grown = allocator_growth<Alloc>::grow(_alloc, _data, _capacity, n);
+            if (grown != NULL)
+            {
+                _data = grown;
+                _capacity = n;
+                return;
+            }
             pointer tmp = _alloc.allocate(n);
             if (tmp == NULL)
                 throw std::bad_alloc();
+            Stats::add_copies(_size, _size * sizeof(value_type));
             for (size_type i = 0; i < _size; i++)
                 _alloc.construct(tmp + i, _data[i]);
             for (size_type i = 0; i < _size; i++)
@@ -325,104 +426,104 @@ namespace ft
     };
 
     // ACCESSORS ====================================================================
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::reference vector<T, Alloc>::operator[](size_type n)
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::reference vector<T, Alloc, Stats>::operator[](size_type n)
     {
         return (_data[n]);
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::const_reference vector<T, Alloc>::operator[](size_type n) const
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::const_reference vector<T, Alloc, Stats>::operator[](size_type n) const
     {
         return (_data[n]);
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::reference vector<T, Alloc>::at(size_type n)
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::reference vector<T, Alloc, Stats>::at(size_type n)
     {
         if (n >= _size)
             throw std::out_of_range("vector::at");
         return (_data[n]);
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::const_reference vector<T, Alloc>::at(size_type n) const
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::const_reference vector<T, Alloc, Stats>::at(size_type n) const
     {
         if (n >= _size)
             throw std::out_of_range("vector::at");
         return (_data[n]);
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::reference vector<T, Alloc>::front()
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::reference vector<T, Alloc, Stats>::front()
     {
         return (_data[0]);
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::const_reference vector<T, Alloc>::front() const
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::const_reference vector<T, Alloc, Stats>::front() const
     {
         return (_data[0]);
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::reference vector<T, Alloc>::back()
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::reference vector<T, Alloc, Stats>::back()
     {
         return (_data[_size - 1]);
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::const_reference vector<T, Alloc>::back() const
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::const_reference vector<T, Alloc, Stats>::back() const
     {
         return (_data[_size - 1]);
     };
 
     // ITERATORS ====================================================================
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::iterator vector<T, Alloc>::begin()
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::iterator vector<T, Alloc, Stats>::begin()
     {
         return (iterator(_data));
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::const_iterator vector<T, Alloc>::begin() const
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::const_iterator vector<T, Alloc, Stats>::begin() const
     {
         return (const_iterator(_data));
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::iterator vector<T, Alloc>::end()
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::iterator vector<T, Alloc, Stats>::end()
     {
         return (iterator(_data + _size));
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::const_iterator vector<T, Alloc>::end() const
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::const_iterator vector<T, Alloc, Stats>::end() const
     {
         return (const_iterator(_data + _size));
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::reverse_iterator vector<T, Alloc>::rbegin()
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::reverse_iterator vector<T, Alloc, Stats>::rbegin()
     {
         return (reverse_iterator(end()));
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::const_reverse_iterator vector<T, Alloc>::rbegin() const
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::const_reverse_iterator vector<T, Alloc, Stats>::rbegin() const
     {
         return (const_reverse_iterator(end()));
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::reverse_iterator vector<T, Alloc>::rend()
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::reverse_iterator vector<T, Alloc, Stats>::rend()
     {
         return (reverse_iterator(begin()));
     };
 
-    template <typename T, typename Alloc>
-    typename vector<T, Alloc>::const_reverse_iterator vector<T, Alloc>::rend() const
+    template <typename T, typename Alloc, typename Stats>
+    typename vector<T, Alloc, Stats>::const_reverse_iterator vector<T, Alloc, Stats>::rend() const
     {
         return (const_reverse_iterator(begin()));
     };
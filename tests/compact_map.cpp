@@ -0,0 +1,195 @@
+#include "./tests.hpp"
+#include "../includes/compact_map.hpp"
+
+typedef ft::compact_map<int, int> int_map;
+typedef ft::compact_map<int, std::string> string_map;
+
+template <typename Map, typename Ref>
+static bool same_content(const Map &m, const Ref &ref)
+{
+	if (m.size() != ref.size())
+		return (false);
+	typename Map::const_iterator it = m.begin();
+	for (typename Ref::const_iterator r = ref.begin(); r != ref.end(); ++r, ++it)
+		if (it == m.end() || it->first != r->first || it->second != r->second)
+			return (false);
+	return (it == m.end());
+}
+
+static void basics(void)
+{
+	print_header("Find / Insert / Erase");
+	int_map m;
+	std::map<int, int> ref;
+	check("empty()", m.empty() && m.begin() == m.end() && m.capacity() == 0);
+	for (int i = 0; i < 5000; i++)
+	{
+		int key = (int)((i * 2654435761u) % 10007);
+		m.insert(ft::make_pair(key, i));
+		ref.insert(std::make_pair(key, i));
+	}
+	check("insert()", same_content(m, ref));
+	check("insert() existing", !m.insert(ft::make_pair(ref.begin()->first, -1)).second && m.begin()->second == ref.begin()->second);
+	check("find()", m.find(ref.rbegin()->first)->second == ref.rbegin()->second && m.find(-1) == m.end());
+	check("count()", m.count(ref.begin()->first) == 1 && m.count(10007) == 0);
+	check("lower_bound()", m.lower_bound(5000)->first == ref.lower_bound(5000)->first);
+	check("upper_bound()", m.upper_bound(5000)->first == ref.upper_bound(5000)->first);
+	check("upper_bound() past the end", m.upper_bound(10007) == m.end());
+	m[10008] = 7;
+	ref[10008] = 7;
+	check("operator[]", m[10008] == 7 && same_content(m, ref));
+
+	bool counts = true;
+	for (int i = 0; i < 10007; i += 2)
+		counts = counts && m.erase(i) == ref.erase(i);
+	check("erase(key)", counts && same_content(m, ref));
+	m.erase(m.lower_bound(1000), m.lower_bound(3000));
+	ref.erase(ref.lower_bound(1000), ref.lower_bound(3000));
+	check("erase(first, last)", same_content(m, ref));
+	m.erase(m.begin());
+	ref.erase(ref.begin());
+	check("erase(position)", same_content(m, ref));
+
+	size_t capacity = m.capacity();
+	for (int i = 0; i < 10007; i += 2)
+	{
+		m.insert(ft::make_pair(i, i));
+		ref.insert(std::make_pair(i, i));
+	}
+	check("free slots reused", same_content(m, ref) && m.capacity() == capacity);
+}
+
+static void iterators(void)
+{
+	print_header("Iterators");
+	int_map m;
+	for (int i = 0; i < 100; i++)
+		m[i] = i * i;
+	int_map::iterator it = m.find(40);
+	for (int i = 100; i < 10000; i++)
+		m[i] = i;
+	check("iterator survives growth", it->first == 40 && it->second == 1600);
+	int_map::iterator next = m.find(41);
+	m.erase(40);
+	check("erase keeps other iterators", next->first == 41 && (--next)->first == 39);
+
+	int sum = 0;
+	for (int_map::reverse_iterator r = m.rbegin(); r != m.rend(); ++r)
+		sum += r->first;
+	int expected = 0;
+	for (int_map::const_iterator c = m.begin(); c != m.end(); c++)
+		expected += c->first;
+	check("reverse_iterator", sum == expected && m.rbegin()->first == 9999);
+	check("--end()", (--m.end())->first == 9999);
+	const int_map &cm = m;
+	check("const_iterator", cm.find(41) == m.find(41) && cm.begin()->first == 0);
+	check("equal_range()", m.equal_range(41).first->first == 41 && m.equal_range(41).second->first == 42);
+}
+
+static void copies(void)
+{
+	print_header("Copy / Swap / Clear");
+	string_map m;
+	std::map<int, std::string> ref;
+	for (int i = 0; i < 3000; i++)
+	{
+		int key = (int)((i * 40503u) % 3001);
+		m[key] = std::string(i % 40, 'a' + i % 26);
+		ref[key] = std::string(i % 40, 'a' + i % 26);
+	}
+	for (int i = 0; i < 3000; i += 3)
+	{
+		m.erase(i);
+		ref.erase(i);
+	}
+	string_map copy(m);
+	check("copy constructor", same_content(copy, ref) && copy == m);
+	copy[1] = "changed";
+	check("copies are independent", m[1] != "changed");
+	string_map assigned;
+	assigned = copy;
+	check("operator=", assigned == copy && assigned != m);
+	assigned = m;
+	bool reused = assigned == m && assigned.size() == m.size();
+	assigned = copy;
+	check("operator= over live slots", reused && assigned == copy);
+
+	string_map other;
+	other[-1] = "one";
+	other.swap(m);
+	check("swap()", same_content(other, ref) && m.size() == 1 && m.begin()->second == "one");
+	check("relational operators", m < other || other < m);
+
+	size_t capacity = other.capacity();
+	other.clear();
+	check("clear()", other.empty() && other.begin() == other.end() && other.capacity() == capacity);
+	other[5] = "five";
+	check("insert after clear()", other.size() == 1 && other[5] == "five");
+}
+
+/**
+ * @brief Value whose copy throws once copies_left runs out.
+ */
+struct ThrowingCopy
+{
+	static int copies_left;
+	int value;
+
+	ThrowingCopy(int v = 0) : value(v) {}
+	ThrowingCopy(const ThrowingCopy &other) : value(other.value)
+	{
+		if (copies_left-- == 0)
+			throw std::runtime_error("copy failed");
+	}
+};
+
+int ThrowingCopy::copies_left = -1;
+
+static void failed_assignment(void)
+{
+	print_header("Failed assignment");
+	typedef ft::compact_map<int, ThrowingCopy> throwing_map;
+	throwing_map a;
+	throwing_map b;
+	for (int i = 0; i < 64; i++)
+	{
+		a.insert(ft::make_pair(i, ThrowingCopy(i)));
+		b.insert(ft::make_pair(i * 2 + 1, ThrowingCopy(-i)));
+	}
+	a.erase(7);
+	ThrowingCopy::copies_left = 10;
+	bool thrown = false;
+	try
+	{
+		a = b;
+	}
+	catch (std::runtime_error &)
+	{
+		thrown = true;
+	}
+	ThrowingCopy::copies_left = -1;
+	bool unchanged = a.size() == 63 && a.count(7) == 0 && a.count(5) == 1 && a.find(5)->second.value == 5;
+	int expected = 0;
+	for (throwing_map::const_iterator it = a.begin(); it != a.end(); ++it, ++expected)
+		unchanged = unchanged && it->first == expected + (expected >= 7);
+	check("throwing copy leaves target as is", thrown && unchanged);
+	a = b;
+	check("operator= after a failure", a.size() == 64 && a.find(9)->second.value == -4);
+}
+
+static void layout(void)
+{
+	print_header("Layout");
+	check("32-bit links", sizeof(ft::compact_map_node<ft::pair<const int, int> >) == 4 * sizeof(int) + 2 * sizeof(int));
+	check("smaller than TREE_Node", sizeof(ft::compact_map_node<ft::pair<const int, long> >) < sizeof(TREE_Node<ft::pair<const int, long> >));
+	check("max_size() bounded by indices", int_map().max_size() <= 0xffffffffu);
+}
+
+void test_compact_map(void)
+{
+	basics();
+	iterators();
+	copies();
+	failed_assignment();
+	layout();
+}
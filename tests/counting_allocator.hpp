@@ -0,0 +1,91 @@
+#ifndef COUNTING_ALLOCATOR_HPP
+#define COUNTING_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+
+// COUNTING ALLOCATOR ==========================================================
+// Shared by the tests and the benches, which include it from bench/bench.hpp.
+
+/**
+ * @brief Units an AllocationCounter can count in.
+ */
+struct count_objects
+{
+	static size_t amount(size_t n, size_t) { return (n); }
+};
+
+struct count_bytes
+{
+	static size_t amount(size_t n, size_t size) { return (n * size); }
+};
+
+struct count_calls
+{
+	static size_t amount(size_t, size_t) { return (1); }
+};
+
+/**
+ * @brief Allocator traffic in Unit, shared by every CountingAllocator reporting to it:
+ * allocated only grows, live goes back down on deallocate(). Each Tag gets its own
+ * counts.
+ */
+template <typename Unit, typename Tag = void>
+struct AllocationCounter
+{
+	static size_t allocated;
+	static size_t live;
+
+	static void add(size_t n, size_t size)
+	{
+		allocated += Unit::amount(n, size);
+		live += Unit::amount(n, size);
+	}
+
+	static void remove(size_t n, size_t size) { live -= Unit::amount(n, size); }
+};
+
+template <typename Unit, typename Tag>
+size_t AllocationCounter<Unit, Tag>::allocated = 0;
+template <typename Unit, typename Tag>
+size_t AllocationCounter<Unit, Tag>::live = 0;
+
+/**
+ * @brief std::allocator reporting to Counter. An instance built with a pointer also
+ * keeps the calls made through it and its copies live there, which tells whether a
+ * container used the allocator it was given or a default constructed one.
+ */
+template <typename T, typename Counter>
+struct CountingAllocator : public std::allocator<T>
+{
+	template <typename U>
+	struct rebind
+	{
+		typedef CountingAllocator<U, Counter> other;
+	};
+
+	size_t *instance_live;
+
+	CountingAllocator() : instance_live(NULL) {}
+	explicit CountingAllocator(size_t *live) : instance_live(live) {}
+	CountingAllocator(const CountingAllocator &other) : std::allocator<T>(), instance_live(other.instance_live) {}
+	template <typename U>
+	CountingAllocator(const CountingAllocator<U, Counter> &other) : instance_live(other.instance_live) {}
+
+	T *allocate(size_t n, const void * = 0)
+	{
+		Counter::add(n, sizeof(T));
+		if (instance_live != NULL)
+			(*instance_live)++;
+		return (std::allocator<T>::allocate(n));
+	}
+
+	void deallocate(T *p, size_t n)
+	{
+		Counter::remove(n, sizeof(T));
+		if (instance_live != NULL)
+			(*instance_live)--;
+		std::allocator<T>::deallocate(p, n);
+	}
+};
+#endif
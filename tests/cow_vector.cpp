@@ -0,0 +1,144 @@
+#include "./tests.hpp"
+#include <pthread.h>
+#include <string>
+#include "../includes/cow_vector.hpp"
+
+typedef ft::cow_vector<int> int_vector;
+
+static bool same_content(const int_vector &v, const std::vector<int> &ref)
+{
+	if (v.size() != ref.size())
+		return (false);
+	for (size_t i = 0; i < ref.size(); i++)
+		if (v[i] != ref[i])
+			return (false);
+	return (true);
+}
+
+static void basics(void)
+{
+	print_header("Vector operations");
+	int_vector v;
+	std::vector<int> ref;
+	check("empty()", v.empty() && v.use_count() == 0);
+	for (int i = 0; i < 100; i++)
+	{
+		v.push_back(i);
+		ref.push_back(i);
+	}
+	check("push_back()", same_content(v, ref));
+	v.insert(v.begin() + 10, -1);
+	ref.insert(ref.begin() + 10, -1);
+	v.insert(v.end(), -2);
+	ref.insert(ref.end(), -2);
+	check("insert()", same_content(v, ref));
+	v.erase(v.begin() + 20, v.begin() + 30);
+	ref.erase(ref.begin() + 20, ref.begin() + 30);
+	v.erase(v.begin());
+	ref.erase(ref.begin());
+	check("erase()", same_content(v, ref));
+	v.pop_back();
+	ref.pop_back();
+	v.resize(120, 7);
+	ref.resize(120, 7);
+	check("pop_back() / resize()", same_content(v, ref));
+	v[3] = 33;
+	ref[3] = 33;
+	check("operator[]", same_content(v, ref));
+	check("at()", v.at(119), 7);
+	check("front() / back()", v.front() == ref.front() && v.back() == ref.back());
+
+	std::string words[] = {"copy", "on", "write"};
+	ft::cow_vector<std::string> s(words, words + 3);
+	check("range constructor", s.size() == 3 && s[2] == "write");
+	ft::cow_vector<std::string> filled((size_t)4, "x");
+	filled.assign(2, "y");
+	check("assign()", filled.size() == 2 && filled[1] == "y");
+	v.clear();
+	check("clear()", v.empty());
+}
+
+static void sharing(void)
+{
+	print_header("Sharing");
+	int_vector v((size_t)1000, 1);
+	const int_vector copy(v);
+	check("copy shares the buffer", copy.data() == v.data() && v.use_count() == 2);
+	const int_vector &read = v;
+	int sum = 0;
+	for (int_vector::const_iterator it = read.begin(); it != read.end(); ++it)
+		sum += *it;
+	check("const access does not detach", sum == 1000 && read.data() == copy.data());
+
+	v[0] = 2;
+	check("write detaches", v.data() != copy.data());
+	check("copy keeps its value", copy[0], 1);
+	check("both are unique again", v.use_count() == 1 && copy.use_count() == 1);
+
+	int_vector assigned;
+	assigned = copy;
+	check("assignment shares", assigned.data() == copy.data() && copy.use_count() == 2);
+	assigned.push_back(3);
+	check("push_back detaches", assigned.size() == 1001 && copy.size() == 1000);
+	int_vector other(copy);
+	other.clear();
+	check("clear() leaves the buffer", other.empty() && copy.size() == 1000 && copy.use_count() == 1);
+	int_vector third(copy);
+	third.pop_back();
+	check("pop_back() detaches", third.size() == 999 && copy.size() == 1000);
+	check("copy == original", int_vector(copy) == copy);
+}
+
+#define THREADS 4
+
+struct Stage
+{
+	int_vector input;
+	long sum;
+};
+
+static void *read_stage(void *arg)
+{
+	Stage *s = static_cast<Stage *>(arg);
+	const int_vector &in = s->input;
+	s->sum = 0;
+	for (size_t i = 0; i < in.size(); i++)
+		s->sum += in[i];
+	int_vector local(s->input);
+	local[0] = 0;
+	s->sum -= local[0];
+	s->input = int_vector();
+	return (NULL);
+}
+
+static void threads(void)
+{
+	print_header("Threads");
+	int_vector v;
+	for (int i = 0; i < 10000; i++)
+		v.push_back(i);
+	pthread_t threads[THREADS];
+	Stage stages[THREADS];
+	for (int i = 0; i < THREADS; i++)
+	{
+		stages[i].input = v;
+		pthread_create(&threads[i], NULL, read_stage, &stages[i]);
+	}
+	v = int_vector();
+	bool good = true;
+	for (int i = 0; i < THREADS; i++)
+	{
+		pthread_join(threads[i], NULL);
+		good = good && stages[i].sum == 10000L * 9999 / 2;
+	}
+	check("copies shared across threads", good);
+}
+
+void test_cow_vector(void)
+{
+	print_header("Copy-on-write vector");
+
+	basics();
+	sharing();
+	threads();
+}
@@ -0,0 +1,76 @@
+#include "./tests.hpp"
+#include <cstring>
+#include <string>
+#include "../includes/huge_page_allocator.hpp"
+
+#define HUGE_PAGE ft::huge_page_allocator<long>::huge_page_size
+
+static bool aligned(const void *p)
+{
+	return (reinterpret_cast<size_t>(p) % HUGE_PAGE == 0);
+}
+
+static void allocator(void)
+{
+	print_header("Allocator");
+	ft::huge_page_allocator<long> alloc;
+	long *small = alloc.allocate(16);
+	small[15] = 15;
+	check("small allocation", small[15] == 15 && !alloc.mapped(16));
+	alloc.deallocate(small, 16);
+
+	size_t n = HUGE_PAGE / sizeof(long) + 1;
+	long *big = alloc.allocate(n);
+	for (size_t i = 0; i < n; i++)
+		big[i] = (long)i;
+	check("large allocation is 2 MiB aligned", alloc.mapped(n) && aligned(big));
+
+	size_t grown_n = n * 8;
+	long *grown = alloc.reallocate(big, n, grown_n);
+	bool same = grown != NULL;
+	for (size_t i = 0; same && i < n; i++)
+		same = grown[i] == (long)i;
+	grown[grown_n - 1] = -1;
+	check("reallocate() keeps the content", same && aligned(grown));
+	check("reallocate() of a small buffer", alloc.reallocate(small, 16, grown_n) == NULL);
+	alloc.deallocate(grown, grown_n);
+
+	ft::huge_page_allocator<std::string> rebound = ft::huge_page_allocator<long>::rebind<std::string>::other(alloc);
+	check("rebind / operator==", rebound == ft::huge_page_allocator<std::string>() && !(alloc != alloc));
+	check("max_size()", alloc.max_size() > 0 && alloc.max_size() < (size_t)-1 / sizeof(long));
+}
+
+static void vectors(void)
+{
+	print_header("Vector");
+	ft::vector<long, ft::huge_page_allocator<long> > v;
+	size_t n = 4 * HUGE_PAGE / sizeof(long);
+	for (size_t i = 0; i < n; i++)
+		v.push_back((long)(i * 3));
+	bool same = true;
+	for (size_t i = 0; i < n; i++)
+		same = same && v[i] == (long)(i * 3);
+	check("push_back() across huge pages", same && v.size() == n);
+	check("buffer is 2 MiB aligned", aligned(&v[0]));
+	v.resize(n * 3, 5);
+	check("resize()", v.size() == n * 3 && v[n - 1] == (long)((n - 1) * 3) && v[n * 3 - 1] == 5);
+	ft::vector<long, ft::huge_page_allocator<long> > copy(v);
+	check("copy", copy.size() == v.size() && copy[n] == 5 && copy[7] == 21);
+
+	ft::vector<std::string, ft::huge_page_allocator<std::string> > strings;
+	size_t count = HUGE_PAGE / sizeof(std::string) * 2;
+	for (size_t i = 0; i < count; i++)
+		strings.push_back(std::string(i % 40, 'a'));
+	same = true;
+	for (size_t i = 0; i < count; i++)
+		same = same && strings[i].size() == i % 40;
+	check("non relocatable elements are copied", same);
+}
+
+void test_huge_page_allocator(void)
+{
+	print_header("Huge page allocator");
+
+	allocator();
+	vectors();
+}
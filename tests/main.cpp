@@ -14,10 +14,52 @@ int main(int argc, char **argv)
 		test_vector();
 	else if (choice == "map")
 		test_map();
+	else if (choice == "spsc_ring")
+		test_spsc_ring();
+	else if (choice == "sharded_map")
+		test_sharded_map();
+	else if (choice == "unordered_map")
+		test_unordered_map();
+	else if (choice == "sort")
+		test_sort();
+	else if (choice == "scan")
+		test_scan();
+	else if (choice == "persistent_map")
+		test_persistent_map();
+	else if (choice == "cow_vector")
+		test_cow_vector();
+	else if (choice == "mapped_vector")
+		test_mapped_vector();
+	else if (choice == "serialize")
+		test_serialize();
+	else if (choice == "mapped_map_view")
+		test_mapped_map_view();
+	else if (choice == "huge_page_allocator")
+		test_huge_page_allocator();
+	else if (choice == "set_operations")
+		test_set_operations();
+	else if (choice == "parallel_map")
+		test_parallel_map();
+	else if (choice == "compact_map")
+		test_compact_map();
 	else if (choice == "all")
 	{
 		test_vector();
 		test_map();
+		test_spsc_ring();
+		test_sharded_map();
+		test_unordered_map();
+		test_sort();
+		test_scan();
+		test_persistent_map();
+		test_cow_vector();
+		test_mapped_vector();
+		test_serialize();
+		test_mapped_map_view();
+		test_huge_page_allocator();
+		test_set_operations();
+		test_parallel_map();
+		test_compact_map();
 	}
 	else
 		std::cout << "No test for " << choice << std::endl;
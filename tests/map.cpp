@@ -15,7 +15,583 @@ static void print_map(T &map)
     std::cout << " --- " << std::endl;
 }
 
+static void insert(void)
+{
+    print_header("Insert");
+    ft::map<int, std::string> m1;
+    std::map<int, std::string> m2;
+    int keys[] = {42, 21, 84, 10, 30, 63, 99, 1, 50};
+    for (size_t i = 0; i < sizeof(keys) / sizeof(*keys); i++)
+    {
+        m1.insert(ft::make_pair(keys[i], std::string("v")));
+        m2.insert(std::make_pair(keys[i], std::string("v")));
+    }
+    check("m1 == m2", m1 == m2);
+    check("insert duplicate fails", !m1.insert(ft::make_pair(42, std::string("x"))).second);
+    check("duplicate keeps value", m1[42], std::string("v"));
+    m1[7] = "seven";
+    m2[7] = "seven";
+    check("operator[] inserts", m1 == m2);
+    check("m1.size() == m2.size()", m1.size(), m2.size());
+    print_map(m1);
+}
+
+/**
+ * @brief Mapped type counting its default constructions.
+ */
+struct DefaultCounted
+{
+    static size_t constructions;
+    int value;
+
+    DefaultCounted() : value(0) { constructions++; }
+    explicit DefaultCounted(int v) : value(v) {}
+};
+
+size_t DefaultCounted::constructions = 0;
+
+/**
+ * @brief Mapped type with no default constructor.
+ */
+struct NoDefault
+{
+    int value;
+
+    explicit NoDefault(int v) : value(v) {}
+};
+
+struct CountVisits
+{
+    size_t visits;
+
+    CountVisits() : visits(0) {}
+    bool operator()(const ft::pair<const int, DefaultCounted> &) { return ++visits != 0; }
+};
+
+static void find(void)
+{
+    print_header("Find / Count / Bounds");
+    ft::map<int, int> m1;
+    std::map<int, int> m2;
+    for (int i = 0; i < 100; i += 10)
+    {
+        m1[i] = i * 2;
+        m2[i] = i * 2;
+    }
+    check("find(30)->second", m1.find(30)->second, m2.find(30)->second);
+    check("find(31) == end()", m1.find(31) == m1.end());
+    check("count(40) == 1", m1.count(40), (size_t)1);
+    check("count(41) == 0", m1.count(41), (size_t)0);
+    check("lower_bound(35)", m1.lower_bound(35)->first, m2.lower_bound(35)->first);
+    check("lower_bound(40)", m1.lower_bound(40)->first, m2.lower_bound(40)->first);
+    check("upper_bound(40)", m1.upper_bound(40)->first, m2.upper_bound(40)->first);
+    check("upper_bound(90) == end()", m1.upper_bound(90) == m1.end());
+    check("equal_range(50)", m1.equal_range(50).first->first, m2.equal_range(50).first->first);
+    const ft::map<int, int> &c1 = m1;
+    check("const find(20)->second", c1.find(20)->second, 40);
+
+    ft::map<int, DefaultCounted> m3;
+    for (int i = 0; i < 100; i++)
+        m3.insert(ft::make_pair(i, DefaultCounted(i)));
+    DefaultCounted::constructions = 0;
+    ft::map<int, DefaultCounted> right;
+    size_t found = 0;
+    for (int i = 0; i < 100; i++)
+        found += m3.count(i) + (m3.find(i) != m3.end()) + (m3.lower_bound(i) != m3.upper_bound(i));
+    m3.erase(50);
+    m3.split_off(80, right);
+    m3.for_each(10, 20, CountVisits());
+    check("lookups build no mapped_type", found == 300 && DefaultCounted::constructions == 0);
+}
+
+static void iterators(void)
+{
+    print_header("Iterators");
+    ft::map<int, int> m1;
+    std::map<int, int> m2;
+    int keys[] = {5, 3, 8, 1, 4, 7, 9, 2, 6};
+    for (size_t i = 0; i < sizeof(keys) / sizeof(*keys); i++)
+    {
+        m1[keys[i]] = i;
+        m2[keys[i]] = i;
+    }
+    bool same = true;
+    ft::map<int, int>::reverse_iterator rit = m1.rbegin();
+    for (std::map<int, int>::reverse_iterator std_it = m2.rbegin(); std_it != m2.rend(); ++std_it, ++rit)
+        same = same && rit->first == std_it->first;
+    check("reverse iteration", same && rit == m1.rend());
+    ft::map<int, int>::iterator it = m1.end();
+    --it;
+    check("--end() is the highest key", it->first, 9);
+}
+
+static void erase(void)
+{
+    print_header("Erase / Clear");
+    ft::map<int, int> m1;
+    std::map<int, int> m2;
+    int keys[] = {50, 25, 75, 12, 37, 62, 87, 6, 18, 31, 43};
+    for (size_t i = 0; i < sizeof(keys) / sizeof(*keys); i++)
+    {
+        m1[keys[i]] = i;
+        m2[keys[i]] = i;
+    }
+    check("erase(leaf)", m1.erase(6), m2.erase(6));
+    check("erase(one child)", m1.erase(12), m2.erase(12));
+    check("erase(two children)", m1.erase(25), m2.erase(25));
+    check("erase(root)", m1.erase(50), m2.erase(50));
+    check("erase(missing)", m1.erase(1000), m2.erase(1000));
+    check("m1 == m2", m1 == m2);
+    m1.erase(m1.begin());
+    m2.erase(m2.begin());
+    check("erase(begin())", m1 == m2);
+    m1.erase(m1.find(37), m1.find(75));
+    m2.erase(m2.find(37), m2.find(75));
+    check("erase(first, last)", m1 == m2);
+
+    ft::map<int, int> big;
+    std::map<int, int> ref;
+    for (int i = 0; i < 5000; i++)
+    {
+        big[(i * 7919) % 5000] = i;
+        ref[(i * 7919) % 5000] = i;
+    }
+    ft::map<int, int>::iterator before = big.find(999);
+    ft::map<int, int>::iterator after = big.find(4000);
+    big.erase(big.find(1000), after);
+    ref.erase(ref.find(1000), ref.find(4000));
+    check("erase(long range)", big == ref && big.size() == 2000);
+    check("iterators around the range", (++before)->first == 4000 && (--after)->first == 999);
+    big.erase(big.find(4990), big.end());
+    ref.erase(ref.find(4990), ref.end());
+    check("erase(range, end())", big == ref && (--big.end())->first == 4989);
+    big.erase(big.begin(), big.find(500));
+    ref.erase(ref.begin(), ref.find(500));
+    big[10000] = 1;
+    ref[10000] = 1;
+    check("insert after erase(begin(), range)", big == ref);
+    big.erase(big.begin(), big.end());
+    check("erase(begin(), end())", big.empty() && big.begin() == big.end());
+
+    m1.clear();
+    m2.clear();
+    check("clear()", m1 == m2);
+    check("empty()", m1.empty());
+}
+
+static void copy_swap(void)
+{
+    print_header("Copy / Swap");
+    ft::map<std::string, int> m1;
+    m1["one"] = 1;
+    m1["two"] = 2;
+    m1["three"] = 3;
+    ft::map<std::string, int> m2(m1);
+    check("copy == original", m1 == m2);
+    m2["four"] = 4;
+    check("copy is independent", m1 != m2);
+    ft::map<std::string, int> m3;
+    m3 = m2;
+    check("assignment", m3 == m2);
+    m1.swap(m3);
+    check("swap", m1.size() == 4 && m3.size() == 3);
+    check("m1 < m3", m1 < m3);
+    ft::map<std::string, int> m4(m1.begin(), m1.end());
+    check("range constructor", m4 == m1);
+}
+
+struct map_allocations;
+typedef AllocationCounter<count_objects, map_allocations> map_counter;
+
+static void empty_maps(void)
+{
+    print_header("Empty maps");
+    typedef ft::map<int, int, std::less<int>, CountingAllocator<ft::pair<const int, int>, map_counter> > counted_map;
+    size_t allocations = map_counter::allocated;
+    {
+        counted_map a;
+        counted_map b(a);
+        a.swap(b);
+        b = a;
+        check("empty map size", a.empty() && a.begin() == a.end() && a.find(1) == a.end());
+    }
+    check("empty maps allocate nothing", map_counter::allocated == allocations);
+
+    counted_map full;
+    for (int i = 0; i < 100; i++)
+        full[i] = i;
+    counted_map empty;
+    counted_map::iterator it = full.find(90);
+    full.swap(empty);
+    int walked = 0;
+    for (; it != empty.end(); ++it)
+        walked++;
+    check("iterators follow swap()", walked == 10 && full.empty() && full.begin() == full.end());
+    check("--end() after swap()", (--empty.end())->first == 99 && empty.validate() == NULL);
+    empty.swap(full);
+    check("swap() back", full.size() == 100 && full.begin()->first == 0 && full.validate() == NULL);
+
+    ft::map<int, NoDefault> plain;
+    ft::map<int, NoDefault> other;
+    for (int i = 0; i < 10; i++)
+        plain.insert(ft::make_pair(i, NoDefault(i * 2)));
+    plain.erase(3);
+    plain.swap(other);
+    check("mapped type without T()", plain.empty() && other.size() == 9 && other.find(4)->second.value == 8 &&
+                                          other.find(3) == other.end());
+    check("header holds no value", sizeof(ft::map<int, std::string>) == sizeof(ft::map<int, int>));
+}
+
+static void node_handles(void)
+{
+    print_header("Extract / Merge");
+    typedef ft::map<int, std::string, std::less<int>, CountingAllocator<ft::pair<const int, std::string>, map_counter> > counted_map;
+    counted_map active;
+    counted_map expired;
+    counted_map other;
+    for (int i = 0; i < 100; i++)
+        active[(i * 37) % 100] = std::string(i % 20, 'x');
+    expired[0] = "kept";
+    other[5] = "dup";
+    other[1000] = "new";
+    other[1001] = "new";
+    size_t allocations = map_counter::allocated;
+    const std::string *address = &active.find(42)->second;
+
+    counted_map::node_type nh = active.extract(42);
+    check("extract(key)", !nh.empty() && nh.key() == 42 && active.size() == 99 && active.count(42) == 0);
+    check("extract(missing key) is empty", active.extract(1000).empty());
+    counted_map::insert_return_type res = expired.insert(nh);
+    check("insert(node) links the node", res.inserted && nh.empty() && &res.position->second == address);
+    res = expired.insert(active.extract(active.begin()));
+    check("insert(duplicate) hands it back", !res.inserted && res.node.key() == 0 && res.position->second == "kept");
+    res.node.mapped() = "changed";
+    check("insert(node) back", active.insert(res.node).inserted && active.find(0)->second == "changed");
+
+    active.merge(other);
+    check("merge() moves missing keys", active.size() == 101 && active.find(1001)->second == "new");
+    check("merge() leaves duplicates", other.size() == 1 && other.begin()->second == "dup");
+    std::map<int, std::string> ref;
+    for (counted_map::iterator it = active.begin(); it != active.end(); ++it)
+        ref.insert(std::make_pair(it->first, it->second));
+    ref[0] = "kept";
+    ref[42] = std::string(6, 'x');
+    while (!active.empty())
+        expired.insert(active.extract(active.begin()->first));
+    bool same = expired.size() == ref.size();
+    for (std::map<int, std::string>::iterator it = ref.begin(); it != ref.end(); ++it)
+        same = same && expired.find(it->first) != expired.end() && expired.find(it->first)->second == it->second;
+    check("extract every key", same && active.empty());
+    check("no node allocated", map_counter::allocated - allocations, (size_t)0);
+    {
+        counted_map::node_type dropped = expired.extract(7);
+    }
+    check("dropped handle frees its node", expired.count(7), (size_t)0);
+}
+
+static void split_append(void)
+{
+    print_header("Split / Append");
+    ft::map<int, std::string> left;
+    std::map<int, std::string> ref;
+    for (int i = 0; i < 5000; i++)
+    {
+        left[i * 2] = std::string(i % 10, 'k');
+        ref[i * 2] = std::string(i % 10, 'k');
+    }
+    const std::string *address = &left.find(6000)->second;
+    ft::map<int, std::string> right;
+    right[-1] = "replaced";
+    left.split_off(5001, right);
+    std::map<int, std::string> ref_left(ref.begin(), ref.lower_bound(5001));
+    std::map<int, std::string> ref_right(ref.lower_bound(5001), ref.end());
+    check("split_off() left part", left == ref_left && left.size() == 2501);
+    check("split_off() right part", right == ref_right && right.size() == 2499);
+    check("split_off() keeps nodes", &right.find(6000)->second == address);
+    check("--end() after split_off()", (--left.end())->first == 5000 && right.begin()->first == 5002);
+
+    ft::map<int, std::string> none;
+    right.split_off(0, none);
+    check("split_off() below every key", right.empty() && none == ref_right);
+    none.split_off(1000000, right);
+    check("split_off() above every key", right.empty() && none == ref_right);
+
+    left.append(none);
+    check("append() after", left == ref && none.empty());
+    ft::map<int, std::string> low;
+    low[-10] = "low";
+    low.append(left);
+    ref[-10] = "low";
+    check("append() before", low == ref && left.empty());
+    left[3] = "overlap";
+    bool thrown = false;
+    try
+    {
+        low.append(left);
+    }
+    catch (std::invalid_argument &)
+    {
+        thrown = true;
+    }
+    check("append() overlapping keys throws", thrown && low.size() == ref.size() && left.size() == 1);
+    low.insert(ft::make_pair(3, std::string("overlap")));
+    low.erase(-10);
+    ref[3] = "overlap";
+    ref.erase(-10);
+    check("insert / erase after append()", low == ref);
+}
+
+struct RangeSum
+{
+    long sum;
+    size_t visited;
+    size_t limit;
+    int last_key;
+    bool ordered;
+
+    RangeSum(size_t limit) : sum(0), visited(0), limit(limit), last_key(-1), ordered(true) {}
+
+    bool operator()(const ft::pair<const int, long> &value)
+    {
+        if (value.first <= last_key)
+            ordered = false;
+        last_key = value.first;
+        sum += value.second;
+        return (++visited < limit);
+    }
+};
+
+struct BatchSum
+{
+    long sum;
+    size_t batches;
+    size_t largest;
+    size_t limit;
+
+    BatchSum(size_t limit) : sum(0), batches(0), largest(0), limit(limit) {}
+
+    bool operator()(const ft::pair<const int, long> *const *values, size_t n)
+    {
+        for (size_t i = 0; i < n; i++)
+            sum += values[i]->second;
+        batches++;
+        largest = n > largest ? n : largest;
+        return (batches < limit);
+    }
+};
+
+struct Doubler
+{
+    bool operator()(ft::pair<const int, long> &value)
+    {
+        value.second *= 2;
+        return (true);
+    }
+};
+
+static void visitors(void)
+{
+    print_header("For each");
+    ft::map<int, long> m;
+    std::map<int, long> ref;
+    for (int i = 0; i < 5000; i++)
+    {
+        m[(i * 7919) % 5000 * 2] = i;
+        ref[(i * 7919) % 5000 * 2] = i;
+    }
+    long expected = 0;
+    for (std::map<int, long>::iterator it = ref.lower_bound(1001); it != ref.lower_bound(7000); ++it)
+        expected += it->second;
+
+    const ft::map<int, long> &cm = m;
+    RangeSum all = cm.for_each(1001, 7000, RangeSum(100000));
+    check("for_each() in key order", all.ordered && all.sum == expected && all.visited == 2999);
+    RangeSum stopped = m.for_each(0, 10000, RangeSum(10));
+    check("for_each() stops early", stopped.visited == 10 && stopped.last_key == 18);
+    check("for_each() empty range", m.for_each(7000, 1001, RangeSum(100000)).visited, (size_t)0);
+    check("for_each() past both ends", m.for_each(-50, 20000, RangeSum(100000)).visited, (size_t)5000);
+
+    BatchSum batched = cm.for_each_batch(1001, 7000, BatchSum(1000));
+    check("for_each_batch()", batched.sum == expected && batched.batches == 47 && batched.largest == 64);
+    BatchSum first = m.for_each_batch(0, 10000, BatchSum(2));
+    check("for_each_batch() stops early", first.batches == 2 && first.sum != 0);
+    check("for_each_batch() empty range", m.for_each_batch(5, 6, BatchSum(1)).batches, (size_t)0);
+
+    m.for_each(0, 100, Doubler());
+    check("for_each() writes values", m[98] == 2 * ref[98] && m[100] == ref[100]);
+}
+
+template <class Map>
+static bool same_content(const Map &m, const std::map<int, std::string> &ref)
+{
+    if (m.size() != ref.size())
+        return (false);
+    typename Map::const_iterator it = m.begin();
+    for (std::map<int, std::string>::const_iterator r = ref.begin(); r != ref.end(); ++r, ++it)
+        if (it->first != r->first || it->second != r->second)
+            return (false);
+    return (true);
+}
+
+template <class Layout>
+static bool layout_round_trip(void)
+{
+    typedef ft::map<int, std::string, std::less<int>, std::allocator<ft::pair<const int, std::string> >, Layout> layout_map;
+    layout_map m;
+    std::map<int, std::string> ref;
+    for (int i = 0; i < 2000; i++)
+    {
+        int key = (i * 7919) % 2000;
+        m[key] = std::string(i % 30, 'a' + i % 26);
+        ref[key] = std::string(i % 30, 'a' + i % 26);
+    }
+    bool ok = same_content(m, ref) && m.find(1234)->second == ref[1234] && m.count(2000) == 0;
+    for (int i = 0; i < 2000; i += 3)
+    {
+        m.erase(i);
+        ref.erase(i);
+    }
+    m.erase(m.lower_bound(100), m.lower_bound(1500));
+    ref.erase(ref.lower_bound(100), ref.lower_bound(1500));
+    ok = ok && same_content(m, ref);
+
+    layout_map copy(m);
+    layout_map right;
+    copy.split_off(1700, right);
+    typename layout_map::node_type nh = right.extract(right.begin());
+    copy.insert(nh);
+    copy.append(right);
+    ok = ok && same_content(copy, ref) && copy.nth(3)->first == m.nth(3)->first;
+    copy.clear();
+    return (ok && copy.empty() && same_content(m, ref));
+}
+
+static void layouts(void)
+{
+    print_header("Node layouts");
+    check("inline_node_layout", layout_round_trip<ft::inline_node_layout>());
+    check("packed_node_layout", layout_round_trip<ft::packed_node_layout>());
+    check("split_node_layout", layout_round_trip<ft::split_node_layout>());
+    check("packed node is smaller", sizeof(ft::packed_tree_node<ft::pair<const int, long> >) <
+                                        sizeof(TREE_Node<ft::pair<const int, long> >));
+    typedef ft::pair<const int, std::string> string_pair;
+    check("split node holds no mapped value",
+          sizeof(ft::split_tree_node<string_pair>) <= 5 * sizeof(void *) + sizeof(int) + sizeof(size_t));
+
+    typedef CountingAllocator<string_pair, map_counter> counted_allocator;
+    typedef ft::map<int, std::string, std::less<int>, counted_allocator, ft::split_node_layout> split_map;
+    size_t live = 0;
+    bool values_counted;
+    {
+        counted_allocator alloc(&live);
+        split_map m(std::less<int>(), alloc);
+        for (int i = 0; i < 100; i++)
+            m[i] = "value";
+        m.erase(7);
+        values_counted = live == 2 * 99;
+    }
+    check("split values use the map's allocator", values_counted && live == 0);
+}
+
+static void diagnostics(void)
+{
+    print_header("Diagnostics");
+    ft::map<int, int> m;
+    for (int i = 0; i < 1 << 16; i++)
+        m[i] = i;
+    ft::tree_shape shape = m.shape();
+    size_t histogram_total = 0;
+    for (size_t d = 0; d < shape.depth_histogram.size(); d++)
+        histogram_total += shape.depth_histogram[d];
+    check("validate() after sorted inserts", m.validate() == NULL);
+    check("shape() height", shape.height <= 2 * 17 && shape.height == shape.max_depth + 1);
+    check("shape() depth histogram", histogram_total == m.size() && shape.depth_histogram[0] == 1);
+    check("shape() average depth", shape.average_depth() > 14 && shape.average_depth() < shape.height);
+    check("shape() empty", ft::map<int, int>().shape().height == 0);
+
+    ft::tree_counters counters;
+    m.set_counters(&counters);
+    for (int i = 0; i < 1000; i++)
+        m.find(i * 61);
+    for (int i = 0; i < 1000; i++)
+        m.insert(ft::make_pair(-i - 1, i));
+    for (int i = 0; i < 500; i++)
+        m.erase(i);
+    m.set_counters(NULL);
+    m.find(0);
+    check("counters finds", counters.finds == 1000 && counters.comparisons_per_find() >= 1 &&
+                                counters.comparisons_per_find() <= 2 * shape.height);
+    check("counters inserts", counters.inserts == 1000 && counters.allocations == 1000 && counters.rotations > 0);
+    check("counters erases", counters.erases == 500 && counters.deallocations == 500);
+    counters.reset();
+    check("counters reset()", counters.finds == 0 && counters.comparisons_per_insert() == 0);
+
+    m.erase(m.lower_bound(1000), m.lower_bound(40000));
+    ft::map<int, int> right;
+    m.split_off(50000, right);
+    check("validate() after split and erase", m.validate() == NULL && right.validate() == NULL);
+
+    TREE_Node<ft::pair<const int, int> > *root = m.begin()._node;
+    while (root->parent() != m.end()._node)
+        root = root->parent();
+    root->set_red(true);
+    check("validate() red root", std::string(m.validate() ? m.validate() : "") == "red root");
+    root->set_red(false);
+    TREE_Node<ft::pair<const int, int> > *leaf = root;
+    while (leaf->left != NULL)
+        leaf = leaf->left;
+    bool red = leaf->red();
+    leaf->set_red(!red);
+    check("validate() broken balance", m.validate() != NULL);
+    leaf->set_red(red);
+    check("validate() restored", m.validate() == NULL);
+}
+
+struct map_stats_tag
+{
+};
+
+static void stats_policy(void)
+{
+    print_header("Stats policy");
+    typedef ft::atomic_stats<map_stats_tag> stats;
+    typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::inline_node_layout, stats>
+        counted_map;
+
+    counted_map m;
+    for (int i = 0; i < 1023; i++)
+        m[i] = i;
+    ft::tree_counters counters;
+    m.set_counters(&counters);
+    stats::reset();
+    for (int i = 0; i < 1000; i++)
+        m.find(i);
+    check("node visits on find()", stats::counts().node_visits >= 1000 && stats::counts().node_visits <= 1000 * 20 &&
+                                       stats::counts().node_visits * 2 >= counters.find_comparisons);
+    stats::reset();
+    m.insert(ft::make_pair(5000, 1));
+    check("node visits on insert()", stats::counts().node_visits >= 10 && stats::counts().node_visits <= 20);
+    stats::reset();
+    counted_map().find(1);
+    check("empty tree visits nothing", stats::counts().node_visits == 0);
+    check("null_stats adds no state", sizeof(ft::map<int, int>) == sizeof(counted_map));
+    m.set_counters(NULL);
+}
+
 void test_map(void)
 {
     print_header("Map");
-}
\ No newline at end of file
+
+    insert();
+    find();
+    iterators();
+    erase();
+    copy_swap();
+    empty_maps();
+    node_handles();
+    split_append();
+    visitors();
+    layouts();
+    diagnostics();
+    stats_policy();
+}
@@ -0,0 +1,121 @@
+#include "./tests.hpp"
+#include <cstdio>
+#include <sstream>
+#include <unistd.h>
+#include "../includes/mapped_map_view.hpp"
+
+typedef ft::mapped_map_view<int, std::string> string_view_map;
+
+static std::string temp_path(std::string name)
+{
+	std::ostringstream path;
+	path << "/tmp/ft_" << name << "_" << getpid();
+	return (path.str());
+}
+
+static void lookups(void)
+{
+	print_header("Lookups");
+	std::string path = temp_path("map_image");
+	ft::map<int, std::string> m;
+	std::map<int, std::string> ref;
+	for (int i = 0; i < 3000; i++)
+	{
+		int key = (i * 7919) % 3000 * 2;
+		std::string val(i % 17, 'a' + i % 26);
+		m.insert(ft::make_pair(key, val));
+		ref.insert(std::make_pair(key, val));
+	}
+	ft::write_map_image(path, m);
+	string_view_map view(path);
+	check("size()", view.size(), (size_t)3000);
+
+	bool same = true;
+	std::map<int, std::string>::const_iterator r = ref.begin();
+	for (string_view_map::iterator it = view.begin(); it != view.end(); ++it, ++r)
+		if (it->first != r->first || it->second != r->second)
+			same = false;
+	check("iteration matches std::map", same && r == ref.end());
+	check("find() hit", view.find(1000) != view.end() && view.find(1000).value() == ref[1000]);
+	check("find() miss", view.find(1001) == view.end() && view.count(-2) == 0);
+	check("lower_bound()", view.lower_bound(1001).key(), ref.lower_bound(1001)->first);
+	check("upper_bound()", view.upper_bound(1000).key(), ref.upper_bound(1000)->first);
+	check("lower_bound() past the end", view.lower_bound(6000) == view.end());
+	check("at()", view.at(0) == ref[0]);
+	bool thrown = false;
+	try
+	{
+		view.at(7);
+	}
+	catch (std::out_of_range &)
+	{
+		thrown = true;
+	}
+	check("at() throws", thrown);
+	size_t in_range = 0;
+	for (string_view_map::iterator it = view.lower_bound(100); it != view.upper_bound(200); ++it)
+		in_range++;
+	check("range [100, 200]", in_range, (size_t)51);
+	check("random access", (view.end() - view.begin()) == 3000 && (view.begin() + 5)->first == 10);
+
+	ft::write_map_image(path, ft::map<int, std::string>());
+	check("old view survives a rewrite", view.at(0) == ref[0]);
+	view.open(path);
+	check("empty image", view.empty() && view.begin() == view.end() && view.find(0) == view.end());
+	std::remove(path.c_str());
+}
+
+static void fixed_values(void)
+{
+	print_header("Fixed size values");
+	std::string path = temp_path("map_image_fixed");
+	ft::vector<ft::pair<long, double> > sorted;
+	for (long i = 0; i < 10000; i++)
+		sorted.push_back(ft::make_pair(i * 3, i * 0.5));
+	ft::write_map_image(path, sorted.begin(), sorted.end());
+	ft::mapped_map_view<long, double> view(path);
+	check("values read in place", view.at(2997) == 999 * 0.5 && &view.at(3) == &view.find(3)->second);
+	check("last key", (view.end() - 1)->first, 29997L);
+
+	bool thrown = false;
+	try
+	{
+		ft::mapped_map_view<int, double> wrong(path);
+	}
+	catch (std::runtime_error &)
+	{
+		thrown = true;
+	}
+	check("other key type is rejected", thrown);
+	thrown = false;
+	try
+	{
+		string_view_map wrong(path);
+	}
+	catch (std::runtime_error &)
+	{
+		thrown = true;
+	}
+	check("other value type is rejected", thrown);
+
+	sorted.push_back(ft::make_pair(0L, 0.0));
+	thrown = false;
+	try
+	{
+		ft::write_map_image(path, sorted.begin(), sorted.end());
+	}
+	catch (std::invalid_argument &)
+	{
+		thrown = true;
+	}
+	check("unsorted range is rejected", thrown && view.size() == 10000);
+	std::remove(path.c_str());
+}
+
+void test_mapped_map_view(void)
+{
+	print_header("Mapped map view");
+
+	lookups();
+	fixed_values();
+}
@@ -0,0 +1,145 @@
+#include "./tests.hpp"
+#include <cstdio>
+#include <sstream>
+#include <unistd.h>
+#include "../includes/mapped_vector.hpp"
+
+struct Record
+{
+	int id;
+	double weight;
+};
+
+static std::string temp_path(std::string name)
+{
+	std::ostringstream path;
+	path << "/tmp/ft_" << name << "_" << getpid();
+	return (path.str());
+}
+
+static void basics(void)
+{
+	print_header("Vector operations");
+	std::string path = temp_path("mapped_vector");
+	{
+		ft::mapped_vector<int> v(path, ft::mapped_file::create);
+		std::vector<int> ref;
+		check("empty()", v.empty() && v.is_open());
+		for (int i = 0; i < 5000; i++)
+		{
+			v.push_back(i);
+			ref.push_back(i);
+		}
+		check("push_back() grows the file", v.size() == 5000 && v.capacity() >= 5000);
+		v.insert(v.begin() + 10, -1);
+		ref.insert(ref.begin() + 10, -1);
+		v.insert(v.end(), 3, -2);
+		ref.insert(ref.end(), 3, -2);
+		int more[] = {7, 8, 9};
+		v.insert(v.begin(), more, more + 3);
+		ref.insert(ref.begin(), more, more + 3);
+		check("insert()", ft::equal(v.begin(), v.end(), ref.begin()) && v.size() == ref.size());
+		v.erase(v.begin() + 100, v.begin() + 200);
+		ref.erase(ref.begin() + 100, ref.begin() + 200);
+		v.erase(v.end() - 1);
+		ref.erase(ref.end() - 1);
+		check("erase()", ft::equal(v.begin(), v.end(), ref.begin()) && v.size() == ref.size());
+		v.resize(6000, 4);
+		ref.resize(6000, 4);
+		check("resize()", ft::equal(v.begin(), v.end(), ref.begin()) && v.size() == ref.size());
+		check("at()", v.at(5999), 4);
+		bool thrown = false;
+		try
+		{
+			v.at(6000);
+		}
+		catch (std::out_of_range &)
+		{
+			thrown = true;
+		}
+		check("at() throws", thrown);
+		check("back()", v.back(), ref.back());
+		v.sync();
+	}
+	{
+		ft::mapped_vector<int> v(path, ft::mapped_file::open_existing);
+		check("reopen keeps the size", v.size(), (size_t)6000);
+		check("reopen keeps the elements", v[3] == 0 && v[5999] == 4 && v.front() == 7);
+		v.assign(10, 1);
+		v.close();
+		check("close()", !v.is_open() && v.empty());
+		v.open(path, ft::mapped_file::open_existing);
+		check("close() records the size", v.size(), (size_t)10);
+	}
+	std::remove(path.c_str());
+}
+
+static void files(void)
+{
+	print_header("Files");
+	std::string path = temp_path("mapped_records");
+	{
+		ft::mapped_vector<Record> v(path);
+		for (int i = 0; i < 1000; i++)
+		{
+			Record r = {i, i * 0.5};
+			v.push_back(r);
+		}
+	}
+	{
+		ft::mapped_vector<Record> v(path);
+		check("destructor records the size", v.size(), (size_t)1000);
+		check("records survive", v[999].id == 999 && v[999].weight == 499.5);
+	}
+	bool thrown = false;
+	try
+	{
+		ft::mapped_vector<char> wrong(path, ft::mapped_file::open_existing);
+	}
+	catch (std::runtime_error &)
+	{
+		thrown = true;
+	}
+	check("other element size is rejected", thrown);
+	std::remove(path.c_str());
+
+	thrown = false;
+	try
+	{
+		ft::mapped_vector<int> missing(path, ft::mapped_file::open_existing);
+	}
+	catch (std::runtime_error &)
+	{
+		thrown = true;
+	}
+	check("missing file is rejected", thrown);
+
+	thrown = false;
+	ft::mapped_vector<int> unopened;
+	try
+	{
+		unopened.push_back(1);
+	}
+	catch (std::runtime_error &)
+	{
+		thrown = true;
+	}
+	check("growth needs a file", thrown && unopened.empty());
+
+	std::string other = temp_path("mapped_other");
+	ft::mapped_vector<int> a(path, ft::mapped_file::create);
+	ft::mapped_vector<int> b(other, ft::mapped_file::create);
+	a.push_back(1);
+	swap(a, b);
+	check("swap()", a.empty() && b.size() == 1 && b[0] == 1);
+	std::remove(path.c_str());
+	std::remove(other.c_str());
+}
+
+void test_mapped_vector(void)
+{
+	print_header("Mapped vector");
+
+	basics();
+	files();
+}
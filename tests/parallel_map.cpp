@@ -0,0 +1,208 @@
+#include "./tests.hpp"
+#include <cstdlib>
+#include <pthread.h>
+#include "../includes/atomic.hpp"
+
+#define PAIRS 200000
+
+typedef ft::map<int, long> long_map;
+
+static ft::atomic<long> g_node_budget;
+
+/**
+ * @brief std::allocator that throws std::length_error once g_node_budget is spent.
+ */
+template <typename T>
+struct BudgetAllocator : public std::allocator<T>
+{
+	template <typename U>
+	struct rebind
+	{
+		typedef BudgetAllocator<U> other;
+	};
+
+	BudgetAllocator() {}
+	BudgetAllocator(const BudgetAllocator &) : std::allocator<T>() {}
+	template <typename U>
+	BudgetAllocator(const BudgetAllocator<U> &) {}
+
+	T *allocate(size_t n, const void * = 0)
+	{
+		if (g_node_budget.fetch_sub(1) <= 0)
+			throw std::length_error("node budget spent");
+		return (std::allocator<T>::allocate(n));
+	}
+};
+
+static pthread_t g_main_thread;
+
+/**
+ * @brief std::less<int> that throws std::domain_error when a pool thread compares
+ * the key 3.
+ */
+struct ThrowOffMainThread
+{
+	bool operator()(int a, int b) const
+	{
+		if ((a == 3 || b == 3) && !pthread_equal(pthread_self(), g_main_thread))
+			throw std::domain_error("compared 3 on a pool thread");
+		return (a < b);
+	}
+};
+
+static void ranks(void)
+{
+	print_header("Ranks");
+	long_map m;
+	for (int i = 0; i < 1000; i++)
+		m.insert(ft::make_pair((i * 7919) % 1000 * 3, (long)i));
+	check("nth(0)", m.nth(0) == m.begin());
+	check("nth(size() - 1)", m.nth(999)->first, 2997);
+	check("nth(size())", m.nth(1000) == m.end());
+	bool same = true;
+	size_t rank = 0;
+	for (long_map::const_iterator it = m.begin(); it != m.end(); ++it, ++rank)
+		if (static_cast<const long_map &>(m).nth(rank) != it)
+			same = false;
+	check("nth() follows the key order", same);
+}
+
+static void build(void)
+{
+	print_header("Parallel build");
+	ft::vector<ft::pair<int, long> > pairs;
+	std::map<int, long> ref;
+	srand(42);
+	for (int i = 0; i < PAIRS; i++)
+	{
+		int key = rand() % (PAIRS * 2);
+		pairs.push_back(ft::make_pair(key, key * 3L));
+		ref.insert(std::make_pair(key, key * 3L));
+	}
+
+	ft::thread_pool pool(4);
+	long_map m;
+	m.insert(ft::make_pair(-1, -1L));
+	ft::parallel_build(pairs.begin(), pairs.end(), m, pool);
+	check("4 threads, duplicated keys", m == ref);
+	check("size()", m.size(), ref.size());
+	m.insert(ft::make_pair(-1, -1L));
+	m.erase(m.nth(m.size() / 2));
+	check("joined parts stay usable", m.size() == ref.size() && m.begin()->first == -1);
+
+	ft::thread_pool single(1);
+	long_map copy;
+	ft::parallel_build(m.begin(), m.end(), copy, single);
+	check("1 thread, from a map", copy == m);
+
+	ft::thread_pool three(3);
+	ft::parallel_build(pairs.begin(), pairs.begin() + 100, copy, three);
+	std::map<int, long> small;
+	for (int i = 0; i < 100; i++)
+		small.insert(std::make_pair(pairs[i].first, pairs[i].second));
+	check("small range", copy == small);
+	ft::parallel_build(pairs.end(), pairs.end(), copy, three);
+	check("empty range", copy.empty());
+
+	ft::map<int, long, std::greater<int> > down;
+	ft::parallel_build(pairs.begin(), pairs.end(), down, pool);
+	check("comparator", down.size() == ref.size() && down.begin()->first == ref.rbegin()->first);
+
+	g_node_budget.store(PAIRS / 4);
+	ft::map<int, long, std::less<int>, BudgetAllocator<ft::pair<const int, long> > > limited;
+	limited.insert(ft::make_pair(-1, -1L));
+	std::string what;
+	try
+	{
+		ft::parallel_build(pairs.begin(), pairs.end(), limited, pool);
+	}
+	catch (std::runtime_error &e)
+	{
+		what = e.what();
+	}
+	check("failure on a thread is reported", what == "node budget spent" && limited.size() == 1);
+
+	g_main_thread = pthread_self();
+	pairs.push_back(ft::make_pair(3, 9L));
+	ft::map<int, long, ThrowOffMainThread> throwing;
+	throwing.insert(ft::make_pair(-1, -1L));
+	what.clear();
+	try
+	{
+		ft::parallel_build(pairs.begin(), pairs.end(), throwing, pool);
+	}
+	catch (std::runtime_error &e)
+	{
+		what = e.what();
+	}
+	check("comparator failure in sort reported", what == "compared 3 on a pool thread" && throwing.size() == 1);
+}
+
+static void union_maps(void)
+{
+	print_header("Parallel union");
+	long_map target;
+	long_map source;
+	std::map<int, long> ref_target;
+	std::map<int, long> ref_source;
+	for (int i = 0; i < PAIRS; i++)
+	{
+		int key = (int)((i * 40503u) % PAIRS);
+		target.insert(ft::make_pair(key * 2, (long)i));
+		ref_target.insert(std::make_pair(key * 2, (long)i));
+		source.insert(ft::make_pair(key * 3, (long)-i));
+		ref_source.insert(std::make_pair(key * 3, (long)-i));
+	}
+	std::map<int, long> ref = ref_target;
+	std::map<int, long> ref_left;
+	for (std::map<int, long>::iterator it = ref_source.begin(); it != ref_source.end(); ++it)
+		if (!ref.insert(*it).second)
+			ref_left.insert(*it);
+
+	ft::thread_pool pool(4);
+	ft::parallel_union(target, source, pool);
+	check("4 threads, keeps values of target", target == ref);
+	check("shared keys stay in source", source == ref_left);
+	check("sizes", target.size() + source.size(), ref_target.size() + ref_source.size());
+
+	long_map empty;
+	ft::parallel_union(empty, target, pool);
+	check("into an empty map", empty == ref && target.empty());
+	long_map small;
+	small.insert(ft::make_pair(1, 1L));
+	ft::parallel_union(small, empty, pool);
+	check("into a small map", small.size() == ref.size() + 1 && empty.empty());
+	ft::parallel_union(small, small, pool);
+	check("with itself", small.size(), ref.size() + 1);
+
+	typedef ft::map<int, long, ThrowOffMainThread> throwing_map;
+	g_main_thread = pthread_self();
+	throwing_map evens;
+	throwing_map odds;
+	for (int i = 0; i < PAIRS; i++)
+	{
+		evens.insert(ft::make_pair(i * 2, (long)i));
+		odds.insert(ft::make_pair(i * 2 + 1, (long)i));
+	}
+	std::string what;
+	try
+	{
+		ft::parallel_union(evens, odds, pool);
+	}
+	catch (std::runtime_error &e)
+	{
+		what = e.what();
+	}
+	check("comparator failure is reported", what == "compared 3 on a pool thread");
+	check("no element lost", evens.size() + odds.size() == 2 * PAIRS && odds.count(3) == 1 &&
+									 evens.validate() == NULL && odds.validate() == NULL);
+}
+
+void test_parallel_map(void)
+{
+	print_header("Parallel map");
+
+	ranks();
+	build();
+	union_maps();
+}
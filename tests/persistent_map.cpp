@@ -0,0 +1,195 @@
+#include "./tests.hpp"
+#include <pthread.h>
+#include "../includes/persistent_map.hpp"
+
+typedef ft::persistent_map<int, int> int_map;
+
+/**
+ * @brief Nodes handed out and given back by the counted maps.
+ */
+struct persistent_map_nodes;
+typedef AllocationCounter<count_objects, persistent_map_nodes> node_counter;
+
+typedef ft::persistent_map<int, int, std::less<int>, CountingAllocator<ft::pair<const int, int>, node_counter> > counted_map;
+
+template <typename Map>
+static bool same_content(const Map &m, const std::map<int, int> &ref)
+{
+	if (m.size() != ref.size())
+		return (false);
+	typename Map::const_iterator it = m.begin();
+	for (std::map<int, int>::const_iterator r = ref.begin(); r != ref.end(); ++r, ++it)
+		if (it == m.end() || it->first != r->first || it->second != r->second)
+			return (false);
+	return (it == m.end());
+}
+
+static void basics(void)
+{
+	print_header("Find / Insert / Erase");
+	int_map m;
+	std::map<int, int> ref;
+	check("empty()", m.empty());
+	check("begin() == end()", m.begin() == m.end());
+	for (int i = 0; i < 1000; i++)
+	{
+		int key = (i * 7919) % 1000;
+		m.insert(ft::make_pair(key, i));
+		ref.insert(std::make_pair(key, i));
+	}
+	check("same content as std::map", same_content(m, ref));
+	check("insert duplicate fails", !m.insert(ft::make_pair(5, 0)));
+	check("insert_or_assign replaces", !m.insert_or_assign(ft::make_pair(5, -5)) && m.at(5) == -5);
+	ref[5] = -5;
+	check("find(5)", m.find(5) != m.end() && m.find(5)->second == -5);
+	check("find(1000) == end()", m.find(1000) == m.end());
+	check("count(999) == 1", m.count(999), (size_t)1);
+	bool thrown = false;
+	try
+	{
+		m.at(-1);
+	}
+	catch (std::out_of_range &)
+	{
+		thrown = true;
+	}
+	check("at(-1) throws", thrown);
+
+	for (int i = 0; i < 1000; i += 3)
+	{
+		m.erase(i);
+		ref.erase(i);
+	}
+	check("erase(0) == 0 after erase", m.erase(0), (size_t)0);
+	check("same content after erase", same_content(m, ref));
+	int_map::const_iterator it = m.find(500);
+	std::map<int, int>::const_iterator r = ref.find(500);
+	for (int i = 0; i < 10; i++)
+		++it, ++r;
+	check("iterate on from find()", it->first, r->first);
+	m.clear();
+	check("clear()", m.empty() && m.begin() == m.end());
+}
+
+static void snapshots(void)
+{
+	print_header("Snapshots");
+	int_map m;
+	std::map<int, int> ref;
+	for (int i = 0; i < 100; i++)
+	{
+		m.insert(ft::make_pair(i, i));
+		ref[i] = i;
+	}
+	int_map snapshot(m);
+	std::map<int, int> snapshot_ref(ref);
+	check("copy == original", snapshot == m);
+	m.insert_or_assign(ft::make_pair(50, -1));
+	m.erase(10);
+	m.insert(ft::make_pair(200, 200));
+	check("copy != updated original", snapshot != m);
+	check("copy keeps its content", same_content(snapshot, snapshot_ref));
+	snapshot.erase(20);
+	snapshot_ref.erase(20);
+	ref[50] = -1;
+	ref.erase(10);
+	ref[200] = 200;
+	check("original keeps its content", same_content(m, ref));
+	check("copy keeps its update", same_content(snapshot, snapshot_ref));
+
+	int_map assigned;
+	assigned = m;
+	m.clear();
+	check("assigned outlives the original", same_content(assigned, ref));
+	swap(assigned, snapshot);
+	check("swap()", same_content(assigned, snapshot_ref) && same_content(snapshot, ref));
+}
+
+static void sharing(void)
+{
+	print_header("Sharing");
+	{
+		counted_map m;
+		for (int i = 0; i < 4096; i++)
+			m.insert(ft::make_pair(i, i));
+		check("one node per element", node_counter::live, (size_t)4096);
+		size_t before = node_counter::allocated;
+		counted_map snapshot(m);
+		check("copy allocates nothing", node_counter::allocated, before);
+		m.insert_or_assign(ft::make_pair(1234, 0));
+		check("update copies the path only", node_counter::allocated - before <= 20);
+		before = node_counter::allocated;
+		m.erase(2048);
+		check("erase copies the path only", node_counter::allocated - before <= 40);
+		check("snapshot still has 2048", snapshot.count(2048), (size_t)1);
+		check("versions share the rest", node_counter::live < 4096 + 60);
+		snapshot.clear();
+		check("clear() frees the unshared nodes", node_counter::live, (size_t)4095);
+	}
+	check("every node is freed", node_counter::live, (size_t)0);
+}
+
+#define READERS 4
+#define VERSIONS 200
+
+struct Reader
+{
+	int_map version;
+	int expected;
+	bool good;
+};
+
+static void *read_version(void *arg)
+{
+	Reader *r = static_cast<Reader *>(arg);
+	r->good = true;
+	for (int round = 0; round < 20; round++)
+	{
+		int n = 0;
+		for (int_map::const_iterator it = r->version.begin(); it != r->version.end(); ++it, n++)
+			if (it->first != n)
+				r->good = false;
+		if (n != r->expected)
+			r->good = false;
+	}
+	r->version.clear();
+	return (NULL);
+}
+
+static void threads(void)
+{
+	print_header("Threads");
+	int_map m;
+	pthread_t threads[READERS];
+	Reader readers[READERS];
+	int started = 0;
+	for (int i = 0; i < VERSIONS; i++)
+	{
+		m.insert(ft::make_pair(i, i));
+		if (i % (VERSIONS / READERS) == 0)
+		{
+			readers[started].version = m;
+			readers[started].expected = i + 1;
+			pthread_create(&threads[started], NULL, read_version, &readers[started]);
+			started++;
+		}
+	}
+	m.clear();
+	bool good = true;
+	for (int i = 0; i < started; i++)
+	{
+		pthread_join(threads[i], NULL);
+		good = good && readers[i].good;
+	}
+	check("readers see their own version", good);
+}
+
+void test_persistent_map(void)
+{
+	print_header("Persistent map");
+
+	basics();
+	snapshots();
+	sharing();
+	threads();
+}
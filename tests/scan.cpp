@@ -0,0 +1,135 @@
+#include "./tests.hpp"
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <cstdlib>
+
+/**
+ * @brief Runs every scan on an ft::vector and on a std::vector holding the same data,
+ * for a few sizes around the vector widths and the min/max block size.
+ */
+template <typename T>
+static bool same_scans(T (*make)(size_t), T missing)
+{
+	size_t sizes[] = {0, 1, 7, 8, 33, 1023, 1024, 1025, 5000};
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); s++)
+	{
+		size_t n = sizes[s];
+		ft::vector<T> v;
+		std::vector<T> ref;
+		for (size_t i = 0; i < n; i++)
+		{
+			v.push_back(make(i));
+			ref.push_back(make(i));
+		}
+		if (ft::min_element(v.begin(), v.end()) - v.begin() != std::min_element(ref.begin(), ref.end()) - ref.begin())
+			return (false);
+		if (ft::max_element(v.begin(), v.end()) - v.begin() != std::max_element(ref.begin(), ref.end()) - ref.begin())
+			return (false);
+		if (ft::find(v.begin(), v.end(), missing) != v.end())
+			return (false);
+		for (size_t i = 0; i < n; i += 1 + n / 7)
+		{
+			if (ft::find(v.begin(), v.end(), ref[i]) - v.begin() != std::find(ref.begin(), ref.end(), ref[i]) - ref.begin())
+				return (false);
+			if (ft::count(v.begin(), v.end(), ref[i]) != std::count(ref.begin(), ref.end(), ref[i]))
+				return (false);
+		}
+		if (!(ft::accumulate(v.begin(), v.end(), T()) == std::accumulate(ref.begin(), ref.end(), T())))
+			return (false);
+	}
+	return (true);
+}
+
+static int make_int(size_t i)
+{
+	return (static_cast<int>((i * 2654435761u) % 2001) - 1000);
+}
+
+static unsigned long make_ulong(size_t i)
+{
+	return ((i * 0x9E3779B97F4A7C15UL) ^ (i % 3 ? 0 : 1UL << 63));
+}
+
+static unsigned long long make_ulonglong(size_t i)
+{
+	return (make_ulong(i));
+}
+
+static float make_float(size_t i)
+{
+	return (static_cast<float>(make_int(i)) / 8.0f);
+}
+
+static void kernels(void)
+{
+	print_header("Scans against std");
+	check("int", same_scans<int>(make_int, 5000));
+	check("unsigned long", same_scans<unsigned long>(make_ulong, 1));
+	check("unsigned long long", same_scans<unsigned long long>(make_ulonglong, 1));
+	check("float", same_scans<float>(make_float, 0.3f));
+}
+
+static void edge_cases(void)
+{
+	print_header("Edge cases");
+	ft::vector<int> v((size_t)3000, 7);
+	v[2500] = -3;
+	v[2700] = -3;
+	check("min_element returns the first tie", ft::min_element(v.begin(), v.end()) - v.begin(), (ptrdiff_t)2500);
+	check("max_element returns the first tie", ft::max_element(v.begin(), v.end()) - v.begin(), (ptrdiff_t)0);
+	check("count", ft::count(v.begin(), v.end(), 7), (ptrdiff_t)2998);
+	check("find on empty range", ft::find(v.begin(), v.begin(), 7) == v.begin());
+	check("min_element on empty range", ft::min_element(v.end(), v.end()) == v.end());
+	int sum_overflow[] = {std::numeric_limits<int>::max(), 1, -1};
+	check("accumulate wraps like a loop", ft::accumulate(sum_overflow, sum_overflow + 3, 0), std::numeric_limits<int>::max());
+
+	ft::vector<unsigned long> u((size_t)2000, 1UL << 63);
+	u[1500] = 1;
+	check("u64 min above 2^63", ft::min_element(u.begin(), u.end()) - u.begin(), (ptrdiff_t)1500);
+	check("find of a 32-bit value in u64", ft::find(u.begin(), u.end(), 1u) - u.begin(), (ptrdiff_t)1500);
+
+	ft::vector<float> f((size_t)3000, 1.0f);
+	f[10] = 0.5f;
+	f[2000] = std::numeric_limits<float>::quiet_NaN();
+	check("NaN: same min as std", ft::min_element(f.begin(), f.end()) - f.begin(),
+		  std::min_element(&f[0], &f[0] + f.size()) - &f[0]);
+	check("NaN is never found", ft::find(f.begin(), f.end(), f[2000]) == f.end());
+	f[2000] = -0.0f;
+	f[10] = 0.0f;
+	check("-0.0 == 0.0", ft::count(f.begin(), f.end(), 0.0f), (ptrdiff_t)2);
+	check("first of -0.0 and 0.0 is the min", ft::min_element(f.begin(), f.end()) - f.begin(), (ptrdiff_t)10);
+	float floats[] = {0.1f, 0.2f, 0.3f};
+	check("float accumulate keeps its order", ft::accumulate(floats, floats + 3, 0.0f), (0.0f + 0.1f) + 0.2f + 0.3f);
+}
+
+static void sse2_kernels(void)
+{
+#if FT_SIMD_X86
+	print_header("SSE2 kernels");
+	std::vector<int> v(3000);
+	for (size_t i = 0; i < v.size(); i++)
+		v[i] = make_int(i);
+	const int *p = &v[0];
+	size_t n = v.size();
+	check("find", ft::simd::find_i32_sse2(p, n, v[2999]), (size_t)(std::find(p, p + n, v[2999]) - p));
+	check("count", ft::simd::count_i32_sse2(p, n, v[17]), (size_t)std::count(p, p + n, v[17]));
+	check("min", ft::simd::extreme<false>(p, n, ft::simd::extreme_block_i32_sse2<false>),
+		  (size_t)(std::min_element(p, p + n) - p));
+	check("sum", ft::simd::sum_i32_sse2(p, n), std::accumulate(p, p + n, 0));
+	std::vector<float> f(v.begin(), v.end());
+	check("float max", ft::simd::extreme<true>(&f[0], n, ft::simd::extreme_block_f32_sse2<true>),
+		  (size_t)(std::max_element(f.begin(), f.end()) - f.begin()));
+	std::vector<unsigned long long> u(v.begin(), v.end());
+	check("u64 count", ft::simd::count_u64_sse2(&u[0], n, u[5]), (size_t)std::count(u.begin(), u.end(), u[5]));
+#endif
+}
+
+void test_scan(void)
+{
+	print_header("Scan");
+
+	kernels();
+	edge_cases();
+	sse2_kernels();
+}
@@ -0,0 +1,184 @@
+#include "./tests.hpp"
+#include <cstdio>
+#include <sstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "../includes/serialize.hpp"
+
+static std::string temp_path(std::string name)
+{
+	std::ostringstream path;
+	path << "/tmp/ft_" << name << "_" << getpid();
+	return (path.str());
+}
+
+template <typename T>
+static bool round_trip(const std::string &path, const T &val, T &out)
+{
+	ft::serialize(path, val);
+	ft::deserialize(path, out);
+	return (val == out);
+}
+
+template <typename T>
+static bool throws_on_read(const std::string &path, T &out)
+{
+	try
+	{
+		ft::deserialize(path, out);
+	}
+	catch (std::runtime_error &)
+	{
+		return (true);
+	}
+	return (false);
+}
+
+static void round_trips(void)
+{
+	print_header("Round trips");
+	std::string path = temp_path("serialize");
+
+	ft::vector<int> ints;
+	for (int i = 0; i < 100000; i++)
+		ints.push_back(i * 7 - 3);
+	ft::vector<int> ints_out((size_t)3, 1);
+	check("vector<int>", round_trip(path, ints, ints_out));
+	ft::vector<int> empty;
+	check("empty vector", round_trip(path, empty, ints_out));
+
+	ft::vector<std::string> words;
+	for (int i = 0; i < 1000; i++)
+		words.push_back(std::string(i % 40, 'a' + i % 26));
+	ft::vector<std::string> words_out;
+	check("vector<std::string>", round_trip(path, words, words_out));
+
+	ft::map<int, std::string> names;
+	for (int i = 0; i < 5000; i++)
+		names[(i * 40503) % 5000] = std::string(i % 13, 'x');
+	ft::map<int, std::string> names_out;
+	names_out[-1] = "stale";
+	check("map<int, std::string>", round_trip(path, names, names_out));
+
+	ft::map<long, double> numbers;
+	for (long i = 0; i < 100000; i++)
+		numbers[(i * 40503) % 100000 * 3] = (i * 40503) % 100000 * 0.25;
+	ft::map<long, double> numbers_out;
+	check("map<long, double>", round_trip(path, numbers, numbers_out));
+	check("map lookups after load", numbers_out.find(2997)->second == 999 * 0.25 &&
+										numbers_out.find(2998) == numbers_out.end());
+
+	ft::pair<int, std::string> pair(4, "four");
+	ft::pair<int, std::string> pair_out;
+	check("pair<int, std::string>", round_trip(path, pair, pair_out));
+	std::remove(path.c_str());
+}
+
+static void sorted_build(void)
+{
+	print_header("Sorted build");
+	ft::vector<ft::pair<int, int> > sorted;
+	for (int i = 0; i < 1023; i++)
+		sorted.push_back(ft::make_pair(i, -i));
+	ft::map<int, int> m;
+	m[5000] = 1;
+	m.assign_sorted(sorted.begin(), sorted.end());
+	check("assign_sorted() replaces", m.size() == 1023 && m.count(5000) == 0);
+	check("assign_sorted() keeps order", m.begin()->first == 0 && (--m.end())->first == 1022);
+	check("lookups", m.find(511)->second == -511 && m.lower_bound(1022)->first == 1022);
+	m.erase(511);
+	m.insert(ft::make_pair(2000, 0));
+	check("erase() / insert() after build", m.size() == 1023 && m.count(511) == 0);
+
+	sorted.push_back(ft::make_pair(3, 3));
+	bool thrown = false;
+	try
+	{
+		m.assign_sorted(sorted.begin(), sorted.end());
+	}
+	catch (std::invalid_argument &)
+	{
+		thrown = true;
+	}
+	check("unsorted range throws", thrown && m.size() == 1023);
+}
+
+static void bad_files(void)
+{
+	print_header("Bad files");
+	std::string path = temp_path("serialize_bad");
+	ft::vector<int> out;
+	check("missing file throws", throws_on_read(path, out));
+
+	int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (write(fd, "not a serialized stream", 23) != 23)
+		std::cout << "write failed" << std::endl;
+	close(fd);
+	check("foreign file throws", throws_on_read(path, out));
+
+	ft::vector<int> ints((size_t)1000, 5);
+	ft::serialize(path, ints);
+	if (truncate(path.c_str(), 1000) != 0)
+		std::cout << "truncate failed" << std::endl;
+	check("truncated file throws", throws_on_read(path, out));
+
+	ft::vector<ft::pair<int, int> > unsorted;
+	unsorted.push_back(ft::make_pair(2, 0));
+	unsorted.push_back(ft::make_pair(1, 0));
+	ft::serialize(path, unsorted);
+	ft::map<int, int> m;
+	check("unsorted map throws", throws_on_read(path, m));
+
+	unsigned long long huge = 1ULL << 40;
+	ft::serialize(path, ints);
+	fd = open(path.c_str(), O_WRONLY);
+	if (pwrite(fd, &huge, sizeof(huge), sizeof(ft::serial_header)) != sizeof(huge))
+		std::cout << "pwrite failed" << std::endl;
+	close(fd);
+	check("count past end of file throws", throws_on_read(path, out));
+	ft::vector<std::string> words((size_t)3, "word");
+	ft::serialize(path, words);
+	fd = open(path.c_str(), O_WRONLY);
+	if (pwrite(fd, &huge, sizeof(huge), sizeof(ft::serial_header) + sizeof(huge)) != sizeof(huge))
+		std::cout << "pwrite failed" << std::endl;
+	close(fd);
+	check("length past end of file throws", throws_on_read(path, words));
+	std::remove(path.c_str());
+}
+
+static void atomic_writes(void)
+{
+	print_header("Atomic writes");
+	std::string path = temp_path("serialize_atomic");
+	std::string tmp = path + ".tmp";
+	ft::vector<int> ints((size_t)100, 7);
+	ft::serialize(path, ints);
+	check("no temporary file left", access(tmp.c_str(), F_OK) != 0);
+
+	mkdir(tmp.c_str(), 0755);
+	bool thrown = false;
+	try
+	{
+		ft::serialize(path, ft::vector<int>((size_t)5, 1));
+	}
+	catch (std::runtime_error &)
+	{
+		thrown = true;
+	}
+	rmdir(tmp.c_str());
+	ft::vector<int> out;
+	ft::deserialize(path, out);
+	check("failed write keeps the old file", thrown && out == ints);
+	std::remove(path.c_str());
+}
+
+void test_serialize(void)
+{
+	print_header("Serialization");
+
+	round_trips();
+	sorted_build();
+	bad_files();
+	atomic_writes();
+}
@@ -0,0 +1,96 @@
+#include "./tests.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+
+static std::vector<int> sorted_ints(size_t n, int range, unsigned int seed)
+{
+	std::vector<int> v(n);
+	srand(seed);
+	for (size_t i = 0; i < n; i++)
+		v[i] = rand() % range;
+	std::sort(v.begin(), v.end());
+	return (v);
+}
+
+static void ranges(void)
+{
+	print_header("Sorted ranges");
+	std::vector<int> a = sorted_ints(5000, 3000, 1);
+	std::vector<int> b = sorted_ints(3000, 3000, 2);
+	std::vector<int> ref;
+	ft::vector<int> out;
+
+	std::merge(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ref));
+	ft::merge(a.begin(), a.end(), b.begin(), b.end(), ft::back_inserter(out));
+	check("merge()", out == ref);
+	ref.clear();
+	out.clear();
+	std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ref));
+	ft::set_union(a.begin(), a.end(), b.begin(), b.end(), ft::back_inserter(out));
+	check("set_union() with duplicates", out == ref);
+	ref.clear();
+	out.clear();
+	std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ref));
+	ft::set_intersection(a.begin(), a.end(), b.begin(), b.end(), ft::back_inserter(out));
+	check("set_intersection() with duplicates", out == ref);
+	ref.clear();
+	out.clear();
+	std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(ref));
+	ft::set_difference(a.begin(), a.end(), b.begin(), b.end(), ft::back_inserter(out));
+	check("set_difference() with duplicates", out == ref);
+
+	std::vector<int> down(a.rbegin(), a.rend());
+	std::vector<int> empty;
+	std::vector<int> copy(down.size());
+	std::vector<int>::iterator end = ft::set_union(down.begin(), down.end(), empty.begin(), empty.end(), copy.begin(),
+												   std::greater<int>());
+	check("empty range, comparator", end == copy.end() && copy == down);
+	check("empty intersection", ft::set_intersection(a.begin(), a.end(), empty.begin(), empty.end(), copy.begin()) == copy.begin());
+}
+
+static void maps(void)
+{
+	print_header("Maps");
+	ft::map<int, int> a;
+	ft::map<int, int> b;
+	std::map<int, int> ref_a;
+	std::map<int, int> ref_b;
+	for (int i = 0; i < 3000; i++)
+	{
+		int key = (i * 7919) % 3000;
+		a.insert(ft::make_pair(key * 2, i));
+		ref_a.insert(std::make_pair(key * 2, i));
+		b.insert(ft::make_pair(key * 3, -i));
+		ref_b.insert(std::make_pair(key * 3, -i));
+	}
+	std::map<int, int> ref;
+	ft::map<int, int> result;
+
+	ref = ref_a;
+	ref.insert(ref_b.begin(), ref_b.end());
+	ft::set_union(a, b, result);
+	check("set_union() keeps values of a", result == ref);
+	ref.clear();
+	for (std::map<int, int>::iterator it = ref_a.begin(); it != ref_a.end(); ++it)
+		if (ref_b.count(it->first))
+			ref.insert(*it);
+	ft::set_intersection(a, b, result);
+	check("set_intersection()", result == ref && result.size() == 1000);
+	ref.clear();
+	for (std::map<int, int>::iterator it = ref_a.begin(); it != ref_a.end(); ++it)
+		if (!ref_b.count(it->first))
+			ref.insert(*it);
+	ft::set_difference(a, b, a);
+	check("set_difference() into a", a == ref);
+	ft::set_intersection(a, b, a);
+	check("disjoint maps", a.empty());
+}
+
+void test_set_operations(void)
+{
+	print_header("Set operations");
+
+	ranges();
+	maps();
+}
@@ -0,0 +1,105 @@
+#include "./tests.hpp"
+#include <pthread.h>
+
+typedef ft::sharded_map<int, int, 8> int_map;
+
+struct ShardSizes
+{
+	size_t total;
+	size_t empty_shards;
+
+	ShardSizes() : total(0), empty_shards(0) {}
+
+	void operator()(const int_map::shard_type &shard)
+	{
+		total += shard.size();
+		if (shard.empty())
+			empty_shards++;
+	}
+};
+
+static void basics(void)
+{
+	print_header("Find / Insert / Erase");
+	int_map m;
+	int out = 0;
+	check("empty()", m.empty());
+	check("insert(1, 10)", m.insert(ft::make_pair(1, 10)));
+	check("insert duplicate fails", !m.insert(ft::make_pair(1, 11)));
+	check("find(1)", m.find(1, out) && out == 10);
+	check("find(2) fails", !m.find(2, out));
+	check("count(1) == 1", m.count(1), (size_t)1);
+	check("erase(1) == 1", m.erase(1), (size_t)1);
+	check("erase(1) == 0", m.erase(1), (size_t)0);
+	check("shard_count() == 8", m.shard_count(), (size_t)8);
+}
+
+static void shards(void)
+{
+	print_header("Shards");
+	int_map m;
+	for (int i = 0; i < 1000; i++)
+		m.insert(ft::make_pair(i, i));
+	ShardSizes sizes = m.for_each_shard(ShardSizes());
+	check("size() == 1000", m.size(), (size_t)1000);
+	check("shard sizes add up", sizes.total, (size_t)1000);
+	check("keys spread over every shard", sizes.empty_shards, (size_t)0);
+	m.clear();
+	check("clear()", m.empty());
+}
+
+#define THREADS 4
+#define KEYS_PER_THREAD 2000
+
+struct Worker
+{
+	int_map *map;
+	int id;
+};
+
+static void *writer(void *arg)
+{
+	Worker *w = static_cast<Worker *>(arg);
+	for (int i = 0; i < KEYS_PER_THREAD; i++)
+	{
+		int key = w->id * KEYS_PER_THREAD + i;
+		w->map->insert(ft::make_pair(key, key * 2));
+		if (i % 2)
+			w->map->erase(key);
+	}
+	return (NULL);
+}
+
+static void threads(void)
+{
+	print_header("Threads");
+	int_map m;
+	pthread_t threads[THREADS];
+	Worker workers[THREADS];
+	for (int i = 0; i < THREADS; i++)
+	{
+		workers[i].map = &m;
+		workers[i].id = i;
+		pthread_create(&threads[i], NULL, writer, &workers[i]);
+	}
+	for (int i = 0; i < THREADS; i++)
+		pthread_join(threads[i], NULL);
+	bool found = true;
+	for (int key = 0; key < THREADS * KEYS_PER_THREAD; key++)
+	{
+		int out = -1;
+		bool present = m.find(key, out);
+		found = found && (key % 2 ? !present : present && out == key * 2);
+	}
+	check("size() after concurrent writes", m.size(), (size_t)(THREADS * KEYS_PER_THREAD / 2));
+	check("every key where expected", found);
+}
+
+void test_sharded_map(void)
+{
+	print_header("Sharded map");
+
+	basics();
+	shards();
+	threads();
+}
@@ -0,0 +1,139 @@
+#include "./tests.hpp"
+#include <algorithm>
+#include <functional>
+#include <cstdlib>
+
+/**
+ * @brief Record sorted on key only, to see whether equal keys keep their order.
+ */
+struct Record
+{
+	int key;
+	int order;
+};
+
+static bool by_key(const Record &a, const Record &b)
+{
+	return (a.key < b.key);
+}
+
+static bool same_records(const std::vector<Record> &a, const std::vector<Record> &b)
+{
+	if (a.size() != b.size())
+		return (false);
+	for (size_t i = 0; i < a.size(); i++)
+		if (a[i].key != b[i].key || a[i].order != b[i].order)
+			return (false);
+	return (true);
+}
+
+static std::vector<int> random_ints(size_t n, int range)
+{
+	std::vector<int> v(n);
+	srand(42);
+	for (size_t i = 0; i < n; i++)
+		v[i] = rand() % range;
+	return (v);
+}
+
+static void sort(void)
+{
+	print_header("Introsort");
+	std::vector<int> ref = random_ints(10000, 1 << 30);
+	ft::vector<int> v;
+	for (size_t i = 0; i < ref.size(); i++)
+		v.push_back(ref[i]);
+	std::vector<int> copy(ref);
+	std::sort(ref.begin(), ref.end());
+	ft::sort(v.begin(), v.end());
+	check("ft::vector random ints", v == ref);
+	ft::sort(copy.begin(), copy.end(), std::greater<int>());
+	std::reverse(copy.begin(), copy.end());
+	check("std::greater comparator", copy == ref);
+
+	std::vector<int> sorted(ref);
+	ft::sort(sorted.begin(), sorted.end());
+	check("already sorted", sorted == ref);
+	std::vector<int> reversed(ref.rbegin(), ref.rend());
+	ft::sort(reversed.begin(), reversed.end());
+	check("reversed", reversed == ref);
+	std::vector<int> few = random_ints(10000, 3);
+	std::vector<int> few_ref(few);
+	ft::sort(few.begin(), few.end());
+	std::sort(few_ref.begin(), few_ref.end());
+	check("many duplicates", few == few_ref);
+
+	int small[] = {3, 1, 2};
+	ft::sort(small, small + 3);
+	check("pointer range", small[0] == 1 && small[1] == 2 && small[2] == 3);
+	ft::sort(small, small);
+	check("empty range", small[0], 1);
+
+	std::vector<std::string> words;
+	words.push_back("pear");
+	words.push_back("apple");
+	words.push_back("fig");
+	ft::sort(words.begin(), words.end());
+	check("strings", words[0] + words[1] + words[2], std::string("applefigpear"));
+}
+
+static void stable_sort(void)
+{
+	print_header("Stable sort");
+	std::vector<int> keys = random_ints(5000, 50);
+	std::vector<Record> records(keys.size());
+	for (size_t i = 0; i < keys.size(); i++)
+	{
+		records[i].key = keys[i];
+		records[i].order = i;
+	}
+	std::vector<Record> ref(records);
+	std::stable_sort(ref.begin(), ref.end(), by_key);
+	ft::stable_sort(records.begin(), records.end(), by_key);
+	check("equal keys keep their order", same_records(records, ref));
+
+	std::vector<int> ints = random_ints(1000, 1 << 30);
+	ft::vector<int> v;
+	for (size_t i = 0; i < ints.size(); i++)
+		v.push_back(ints[i]);
+	std::sort(ints.begin(), ints.end());
+	ft::stable_sort(v.begin(), v.end());
+	check("ft::vector random ints", v == ints);
+}
+
+static void parallel_sort(void)
+{
+	print_header("Parallel sort");
+	ft::thread_pool pool(4);
+	check("pool.size() == 4", pool.size(), (size_t)4);
+
+	std::vector<int> ref = random_ints(300000, 1 << 30);
+	ft::vector<int> v;
+	for (size_t i = 0; i < ref.size(); i++)
+		v.push_back(ref[i]);
+	std::sort(ref.begin(), ref.end());
+	ft::parallel_sort(v.begin(), v.end(), std::less<int>(), pool);
+	check("ft::vector on 4 threads", v == ref);
+
+	ft::thread_pool odd(3);
+	std::vector<int> few = random_ints(200000, 10);
+	std::vector<int> few_ref(few);
+	std::sort(few_ref.begin(), few_ref.end());
+	ft::parallel_sort(few.begin(), few.end(), std::less<int>(), odd);
+	check("many duplicates on 3 threads", few == few_ref);
+
+	std::vector<int> tiny = random_ints(100, 1000);
+	std::vector<int> tiny_ref(tiny);
+	std::sort(tiny_ref.begin(), tiny_ref.end());
+	ft::parallel_sort(tiny.begin(), tiny.end());
+	check("small range falls back to sort", tiny == tiny_ref);
+}
+
+void test_sort(void)
+{
+	print_header("Sort");
+
+	sort();
+	stable_sort();
+	parallel_sort();
+}
@@ -0,0 +1,162 @@
+#include "./tests.hpp"
+#include <pthread.h>
+#include <sched.h>
+
+static void capacity(void)
+{
+	print_header("Capacity");
+	ft::spsc_ring<int> r1(1);
+	ft::spsc_ring<int> r2(5);
+	ft::spsc_ring<int> r3(64);
+	check("r1.capacity() == 1", r1.capacity(), (size_t)1);
+	check("r2.capacity() == 8", r2.capacity(), (size_t)8);
+	check("r3.capacity() == 64", r3.capacity(), (size_t)64);
+	check("r3.empty()", r3.empty());
+}
+
+static void push_pop(void)
+{
+	print_header("Push / Pop");
+	ft::spsc_ring<std::string> r(4);
+	std::string out;
+	check("push a", r.try_push("a"));
+	check("push b", r.try_push("b"));
+	check("push c", r.try_push("c"));
+	check("push d", r.try_push("d"));
+	check("push when full fails", !r.try_push("e"));
+	check("r.size() == 4", r.size(), (size_t)4);
+	check("pop a", r.try_pop(out) && out == "a");
+	check("push e after pop", r.try_push("e"));
+	check("pop b", r.try_pop(out) && out == "b");
+	check("pop c", r.try_pop(out) && out == "c");
+	check("pop d", r.try_pop(out) && out == "d");
+	check("pop e", r.try_pop(out) && out == "e");
+	check("pop when empty fails", !r.try_pop(out));
+}
+
+static void batch(void)
+{
+	print_header("Batch");
+	ft::spsc_ring<int> r(8);
+	int in[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+	int out[12] = {0};
+	check("push_n(5) == 5", r.try_push_n(in, 5), (size_t)5);
+	check("pop_n(3) == 3", r.try_pop_n(out, 3), (size_t)3);
+	check("pop_n keeps order", out[0] == 0 && out[1] == 1 && out[2] == 2);
+	check("push_n wraps, stops when full", r.try_push_n(in + 5, 7), (size_t)6);
+	check("pop_n(12) == 8", r.try_pop_n(out, 12), (size_t)8);
+	bool ordered = true;
+	for (int i = 0; i < 8; i++)
+		ordered = ordered && out[i] == i + 3;
+	check("pop_n wraps in order", ordered);
+	check("pop_n when empty == 0", r.try_pop_n(out, 1), (size_t)0);
+}
+
+/**
+ * @brief Element counting its live instances, whose copy throws when its value is
+ * negative.
+ */
+struct Fragile
+{
+	static int live;
+	int value;
+
+	Fragile(int v = 0) : value(v) { live++; }
+	Fragile(const Fragile &other) : value(other.value)
+	{
+		if (value < 0)
+			throw std::runtime_error("fragile copy");
+		live++;
+	}
+	Fragile &operator=(const Fragile &other)
+	{
+		value = other.value;
+		return (*this);
+	}
+	~Fragile() { live--; }
+};
+
+int Fragile::live = 0;
+
+static void failed_batch(void)
+{
+	print_header("Failed batch");
+	{
+		ft::spsc_ring<Fragile> r(8);
+		Fragile in[6] = {0, 1, 2, 3, 4, 5};
+		Fragile out[6];
+		r.try_push_n(in, 5);
+		r.try_pop_n(out, 5);
+		in[4].value = -1;
+		bool thrown = false;
+		try
+		{
+			r.try_push_n(in, 6);
+		}
+		catch (std::runtime_error &)
+		{
+			thrown = true;
+		}
+		check("throwing copy propagates", thrown && r.empty());
+		check("copies made are destroyed", Fragile::live, 12);
+		in[4].value = 4;
+		check("push_n after a failure", r.try_push_n(in, 6) == 6 && r.try_pop_n(out, 6) == 6 && out[5].value == 5);
+	}
+	check("no element leaked", Fragile::live, 0);
+}
+
+#define HANDOFFS 200000
+
+static void *producer(void *arg)
+{
+	ft::spsc_ring<long> *r = static_cast<ft::spsc_ring<long> *>(arg);
+	long buf[16];
+	long next = 0;
+	while (next < HANDOFFS)
+	{
+		size_t n = 0;
+		while (n < 16 && next + (long)n < HANDOFFS)
+		{
+			buf[n] = next + n;
+			n++;
+		}
+		size_t pushed = r->try_push_n(buf, n);
+		if (pushed == 0)
+			sched_yield();
+		next += pushed;
+	}
+	return (NULL);
+}
+
+static void threads(void)
+{
+	print_header("Two threads");
+	ft::spsc_ring<long> r(64);
+	pthread_t thread;
+	pthread_create(&thread, NULL, producer, &r);
+	long buf[16];
+	long expected = 0;
+	bool ordered = true;
+	while (expected < HANDOFFS)
+	{
+		size_t n = r.try_pop_n(buf, 16);
+		if (n == 0)
+			sched_yield();
+		for (size_t i = 0; i < n; i++)
+			ordered = ordered && buf[i] == expected++;
+	}
+	pthread_join(thread, NULL);
+	check("all handoffs received in order", ordered);
+	check("ring drained", r.empty());
+}
+
+void test_spsc_ring(void)
+{
+	print_header("SPSC ring");
+
+	capacity();
+	push_pop();
+	batch();
+	failed_batch();
+	threads();
+}
@@ -2,9 +2,14 @@
 #define TESTS_HPP
 
 #include <vector>
+#include <map>
 #include <iostream>
 #include "../includes/vector.hpp"
 #include "../includes/map.hpp"
+#include "../includes/spsc_ring.hpp"
+#include "../includes/sharded_map.hpp"
+#include "../includes/unordered_map.hpp"
+#include "./counting_allocator.hpp"
 
 #define RESET "\e[0m"
 #define GREEN "\e[92m"
@@ -16,6 +21,20 @@
 
 void test_vector(void);
 void test_map(void);
+void test_spsc_ring(void);
+void test_sharded_map(void);
+void test_unordered_map(void);
+void test_sort(void);
+void test_scan(void);
+void test_persistent_map(void);
+void test_cow_vector(void);
+void test_mapped_vector(void);
+void test_serialize(void);
+void test_mapped_map_view(void);
+void test_huge_page_allocator(void);
+void test_set_operations(void);
+void test_parallel_map(void);
+void test_compact_map(void);
 
 inline void print_header(std::string str)
 {
@@ -61,4 +80,19 @@ bool operator==(ft::vector<T> &a, std::vector<T> &b)
 	}
 	return (true);
 };
+
+template <typename K, typename V>
+bool operator==(ft::map<K, V> &a, std::map<K, V> &b)
+{
+	if (a.size() != b.size())
+		return (false);
+	typename ft::map<K, V>::iterator it = a.begin();
+	typename std::map<K, V>::iterator std_it = b.begin();
+	for (; std_it != b.end(); ++it, ++std_it)
+	{
+		if (it == a.end() || it->first != std_it->first || it->second != std_it->second)
+			return (false);
+	}
+	return (it == a.end());
+};
 #endif
\ No newline at end of file
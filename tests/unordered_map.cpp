@@ -0,0 +1,226 @@
+#include "./tests.hpp"
+#include <string>
+#include <sstream>
+#include <stdexcept>
+
+typedef ft::unordered_map<int, int> int_map;
+
+/**
+ * @brief Hash sending every key to the same group, to exercise long probe sequences.
+ */
+struct ConstantHash
+{
+	size_t operator()(int) const { return (42); }
+};
+
+static void basics(void)
+{
+	print_header("Insert / Find / Erase");
+	int_map m;
+	check("empty()", m.empty());
+	check("bucket_count() == 0", m.bucket_count(), (size_t)0);
+	check("find() on empty table", m.find(1) == m.end());
+	check("insert(1, 10)", m.insert(ft::make_pair(1, 10)).second);
+	check("insert duplicate fails", !m.insert(ft::make_pair(1, 11)).second);
+	check("duplicate keeps value", m.find(1)->second, 10);
+	m[2] = 20;
+	check("operator[] inserts", m.at(2), 20);
+	check("operator[] default", m[3], 0);
+	check("size() == 3", m.size(), (size_t)3);
+	check("count(2) == 1", m.count(2), (size_t)1);
+	check("count(4) == 0", m.count(4), (size_t)0);
+	bool thrown = false;
+	try
+	{
+		m.at(4);
+	}
+	catch (std::out_of_range &e)
+	{
+		thrown = true;
+	}
+	check("at() throws out_of_range", thrown);
+	check("equal_range(1)", m.equal_range(1).first->second, 10);
+	check("erase(1) == 1", m.erase(1), (size_t)1);
+	check("erase(1) == 0", m.erase(1), (size_t)0);
+	check("find(1) == end()", m.find(1) == m.end());
+
+	ft::unordered_map<std::string, std::string> s;
+	s["one"] = "1";
+	s["two"] = "2";
+	check("string keys", s["one"] + s["two"], std::string("12"));
+}
+
+static void growth(void)
+{
+	print_header("Growth / Rehash");
+	int_map m;
+	std::map<int, int> ref;
+	for (int i = 0; i < 10000; i++)
+	{
+		m[i * 7] = i;
+		ref[i * 7] = i;
+	}
+	bool found = true;
+	for (std::map<int, int>::iterator it = ref.begin(); it != ref.end(); ++it)
+		found = found && m.find(it->first) != m.end() && m.find(it->first)->second == it->second;
+	check("10000 inserts all found", found);
+	check("load_factor() <= max", m.load_factor() <= m.max_load_factor());
+	size_t iterated = 0;
+	for (int_map::iterator it = m.begin(); it != m.end(); ++it)
+		iterated++;
+	check("iteration visits every element", iterated, (size_t)10000);
+
+	for (int i = 0; i < 10000; i += 2)
+		m.erase(i * 7);
+	check("size() after erasing half", m.size(), (size_t)5000);
+	m.rehash(0);
+	found = true;
+	for (int i = 0; i < 10000; i++)
+		found = found && m.count(i * 7) == (size_t)(i % 2);
+	check("rehash(0) keeps the odd keys", found);
+
+	int_map r;
+	r.reserve(1000);
+	size_t buckets = r.bucket_count();
+	for (int i = 0; i < 1000; i++)
+		r[i] = i;
+	check("reserve(1000) avoids rehash", r.bucket_count(), buckets);
+	r.max_load_factor(0.5f);
+	check("max_load_factor(0.5) rehashes", r.load_factor() <= 0.5f);
+	r.max_load_factor(2.0f);
+	check("max_load_factor() is clamped", r.max_load_factor() < 1.0f);
+}
+
+static void tombstones(void)
+{
+	print_header("Tombstones");
+	ft::unordered_map<int, int, ConstantHash> m;
+	for (int i = 0; i < 100; i++)
+		m[i] = i;
+	for (int i = 0; i < 100; i += 3)
+		m.erase(i);
+	bool found = true;
+	for (int i = 0; i < 100; i++)
+		found = found && m.count(i) == (size_t)(i % 3 != 0);
+	check("lookups walk past erased slots", found);
+
+	// Tombstones are dropped by rehashing in place, so the table stops growing
+	// once it holds twice the live elements.
+	int_map churn;
+	for (int round = 0; round < 100; round++)
+	{
+		for (int i = 0; i < 100; i++)
+			churn[round * 100 + i] = i;
+		for (int i = 0; i < 100; i++)
+			churn.erase(round * 100 + i);
+	}
+	check("insert/erase churn stays bounded", churn.bucket_count() <= 256);
+	check("churn leaves table empty", churn.empty());
+}
+
+static void copy_swap(void)
+{
+	print_header("Copy / Swap / Compare");
+	int_map a;
+	for (int i = 0; i < 500; i++)
+		a[i] = -i;
+	a.erase(250);
+	int_map b(a);
+	check("copy == original", a == b);
+	b[250] = 0;
+	check("modified copy != original", a != b);
+	int_map c;
+	c = b;
+	check("operator= copies", c == b);
+	int_map d;
+	d[1] = 1;
+	ft::swap(a, d);
+	check("swap() exchanges sizes", a.size() + d.size(), (size_t)500);
+	check("swap() exchanges content", a.count(1) && d.count(499));
+	c.clear();
+	check("clear()", c.empty() && c.find(10) == c.end());
+	const int_map &cb = b;
+	check("const find()", cb.find(10)->second, -10);
+}
+
+/**
+ * @brief Chi-square statistic of n keys spread over the given number of buckets by
+ * their high bits, which is what picks the first group to probe.
+ */
+template <class Key>
+static double chi_square(const Key *keys, size_t n, size_t buckets)
+{
+	std::vector<size_t> counts(buckets, 0);
+	ft::hash<Key> hf;
+	for (size_t i = 0; i < n; i++)
+		counts[(hf(keys[i]) >> 7) & (buckets - 1)]++;
+	double expected = static_cast<double>(n) / buckets;
+	double chi = 0;
+	for (size_t i = 0; i < buckets; i++)
+		chi += (counts[i] - expected) * (counts[i] - expected) / expected;
+	return (chi);
+}
+
+static void hash_quality(void)
+{
+	print_header("Hash quality");
+	const size_t n = 1 << 16;
+	const size_t buckets = 1024;
+	// For 1023 degrees of freedom, chi-square stays below ~1200 unless biased.
+	std::vector<int> seq(n);
+	std::vector<int> strided(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		seq[i] = i;
+		strided[i] = i * 1024;
+	}
+	check("sequential ints spread evenly", chi_square(&seq[0], n, buckets) < 1200);
+	check("strided ints spread evenly", chi_square(&strided[0], n, buckets) < 1200);
+
+	std::vector<std::string> words(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		std::ostringstream out;
+		out << "key_" << i;
+		words[i] = out.str();
+	}
+	check("similar strings spread evenly", chi_square(&words[0], n, buckets) < 1200);
+
+	// The low 7 bits are the control byte: they must be uniform too, or the
+	// group match reports false candidates.
+	std::vector<size_t> h2(128, 0);
+	ft::hash<int> hf;
+	for (size_t i = 0; i < n; i++)
+		h2[hf(seq[i]) & 0x7f]++;
+	double chi = 0;
+	double expected = static_cast<double>(n) / 128;
+	for (size_t i = 0; i < 128; i++)
+		chi += (h2[i] - expected) * (h2[i] - expected) / expected;
+	check("control bytes uniform", chi < 180);
+
+	// Avalanche: flipping one input bit flips about half of the output bits.
+	double flipped = 0;
+	size_t trials = 0;
+	for (unsigned int k = 0; k < 1024; k++)
+	{
+		for (int bit = 0; bit < 32; bit++)
+		{
+			size_t diff = hf(k) ^ hf(k ^ (1u << bit));
+			flipped += __builtin_popcountl(diff);
+			trials++;
+		}
+	}
+	double ratio = flipped / trials / (sizeof(size_t) * 8);
+	check("avalanche close to 50%", ratio > 0.45 && ratio < 0.55);
+}
+
+void test_unordered_map(void)
+{
+	print_header("Unordered map");
+
+	basics();
+	growth();
+	tombstones();
+	copy_swap();
+	hash_quality();
+}
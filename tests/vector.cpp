@@ -199,6 +199,9 @@ static void erase(void)
 	check("v1 == v2", v1 == v2);
 }
 
+struct vector_allocations;
+typedef AllocationCounter<count_objects, vector_allocations> vector_counter;
+
 static void assign(void)
 {
 	print_header("Assign");
@@ -211,6 +214,32 @@ static void assign(void)
 	v1.assign(10, "?");
 	v2.assign(10, "?");
 	check("v1 == v2", v1 == v2);
+
+	vector_counter::allocated = 0;
+	ft::vector<std::string, CountingAllocator<std::string, vector_counter> > buffer;
+	ft::vector<std::string, CountingAllocator<std::string, vector_counter> > longer(12, "long");
+	ft::vector<std::string, CountingAllocator<std::string, vector_counter> > shorter(3, "short");
+	buffer.reserve(16);
+	size_t allocations = vector_counter::allocated;
+	bool refills = true;
+	for (int round = 0; round < 4; round++)
+	{
+		buffer = longer;
+		refills = refills && buffer == longer;
+		buffer = shorter;
+		refills = refills && buffer == shorter;
+		buffer.assign(test, test + 4);
+		refills = refills && buffer.size() == 4 && buffer[3] == "?";
+		buffer.assign(16, "x");
+		refills = refills && buffer.size() == 16 && buffer.back() == "x";
+		buffer.assign(1, buffer[15]);
+		refills = refills && buffer.size() == 1 && buffer[0] == "x";
+	}
+	check("refills reuse the buffer", refills && vector_counter::allocated == allocations && buffer.capacity() == 16);
+	buffer.assign(17, "y");
+	check("assign() past capacity", vector_counter::allocated == allocations + 17 && buffer.size() == 17 && buffer[16] == "y");
+	shorter = buffer;
+	check("operator= past capacity", shorter == buffer && shorter.capacity() == 17);
 }
 
 static void swap(void)
@@ -236,6 +265,110 @@ static void swap(void)
 	check("v3 == v4", v3 == v4);
 }
 
+/**
+ * @brief Runs the six relational operators on ft and std vectors built from the same
+ * data, with one element changed at position, and checks they agree.
+ */
+template <typename T>
+static bool same_ordering(size_t size, size_t position, T changed)
+{
+	ft::vector<T> a;
+	ft::vector<T> b;
+	std::vector<T> c;
+	std::vector<T> d;
+	for (size_t i = 0; i < size; i++)
+	{
+		T val = static_cast<T>(i * 37);
+		a.push_back(val);
+		c.push_back(val);
+		b.push_back(i == position ? changed : val);
+		d.push_back(i == position ? changed : val);
+	}
+	return ((a == b) == (c == d) && (a != b) == (c != d) && (a < b) == (c < d) &&
+			(a <= b) == (c <= d) && (a > b) == (c > d) && (a >= b) == (c >= d) &&
+			(b < a) == (d < c));
+}
+
+static void bitwise_operators(void)
+{
+	print_header("Operators on raw memory");
+	size_t positions[] = {0, 15, 16, 31, 32, 33, 63, 998, 999, 1000};
+	bool uchar_ok = true;
+	bool int_ok = true;
+	bool long_ok = true;
+	for (size_t i = 0; i < sizeof(positions) / sizeof(*positions); i++)
+	{
+		uchar_ok = uchar_ok && same_ordering<unsigned char>(1000, positions[i], 200);
+		uchar_ok = uchar_ok && same_ordering<unsigned char>(1000, positions[i], 0);
+		int_ok = int_ok && same_ordering<int>(1000, positions[i], -1);
+		int_ok = int_ok && same_ordering<int>(1000, positions[i], 1 << 20);
+		long_ok = long_ok && same_ordering<long>(1000, positions[i], 256);
+		long_ok = long_ok && same_ordering<long>(1000, positions[i], -256);
+	}
+	check("unsigned char", uchar_ok);
+	check("int, negative and large", int_ok);
+	check("long, byte order", long_ok);
+
+	ft::vector<int> shorter((size_t)10, 5);
+	ft::vector<int> longer((size_t)11, 5);
+	ft::vector<int> empty;
+	check("prefix < longer", shorter < longer && !(longer < shorter));
+	check("empty < non empty", empty < shorter && !(shorter < empty));
+	check("empty == empty", empty == ft::vector<int>());
+	ft::vector<float> zeros(3, 0.0f);
+	ft::vector<float> negative_zeros(3, -0.0f);
+	check("floats compare by value", zeros == negative_zeros);
+}
+
+struct vector_stats_tag
+{
+};
+
+typedef ft::thread_local_stats<vector_stats_tag> local_stats;
+
+static void *count_in_thread(void *)
+{
+	ft::vector<int, std::allocator<int>, local_stats> v;
+	for (int i = 0; i < 100; i++)
+		v.push_back(i);
+	return (NULL);
+}
+
+static void stats_policies(void)
+{
+	print_header("Stats policies");
+	typedef ft::atomic_stats<vector_stats_tag> stats;
+	typedef ft::vector<int, std::allocator<int>, stats> counted;
+
+	stats::reset();
+	counted v;
+	v.reserve(4);
+	for (int i = 0; i < 4; i++)
+		v.push_back(i);
+	check("reserve() counts a reallocation", stats::counts().reallocations == 1 && stats::counts().element_copies == 0);
+	v.reserve(8);
+	check("reserve() counts copies and bytes", stats::counts().element_copies == 4 && stats::counts().bytes_moved == 4 * sizeof(int));
+
+	stats::reset();
+	v.insert(v.begin() + 1, 9);
+	check("insert() counts shifted elements", stats::counts().element_copies == 3 && stats::counts().reallocations == 0);
+	v.erase(v.begin());
+	check("erase() counts shifted elements", stats::counts().element_copies == 3 + 4);
+	v.erase(v.begin(), v.begin() + 2);
+	check("erase(first, last) counts", stats::counts().element_copies == 3 + 4 + 2);
+	stats::reset();
+	check("reset()", stats::counts().element_copies == 0 && stats::counts().bytes_moved == 0);
+
+	local_stats::reset();
+	pthread_t thread;
+	pthread_create(&thread, NULL, count_in_thread, NULL);
+	pthread_join(thread, NULL);
+	check("thread_local_stats is per thread", local_stats::counts().reallocations == 0);
+	count_in_thread(NULL);
+	check("thread_local_stats counts", local_stats::counts().reallocations > 0);
+	check("null_stats adds no state", sizeof(ft::vector<int>) == sizeof(counted));
+}
+
 void test_vector(void)
 {
 	print_header("Vector");
@@ -251,4 +384,6 @@ void test_vector(void)
 	erase();
 	swap();
 	operators();
+	bitwise_operators();
+	stats_policies();
 }